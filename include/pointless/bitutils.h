@@ -13,4 +13,8 @@ void bm_set_(void* bitmask, uint64_t bit_index);
 void bm_reset_(void* bitmask, uint64_t bit_index);
 unsigned char bm_is_set_(void* bitmask, uint64_t bit_index);
 
+// same as bm_set_/bm_is_set_, but other threads may set bits in the same bitmask at the same time
+void bm_set_atomic_(void* bitmask, uint64_t bit_index);
+unsigned char bm_is_set_atomic_(void* bitmask, uint64_t bit_index);
+
 #endif
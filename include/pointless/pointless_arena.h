@@ -0,0 +1,51 @@
+#ifndef __POINTLESS__ARENA__H__
+#define __POINTLESS__ARENA__H__
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifndef __cplusplus
+#include <limits.h>
+#include <stdint.h>
+#else
+#include <climits>
+#include <cstdint>
+#endif
+
+#include <pointless/pointless_malloc.h>
+#include <pointless/pointless_int_ops.h>
+
+// bump allocator for buffers which live until the arena is destroyed, all of them are freed at once
+
+// allocations are rounded up to this, so uint32/uint64 prefixed buffers stay aligned
+#define POINTLESS_ARENA_ALIGN 8
+
+typedef struct pointless_arena_block_s {
+	struct pointless_arena_block_s* next;
+	size_t n_bytes;
+	size_t n_used;
+} pointless_arena_block_t;
+
+typedef struct {
+	// the block we are bumping in, followed by all older blocks
+	pointless_arena_block_t* head;
+
+	// size of the next regular block
+	size_t block_size;
+
+	// most recent allocation, for rollback
+	pointless_arena_block_t* last_block;
+	size_t last_n_used;
+} pointless_arena_t;
+
+void pointless_arena_init(pointless_arena_t* a);
+void pointless_arena_destroy(pointless_arena_t* a);
+
+// returns 0 if we run out of memory
+void* pointless_arena_alloc(pointless_arena_t* a, size_t n_bytes);
+
+// frees p, which must be the most recent allocation
+void pointless_arena_rollback(pointless_arena_t* a, void* p);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef __POINTLESS__CHECKSUM__H__
+#define __POINTLESS__CHECKSUM__H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __cplusplus
+#include <limits.h>
+#include <stdint.h>
+#else
+#include <climits>
+#include <cstdint>
+#endif
+
+// XXH64, for integrity checks only, it is not a hash table hash
+uint64_t pointless_checksum_64(const void* buffer, uint64_t n_bytes, uint64_t seed);
+
+// incremental version of the above, for data which is written out piece by piece
+typedef struct {
+	uint64_t v[4];
+	uint64_t seed;
+	uint64_t n_total;
+	uint8_t buffer[32];
+	uint32_t n_buffer;
+} pointless_checksum_state_t;
+
+void pointless_checksum_64_init(pointless_checksum_state_t* state, uint64_t seed);
+void pointless_checksum_64_update(pointless_checksum_state_t* state, const void* buffer, uint64_t n_bytes);
+uint64_t pointless_checksum_64_digest(pointless_checksum_state_t* state);
+
+#endif
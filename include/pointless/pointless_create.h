@@ -21,15 +21,36 @@
 #include <pointless/pointless_unicode_utils.h>
 #include <pointless/bitutils.h>
 #include <pointless/pointless_cycle_marker_wrappers.h>
+#include <pointless/pointless_checksum.h>
+#include <pointless/custom_sort.h>
+#include <pointless/pointless_parallel.h>
 
-#include <Judy.h>
 
 // creation
 void pointless_create_begin_32(pointless_create_t* c);
 void pointless_create_begin_64(pointless_create_t* c);
+// a POINTLESS_FF_VERSION_OFFSET_64_FEATURES file with exactly the given POINTLESS_FF_FEATURE_* bits, where
+// POINTLESS_FF_FEATURE_INTERLEAVED or POINTLESS_FF_FEATURE_MPHF sets the layout of all sets/maps, returns 0 for
+// combinations which are not supported, leaving c as after pointless_create_begin_64(), to be ended as usual
+int pointless_create_begin_64_features(pointless_create_t* c, uint32_t features, const char** error);
+// after any of the above: the caller guarantees that no container is reachable from itself, so cycle detection is skipped,
+// a cycle then results in a file which does not validate
+void pointless_create_begin_acyclic(pointless_create_t* c);
+// after any of the above: build the set and map hash tables on n_threads threads, the output is the same as with one
+void pointless_create_begin_parallel(pointless_create_t* c, uint32_t n_threads);
+// after any of the above, before any value is created: keep string/unicode and bitvector buffers in a temporary file in dir,
+// or in $TMPDIR if dir is 0, instead of in memory, the output is the same, returns 0 if the file can not be created
+int pointless_create_begin_spill(pointless_create_t* c, const char* dir, const char** error);
+// after any of the above, before any value is created: create-time arrays and tables which grow past threshold bytes
+// move to memory mapped temporary files in dir, or in $TMPDIR if dir is 0, so the kernel can page them out
+int pointless_create_begin_file_backing(pointless_create_t* c, const char* dir, size_t threshold, const char** error);
 void pointless_create_end(pointless_create_t* c);
 int pointless_create_output_and_end_f(pointless_create_t* c, const char* fname, const char** error);
 int pointless_create_output_and_end_b(pointless_create_t* c, void** buf, size_t* buflen, const char** error);
+// the output goes into a single buffer from alloc(n_bytes, user), which is called once with the exact size of the output,
+// before any of it is written, and returns 0 if it can not provide one, on failure after alloc, the buffer is still the caller's
+typedef void* (*pointless_create_alloc_cb)(size_t n_bytes, void* user);
+int pointless_create_output_and_end_a(pointless_create_t* c, pointless_create_alloc_cb alloc, void* user, void** buf, size_t* buflen, const char** error);
 
 // set the root
 void pointless_create_set_root(pointless_create_t* c, uint32_t root);
@@ -12,25 +12,47 @@
 #include <cstdint>
 #endif
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include <Judy.h>
-
-#ifdef __cplusplus
-}
-#endif
-
 #include <pointless/pointless_dynarray.h>
 #include <pointless/pointless_create_cache.h>
+#include <pointless/pointless_open_table.h>
+#include <pointless/pointless_arena.h>
+#include <pointless/pointless_spill.h>
 
 #define POINTLESS_FILE_FORMAT_OLDEST_VERSION_ 0
-#define POINTLESS_FILE_FORMAT_LATEST_VERSION_ 2
+#define POINTLESS_FILE_FORMAT_LATEST_VERSION_ 3
 
 #define POINTLESS_FF_VERSION_OFFSET_32_OLDHASH 0
 #define POINTLESS_FF_VERSION_OFFSET_32_NEWHASH 1
 #define POINTLESS_FF_VERSION_OFFSET_64_NEWHASH 2
+#define POINTLESS_FF_VERSION_OFFSET_64_FEATURES 3
+
+// format features, POINTLESS_FF_VERSION_OFFSET_64_FEATURES files store any combination of them in the upper half of the header version
+#define POINTLESS_FF_FEATURE_CHECKSUM    (1 << 0)
+#define POINTLESS_FF_FEATURE_INTERLEAVED (1 << 1)
+#define POINTLESS_FF_FEATURE_MPHF        (1 << 2)
+#define POINTLESS_FF_FEATURE_FASTHASH    (1 << 3)
+#define POINTLESS_FF_FEATURE_HASH_SLOTS  (1 << 4)
+#define POINTLESS_FF_FEATURE_UTF8        (1 << 5)
+#define POINTLESS_FF_FEATURE_ALL_        ((1 << 6) - 1)
+
+#define POINTLESS_FF_VERSION_NUMBER(v)   ((v) & 0xFFFF)
+#define POINTLESS_FF_VERSION_FEATURES(v) ((v) >> 16)
+
+// set/map bucket layouts, interleaved tables are only allowed with POINTLESS_FF_FEATURE_INTERLEAVED,
+// minimal perfect hash tables with POINTLESS_FF_FEATURE_MPHF
+#define POINTLESS_HASH_TABLE_LAYOUT_SPLIT 0
+#define POINTLESS_HASH_TABLE_LAYOUT_INTERLEAVED 1
+#define POINTLESS_HASH_TABLE_LAYOUT_MPHF 2
+
+// uint32_t words before the pilots of a minimal perfect hash table: n_primary, n_pilots
+#define POINTLESS_MPHF_HEADER_WORDS 2
+
+// uint32_t words per interleaved bucket: hash, key (and value)
+#define POINTLESS_SET_INTERLEAVED_STRIDE 3
+#define POINTLESS_MAP_INTERLEAVED_STRIDE 5
+
+// heap block size for section checksums, the last block may be shorter
+#define POINTLESS_CHECKSUM_HEAP_BLOCK_SIZE (1 << 20)
 
 #define ASSERT_CONCAT_(a, b) a##b
 #define ASSERT_CONCAT(a, b) ASSERT_CONCAT_(a, b)
@@ -77,6 +99,7 @@ extern "C" {
 // unicode strings
 #define POINTLESS_UNICODE_ 10
 #define POINTLESS_STRING_ 29
+#define POINTLESS_UNICODE_UTF8 30
 
 // bitvector
 #define POINTLESS_BITVECTOR        11
@@ -200,8 +223,65 @@ uint32/64_t set_offsets[n_sets]
 uint32/64_t map_offsets[n_maps]
 
 <HEAP>
+
+POINTLESS_FF_VERSION_OFFSET_64_FEATURES files keep the version in the lower 16
+bits of the header version, and POINTLESS_FF_FEATURE_* bits in the upper 16,
+each of which turns on one of the following independently of the others
+
+POINTLESS_FF_FEATURE_CHECKSUM adds a trailer, starting at the first 8-byte
+boundary after the heap:
+
+uint64_t heap_block_checksums[n_heap_blocks]
+pointless_checksum_trailer_t
+
+POINTLESS_FF_FEATURE_INTERLEAVED allows sets/maps to use
+POINTLESS_HASH_TABLE_LAYOUT_INTERLEAVED, where the hash vector holds one record
+per bucket, and the key/value vectors are empty:
+
+uint32_t hash
+pointless_value_t key
+pointless_value_t value (maps only)
+
+POINTLESS_FF_FEATURE_MPHF allows POINTLESS_HASH_TABLE_LAYOUT_MPHF instead, with
+exactly n_items records of the same form, placed by a minimal perfect hash over
+the distinct key hashes:
+
+uint32_t n_primary
+uint32_t n_pilots
+uint32_t pilots[n_pilots]
+record[n_items]
+
+records [0, n_primary) hold the distinct hashes, each at the slot its pilot
+sends it to, records [n_primary, n_items) hold keys sharing their hash with an
+earlier record, sorted by hash
+
+POINTLESS_FF_FEATURE_FASTHASH hashes strings and unicodes with the v2 string
+hash, over the code points given by their length prefix
+
+POINTLESS_FF_FEATURE_HASH_SLOTS stores the hash of each string/unicode and
+vector, at the start of the heap, with all heap offsets counted from its base
+as usual:
+
+uint32_t string_unicode_hashes[n_string_unicode]
+uint32_t vector_hashes[n_vector]
+
+only vectors reachable from a set/map key have their hash stored, all other
+vectors, and those which are not hashable, store 0, and readers compute
+their hash when needed
+
+POINTLESS_FF_FEATURE_UTF8 stores unicodes as POINTLESS_UNICODE_UTF8, laid out
+like strings, with the length counting bytes, and hashed over their code points
+with either string hash:
+
+uint32_t n_bytes
+uint8_t utf8[n_bytes + 1]
+
+the encoding is UTF-8, with surrogates allowed, as in Python "surrogatepass"
 */
 
+// features of a header version, none for versions before POINTLESS_FF_VERSION_OFFSET_64_FEATURES
+uint32_t pointless_ff_version_features(uint32_t version);
+
 typedef struct {
 	pointless_value_t root;
 	uint32_t n_string_unicode;
@@ -212,18 +292,44 @@ typedef struct {
 	uint32_t version;
 } __attribute__ ((aligned (4))) pointless_header_t;
 
+// XXH64 checksums of the header and each offset vector, the trailer checksum covers
+// the heap block checksums and all fields before it
+typedef struct {
+	uint64_t header_checksum;
+	uint64_t offsets_checksum[5];
+	uint64_t heap_len;
+	uint64_t heap_block_size;
+	uint64_t n_heap_blocks;
+	uint64_t trailer_checksum;
+} pointless_checksum_trailer_t;
+
+// state for on-first-touch validation, one "validated" bit per container, and one more for vectors and
+// maps, whose children are only validated all the way down when reached through a set/map key
+typedef struct {
+	const char* error;
+	void* string_unicode;
+	void* vector;
+	void* bitvector;
+	void* set;
+	void* map;
+	void* vector_deep;
+	void* map_deep;
+} pointless_validate_lazy_t;
+
 typedef struct {
 	// mmap, library owned
 	FILE* fd;
 	uint64_t fd_len;
 	void* fd_ptr;
 
-	// regular memory, library owned
+	// regular memory, library owned unless borrowed
 	void* buf;
 	size_t buflen;
+	int buf_is_borrowed;
 
-	// header
+	// header, and the POINTLESS_FF_FEATURE_* bits its version implies or holds
 	pointless_header_t* header;
+	uint32_t features;
 
 	// offset vectors
 	uint64_t* string_unicode_offsets_64;
@@ -235,18 +341,32 @@ typedef struct {
 	// base heap pointer
 	void* heap_ptr;
 	uint64_t heap_len;
+
+	// only set when opened with lazy validation
+	pointless_validate_lazy_t* lazy;
+
+	// background prefetch threads, joined at close
+	void* prefetch;
+
+	// only set for files with section checksums
+	pointless_checksum_trailer_t* checksum_trailer;
+	uint64_t* heap_block_checksums;
+
+	// only set for files with stored hashes
+	uint32_t* string_unicode_hashes;
+	uint32_t* vector_hashes;
 } pointless_t;
 
 typedef struct {
 	uint32_t n_items;
-	uint32_t padding;
+	uint32_t layout;
 	pointless_value_t hash_vector;
 	pointless_value_t key_vector;
 } __attribute__ ((aligned (4))) pointless_set_header_t;
 
 typedef struct {
 	uint32_t n_items;
-	uint32_t padding;
+	uint32_t layout;
 	pointless_value_t hash_vector;
 	pointless_value_t key_vector;
 	pointless_value_t value_vector;
@@ -260,6 +380,7 @@ STATIC_ASSERT(sizeof(pointless_create_value_t)          == 8,  "pointless_create
 STATIC_ASSERT(sizeof(pointless_complete_create_value_t) == 12, "pointless_complete_create_value_t must be 12 bytes");
 STATIC_ASSERT(sizeof(pointless_header_t)                == 32, "pointless_header_t must be 32 bytes");
 STATIC_ASSERT(sizeof(pointless_set_header_t)            == 24, "pointless_set_header_t must be 24 bytes");
+STATIC_ASSERT(sizeof(pointless_checksum_trailer_t)      == 80, "pointless_checksum_trailer_t must be 80 bytes");
 STATIC_ASSERT(sizeof(pointless_map_header_t)            == 32, "pointless_map_header_t must be 32 bytes");
 
 // pointless-owned vector
@@ -277,7 +398,8 @@ typedef struct {
 	// used during creation phase
 	pointless_dynarray_t keys;
 
-	// used during serialization phase, no-one else touches these
+	// used during serialization phase, no-one else touches these, interleaved tables
+	// have no key vector
 	uint32_t serialize_hash;
 	uint32_t serialize_keys;
 } pointless_create_set_t;
@@ -287,7 +409,8 @@ typedef struct {
 	pointless_dynarray_t keys;
 	pointless_dynarray_t values;
 
-	// used during serialization phase, no-one else touches these
+	// used during serialization phase, no-one else touches these, interleaved tables
+	// have no key/value vectors
 	uint32_t serialize_hash;
 	uint32_t serialize_keys;
 	uint32_t serialize_values;
@@ -321,16 +444,39 @@ typedef struct {
 	// bitvector-create-id -> bitvector buffer (void*)
 	pointless_dynarray_t bitvector_values;
 
-	// string/unicode value -> unicode reference
-	Pvoid_t string_unicode_map_judy;
-	uint32_t string_unicode_map_judy_count;
+	// owns the string/unicode and bitvector buffers
+	pointless_arena_t arena;
 
-	// bitvector value -> bitvector reference
-	Pvoid_t bitvector_map_judy;
-	uint32_t bitvector_map_judy_count;
+	// string/unicode buffer -> string/unicode handle
+	pointless_bytes_table_t string_unicode_map;
+	uint32_t string_unicode_count;
 
-	// file format version
+	// bitvector buffer -> bitvector handle
+	pointless_bytes_table_t bitvector_map;
+	uint32_t bitvector_count;
+
+	// header version, and the POINTLESS_FF_FEATURE_* bits it implies or holds
 	uint32_t version;
+	uint32_t features;
+
+	// POINTLESS_HASH_TABLE_LAYOUT_*, for all sets/maps
+	uint32_t hash_table_layout;
+
+	// set once a container is given a child container which is not newer than itself, until then the values can not have cycles
+	uint32_t may_have_cycles;
+
+	// the caller guarantees that there are no cycles, see pointless_create_begin_acyclic()
+	uint32_t is_acyclic;
+
+	// number of threads the hash tables are built on, see pointless_create_begin_parallel()
+	uint32_t n_threads;
+
+	// if set, string/unicode and bitvector buffers live here instead of the arena, see pointless_create_begin_spill()
+	pointless_spill_t* spill;
+
+	// if set, the arrays and tables above move to memory mapped files once they grow past a threshold,
+	// see pointless_create_begin_file_backing()
+	pointless_dynarray_backing_t* backing;
 } pointless_create_t;
 
 // create-time utility macros
@@ -354,6 +500,9 @@ typedef struct {
 #define cv_unicode_at(v) (*((void**)&pointless_dynarray_ITEM_AT(void*, &c->string_unicode_values, cv_value_data_u32(v))))
 #define cv_string_at(v) (*((void**)&pointless_dynarray_ITEM_AT(void*, &c->string_unicode_values, cv_value_data_u32(v))))
 
+#define c_hash_table_layout() (c->hash_table_layout)
+#define c_is_split() (c_hash_table_layout() == POINTLESS_HASH_TABLE_LAYOUT_SPLIT)
+
 #define cv_get_priv_vector(cv) (&pointless_dynarray_ITEM_AT(pointless_create_vector_priv_t, &c->priv_vector_values, (cv)->data.data_u32))
 #define cv_get_outside_vector(cv) (&pointless_dynarray_ITEM_AT(pointless_create_vector_outside_t, &c->outside_vector_values, (cv)->data.data_u32))
 #define cv_get_set(cv) (&pointless_dynarray_ITEM_AT(pointless_create_set_t, &c->set_values, (cv)->data.data_u32))
@@ -385,6 +534,17 @@ uint32_t pointless_hash_unicode_ucs2_v1_32(uint16_t* s);
 uint32_t pointless_hash_string_v1_32(uint8_t* s);
 uint32_t pointless_hash_string_v1_32_(uint8_t* s, size_t n);
 
+uint32_t pointless_hash_unicode_ucs4_v2_32(uint32_t* s, size_t n);
+uint32_t pointless_hash_unicode_ucs2_v2_32(uint16_t* s, size_t n);
+uint32_t pointless_hash_string_v2_32(uint8_t* s, size_t n);
+uint32_t pointless_hash_unicode_utf8_v2_32(uint8_t* s, size_t n_bytes);
+
+// hash of the n code points in s, with the string hash of the given POINTLESS_FF_FEATURE_* bits
+uint32_t pointless_hash_unicode_ucs4_32(uint32_t features, uint32_t* s, size_t n);
+uint32_t pointless_hash_unicode_ucs2_32(uint32_t features, uint16_t* s, size_t n);
+uint32_t pointless_hash_string_32(uint32_t features, uint8_t* s, size_t n);
+uint32_t pointless_hash_unicode_utf8_32(uint32_t features, uint8_t* s, size_t n_bytes);
+
 uint32_t pointless_hash_float_32(float f);
 uint32_t pointless_hash_i32_32(int32_t i);
 uint32_t pointless_hash_u32_32(uint32_t i);
@@ -397,6 +557,18 @@ uint32_t pointless_hash_reader_32(pointless_t* p, pointless_value_t* v);
 uint32_t pointless_hash_reader_vector_32(pointless_t* p, pointless_value_t* v, uint32_t i, uint32_t n);
 uint32_t pointless_hash_create_32(pointless_create_t* c, pointless_create_value_t* v);
 
+// hash of string/unicode or uncompressed bitvector v, computed from its create-time buffer
+uint32_t pointless_hash_create_buffer_32(pointless_create_t* c, pointless_create_value_t* v, void* buffer);
+
+// true iff v has a hash stored in the file, which is then put in *hash
+int pointless_hash_reader_stored_32(pointless_t* p, pointless_value_t* v, uint32_t* hash);
+
+// true iff values of both files hash the same, so their hashes can be compared
+int pointless_hash_reader_compatible(pointless_t* p_a, pointless_t* p_b);
+
+// hash of v computed from its contents, ignoring its own stored hash, but not those of its children
+uint32_t pointless_hash_reader_computed_32(pointless_t* p, pointless_value_t* v);
+
 // comparison functions
 int32_t pointless_cmp_string_8_8(uint8_t* a, uint8_t* b);
 int32_t pointless_cmp_string_8_16(uint8_t* a, uint16_t* b);
@@ -411,10 +583,20 @@ int32_t pointless_cmp_string_32_32(uint32_t* a, uint32_t* b);
 int32_t pointless_cmp_string_8_8_n(uint8_t* a, uint8_t* b, size_t n_b);
 int32_t pointless_cmp_string_32_8_n(uint32_t* a, uint8_t* b, size_t n_b);
 
+int32_t pointless_cmp_string_utf8_8(uint8_t* a, uint8_t* b);
+int32_t pointless_cmp_string_utf8_16(uint8_t* a, uint16_t* b);
+int32_t pointless_cmp_string_utf8_32(uint8_t* a, uint32_t* b);
+int32_t pointless_cmp_string_utf8_utf8(uint8_t* a, uint8_t* b);
+int32_t pointless_cmp_string_utf8_8_n(uint8_t* a, uint8_t* b, size_t n_b);
+
 int32_t pointless_cmp_reader(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b, const char** error);
 int32_t pointless_cmp_reader_acyclic(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b);
 int32_t pointless_cmp_create(pointless_create_t* c, uint32_t a, uint32_t b, const char** error);
 
+// equality, where values with different stored hashes are rejected without comparing them
+int32_t pointless_eq_reader(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b, const char** error);
+int32_t pointless_eq_reader_acyclic(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b);
+
 // equality test callback
 typedef uint32_t (*pointless_eq_cb)(pointless_t* p, pointless_complete_value_t* v, void* user, const char** error);
 
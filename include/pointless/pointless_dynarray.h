@@ -15,11 +15,24 @@
 #include <pointless/pointless_malloc.h>
 #include <pointless/pointless_int_ops.h>
 
+// arrays which opt into a backing move to a memory mapped temporary file once they grow past threshold bytes,
+// so the kernel can page them out, the file is made in dir, or in $TMPDIR or /tmp if dir is 0
+typedef struct {
+	const char* dir;
+	size_t threshold;
+} pointless_dynarray_backing_t;
+
 typedef struct {
 	void* _data;
 	size_t n_items;
 	size_t n_alloc;
 	size_t item_size;
+
+	// _data is on the heap until is_mapped is set, fd is then the descriptor of the mapped file,
+	// so an array which is all zeroes is a valid empty one
+	const pointless_dynarray_backing_t* backing;
+	int is_mapped;
+	int fd;
 } pointless_dynarray_t;
 
 #define pointless_dynarray_ITEM_AT(T, A, I) ((T*)(A)->_data)[I]
@@ -37,4 +50,13 @@ void* pointless_dynarray_buffer(pointless_dynarray_t* a);
 void pointless_dynarray_swap(pointless_dynarray_t* a, size_t i, size_t j);
 void pointless_dynarray_give_data(pointless_dynarray_t* a, void* data, size_t n_items);
 
+// the backing must outlive the array, it may be set at any time, and takes effect when the array next grows
+void pointless_dynarray_set_backing(pointless_dynarray_t* a, const pointless_dynarray_backing_t* backing);
+
+// grows the array to n_items, the new items are zeroed, and no room for more items is allocated
+int pointless_dynarray_resize(pointless_dynarray_t* a, size_t n_items);
+
+// descriptor of a new, already unlinked file in dir, or in $TMPDIR or /tmp if dir is 0, -1 on failure
+int pointless_dynarray_temp_file(const char* dir);
+
 #endif
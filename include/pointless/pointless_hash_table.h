@@ -11,22 +11,52 @@
 
 #include <pointless/pointless_defs.h>
 #include <pointless/pointless_value.h>
+#include <pointless/pointless_mphf.h>
 
 #define POINTLESS_HASH_TABLE_PROBE_MISS UINT32_MAX
 #define POINTLESS_HASH_TABLE_PROBE_ERROR (UINT32_MAX-1)
 
+// with a minimal perfect hash table, i is the next candidate bucket, and once past the primary bucket,
+// mask is one past the last overflow bucket with a matching hash
 typedef struct {
 	uint32_t perturb;
 	uint32_t i;
 	uint32_t mask;
 } pointless_hash_iter_state_t;
 
+// buckets of a set/map as stored in the file, either in separate hash/key/value vectors, or interleaved
+// into one record per bucket. strides are in bytes, values is 0 for sets. minimal perfect hash tables have
+// no empty buckets, the first n_primary are placed by the pilots, the rest share their hash with one of those
+typedef struct {
+	uint32_t layout;
+	uint32_t n_buckets;
+	uint32_t hash_stride;
+	uint32_t kv_stride;
+	uint32_t* hashes;
+	pointless_value_t* keys;
+	pointless_value_t* values;
+	uint32_t n_primary;
+	uint32_t n_pilots;
+	uint32_t* pilots;
+} pointless_hash_table_t;
+
+#define PHT_HASH(t, i) (*(uint32_t*)((char*)(t)->hashes + (size_t)(i) * (t)->hash_stride))
+#define PHT_KEY(t, i) ((pointless_value_t*)((char*)(t)->keys + (size_t)(i) * (t)->kv_stride))
+#define PHT_VALUE(t, i) ((pointless_value_t*)((char*)(t)->values + (size_t)(i) * (t)->kv_stride))
+
+void pointless_hash_table_init(pointless_hash_table_t* t, uint32_t layout, uint32_t is_map, uint32_t* hashes, uint32_t n_hashes, pointless_value_t* keys, pointless_value_t* values);
+
 uint32_t pointless_hash_compute_n_buckets(uint32_t n_items);
-uint32_t pointless_hash_table_probe(pointless_t* p, uint32_t value_hash, pointless_value_t* value, uint32_t n_buckets, uint32_t* hash_vector, pointless_value_t* key_vector, const char** error);
-uint32_t pointless_hash_table_probe_ext(pointless_t* p, uint32_t value_hash, pointless_eq_cb cb, void* user, uint32_t n_buckets, uint32_t* hash_vector, pointless_value_t* key_vector, const char** error);
+uint32_t pointless_hash_table_probe(pointless_t* p, uint32_t value_hash, pointless_value_t* value, pointless_hash_table_t* t, const char** error);
+uint32_t pointless_hash_table_probe_ext(pointless_t* p, uint32_t value_hash, pointless_eq_cb cb, void* user, pointless_hash_table_t* t, const char** error);
+// probes for n values at once, interleaving up to POINTLESS_HASH_TABLE_BATCH_WIDTH probes so that their cache
+// misses overlap. values are compared either to values[i], or through cb with users[i]. buckets[i] is set to the
+// bucket of value i, or POINTLESS_HASH_TABLE_PROBE_MISS
+#define POINTLESS_HASH_TABLE_BATCH_WIDTH 16
+int pointless_hash_table_probe_batch(pointless_t* p, uint32_t n, uint32_t* value_hashes, pointless_value_t* values, pointless_eq_cb cb, void** users, pointless_hash_table_t* t, uint32_t* buckets, const char** error);
 int pointless_hash_table_populate(pointless_create_t* c, uint32_t* hash_vector, uint32_t* keys_vector, uint32_t* values_vector, uint32_t n_keys, uint32_t* hash_serialize, uint32_t* keys_serialize, uint32_t* values_serialize, uint32_t n_buckets, uint32_t empty_slot_handle, const char** error);
 
-void pointless_hash_table_probe_hash_init(pointless_t* p, uint32_t value_hash, uint32_t n_buckets, pointless_hash_iter_state_t* state);
-uint32_t pointless_hash_table_probe_hash(pointless_t* p, uint32_t* hash_vector, pointless_value_t* key_vector, pointless_hash_iter_state_t* state, uint32_t* bucket_out);
+void pointless_hash_table_probe_hash_init(pointless_t* p, uint32_t value_hash, pointless_hash_table_t* t, pointless_hash_iter_state_t* state);
+uint32_t pointless_hash_table_probe_hash(pointless_t* p, pointless_hash_table_t* t, pointless_hash_iter_state_t* state, uint32_t* bucket_out);
 
 #endif
@@ -0,0 +1,30 @@
+#ifndef __POINTLESS__MPHF__H__
+#define __POINTLESS__MPHF__H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __cplusplus
+#include <limits.h>
+#include <stdint.h>
+#else
+#include <climits>
+#include <cstdint>
+#endif
+
+#include <pointless/bitutils.h>
+#include <pointless/pointless_malloc.h>
+
+// minimal perfect hash over distinct 32-bit hashes, in the hash-and-displace style of CHD/PTHash: hashes are
+// spread over n_pilots buckets, and each bucket stores the first pilot which sends all of its hashes to free slots
+uint32_t pointless_mphf_n_pilots(uint32_t n_keys);
+uint32_t pointless_mphf_slot(uint32_t* pilots, uint32_t n_pilots, uint32_t n_keys, uint32_t hash);
+
+// the two halves of pointless_mphf_slot(), for callers which prefetch the pilot in between
+uint32_t pointless_mphf_bucket(uint32_t hash, uint32_t n_pilots);
+uint32_t pointless_mphf_position(uint32_t hash, uint32_t pilot, uint32_t n_keys);
+
+// finds pilots[n_pilots] for the given hashes, and sets slots[i] to the slot of hashes[i]
+int pointless_mphf_build(uint32_t* hashes, uint32_t n_keys, uint32_t* pilots, uint32_t* slots, const char** error);
+
+#endif
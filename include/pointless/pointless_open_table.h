@@ -0,0 +1,83 @@
+#ifndef __POINTLESS__OPEN__TABLE__H__
+#define __POINTLESS__OPEN__TABLE__H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __cplusplus
+#include <limits.h>
+#include <stdint.h>
+#else
+#include <climits>
+#include <cstdint>
+#endif
+
+#include <pointless/pointless_malloc.h>
+#include <pointless/pointless_dynarray.h>
+
+// open-addressing tables with linear probing, from a key to a uint32 value, kept at most half full, the entries
+// are a dynarray, so a table can be given a file backing with pointless_dynarray_set_backing(&t->entries, ...)
+
+// returned by the lookup functions for keys which are not in the table
+#define POINTLESS_OPEN_TABLE_MISSING UINT32_MAX
+
+// byte strings, e.g. length-prefixed string buffers, which are owned by the caller and must outlive the table
+typedef struct {
+	const void* key;
+	size_t n_key;
+	uint32_t hash;
+	uint32_t value;
+} pointless_bytes_table_entry_t;
+
+typedef struct {
+	pointless_dynarray_t entries;
+	size_t n_items;
+} pointless_bytes_table_t;
+
+void pointless_bytes_table_init(pointless_bytes_table_t* t);
+void pointless_bytes_table_destroy(pointless_bytes_table_t* t);
+uint32_t pointless_bytes_table_get(pointless_bytes_table_t* t, const void* key, size_t n_key);
+
+// key must not be in the table, returns 0 if we run out of memory
+int pointless_bytes_table_set(pointless_bytes_table_t* t, const void* key, size_t n_key, uint32_t value);
+
+// non-zero pointers
+typedef struct {
+	const void* key;
+	uint32_t value;
+} pointless_ptr_table_entry_t;
+
+typedef struct {
+	pointless_dynarray_t entries;
+	size_t n_items;
+} pointless_ptr_table_t;
+
+void pointless_ptr_table_init(pointless_ptr_table_t* t);
+void pointless_ptr_table_destroy(pointless_ptr_table_t* t);
+uint32_t pointless_ptr_table_get(pointless_ptr_table_t* t, const void* key);
+
+// replaces the value of a key which is already in the table
+int pointless_ptr_table_set(pointless_ptr_table_t* t, const void* key, uint32_t value);
+
+// keys which are kept by the caller, e.g. on disk, the table only has their hashes, and asks the caller to compare
+typedef struct {
+	uint32_t hash;
+	uint32_t value;
+} pointless_ref_table_entry_t;
+
+typedef struct {
+	pointless_dynarray_t entries;
+	size_t n_items;
+} pointless_ref_table_t;
+
+// non-zero iff value is the key being looked up
+typedef int (*pointless_ref_table_eq_cb)(uint32_t value, void* user);
+
+void pointless_ref_table_init(pointless_ref_table_t* t);
+void pointless_ref_table_destroy(pointless_ref_table_t* t);
+uint32_t pointless_ref_table_get(pointless_ref_table_t* t, uint32_t hash, pointless_ref_table_eq_cb eq, void* user);
+
+// key must not be in the table, value must not be POINTLESS_OPEN_TABLE_MISSING, returns 0 if we run out of memory
+int pointless_ref_table_set(pointless_ref_table_t* t, uint32_t hash, uint32_t value);
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef __POINTLESS__PARALLEL__H__
+#define __POINTLESS__PARALLEL__H__
+
+#include <pthread.h>
+#include <unistd.h>
+
+#ifndef __cplusplus
+#include <limits.h>
+#include <stdint.h>
+#else
+#include <climits>
+#include <cstdint>
+#endif
+
+#include <pointless/pointless_malloc.h>
+
+// upper bound on the threads of one pointless_parallel_for() call
+#define POINTLESS_PARALLEL_MAX_THREADS 1024
+
+// runs cb for items [0, n_items) on n_threads threads, the calling thread being one of them, and stops handing
+// out items at the first failure, whose error is returned. threads which can not be started are done without.
+// n_threads is clamped to the number of chunks of items, the number of online processors and POINTLESS_PARALLEL_MAX_THREADS.
+typedef int32_t (*pointless_parallel_item_cb)(uint32_t i, void* user, const char** error);
+int32_t pointless_parallel_for(uint32_t n_items, uint32_t n_threads, pointless_parallel_item_cb cb, void* user, const char** error);
+
+#endif
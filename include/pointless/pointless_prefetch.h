@@ -0,0 +1,28 @@
+#ifndef __POINTLESS__PREFETCH__H__
+#define __POINTLESS__PREFETCH__H__
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <pointless/bitutils.h>
+#include <pointless/pointless_defs.h>
+#include <pointless/pointless_reader_utils.h>
+#include <pointless/pointless_validate.h>
+#include <pointless/pointless_walk.h>
+
+// run the walk on a background thread, which pointless_close() waits for
+#define POINTLESS_PREFETCH_ASYNC 1
+
+// issue madvise(MADV_WILLNEED) for the heap data of v and everything below it, up to max_depth levels
+// down (set/map hash, key and value vectors count as one level). this is a no-op for buffers, which
+// are already in memory. it may be called from several threads at once, also for files opened in lazy
+// mode, where the walk validates what it touches.
+int32_t pointless_prefetch(pointless_t* p, pointless_value_t* v, uint32_t max_depth, uint32_t flags, const char** error);
+
+// stop and wait for all background prefetches, only once no other thread calls pointless_prefetch()
+void pointless_prefetch_join(pointless_t* p);
+
+#endif
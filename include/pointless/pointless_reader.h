@@ -15,6 +15,7 @@
 
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 #include <pointless/bitutils.h>
 #include <pointless/pointless_defs.h>
@@ -24,15 +25,60 @@
 #include <pointless/pointless_hash_table.h>
 #include <pointless/pointless_validate.h>
 #include <pointless/pointless_reader_utils.h>
+#include <pointless/pointless_prefetch.h>
+
+// how a file is brought into memory, and how it is validated
+#define POINTLESS_ADVICE_NORMAL 0
+#define POINTLESS_ADVICE_WILLNEED 1
+#define POINTLESS_ADVICE_RANDOM 2
+#define POINTLESS_ADVICE_SEQUENTIAL 3
+
+typedef struct {
+	int validate_mode;          // POINTLESS_VALIDATE_*
+	uint32_t validate_threads;
+	uint32_t populate;          // fault in the whole mapping at open time, MAP_POPULATE
+	uint32_t advice;            // POINTLESS_ADVICE_*, passed on to madvise()
+	uint32_t lock;              // mlock() the mapping, subject to RLIMIT_MEMLOCK
+	uint32_t hugepage_load;     // read into anonymous memory backed by transparent huge pages instead of mapping the file
+} pointless_open_options_t;
+
+// full validation, no residency hints
+void pointless_open_options_init(pointless_open_options_t* options);
 
 int pointless_open_f(pointless_t* p, const char* fname, const char** error);
 int pointless_open_b(pointless_t* p, const void* buffer, size_t n_buffer, const char** error);
 
+// full validation, with the string and hash table checks spread over n_threads threads
+int pointless_open_f_parallel_validate(pointless_t* p, const char* fname, uint32_t n_threads, const char** error);
+int pointless_open_b_parallel_validate(pointless_t* p, const void* buffer, size_t n_buffer, uint32_t n_threads, const char** error);
+
+// full validation on first open, after which a sidecar certificate lets later opens skip it, see pointless_validate.h
+int pointless_open_f_certified_validate(pointless_t* p, const char* fname, uint32_t n_threads, const char** error);
+
 // use these two with care. they don't perform any validation on the underlying data, which may cause
 // segfaults when accessed through the normal pointless-library functions
 int pointless_open_f_skip_validate(pointless_t* p, const char* fname, const char** error);
 int pointless_open_b_skip_validate(pointless_t* p, const void* buffer, size_t n_buffer, const char** error);
 
+// only the header and offset vector sizes are checked when opening, containers are validated on first
+// touch, so callers must call pointless_validate_lazy() on any value before passing it to other functions.
+// readers on several threads may share one such pointless_t, containers are only marked as validated once
+// they are, with atomic updates, so at worst a container is validated more than once
+int pointless_open_f_lazy_validate(pointless_t* p, const char* fname, const char** error);
+int pointless_open_b_lazy_validate(pointless_t* p, const void* buffer, size_t n_buffer, const char** error);
+
+// no copy is made, the caller must keep the buffer alive and unmodified until pointless_close(), validate_mode
+// is one of the POINTLESS_VALIDATE_* modes, except POINTLESS_VALIDATE_CERTIFIED
+int pointless_open_b_borrow(pointless_t* p, const void* buffer, size_t n_buffer, int validate_mode, uint32_t n_threads, const char** error);
+
+// maps [offset, offset + length) of an open file, e.g. one of many files packed together. offset must be 8-byte
+// aligned, a length of 0 means up to the end of the file. the file descriptor is not owned, and may be closed
+// as soon as this returns. validate_mode is as for pointless_open_b_borrow()
+int pointless_open_fd(pointless_t* p, int fd, uint64_t offset, uint64_t length, int validate_mode, uint32_t n_threads, const char** error);
+
+int pointless_open_f_options(pointless_t* p, const char* fname, pointless_open_options_t* options, const char** error);
+int pointless_open_fd_options(pointless_t* p, int fd, uint64_t offset, uint64_t length, pointless_open_options_t* options, const char** error);
+
 void pointless_close(pointless_t* p);
 
 #endif
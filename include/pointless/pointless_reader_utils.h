@@ -11,6 +11,10 @@ pointless_value_t* pointless_root(pointless_t* p);
 uint32_t pointless_reader_unicode_len(pointless_t* p, pointless_value_t* v);
 uint32_t* pointless_reader_unicode_value_ucs4(pointless_t* p, pointless_value_t* v);
 
+// POINTLESS_UNICODE_UTF8 values, the length is in bytes
+uint32_t pointless_reader_unicode_utf8_len(pointless_t* p, pointless_value_t* v);
+uint8_t* pointless_reader_unicode_value_utf8(pointless_t* p, pointless_value_t* v);
+
 uint32_t pointless_reader_string_len(pointless_t* p, pointless_value_t* v);
 uint8_t* pointless_reader_string_value_ascii(pointless_t* p, pointless_value_t* v);
 
@@ -43,8 +47,18 @@ uint32_t pointless_reader_set_iter(pointless_t* p, pointless_value_t* s, pointle
 void pointless_reader_set_lookup(pointless_t* p, pointless_value_t* s, pointless_value_t* k, pointless_value_t** kk, const char** error);
 void pointless_reader_set_lookup_ext(pointless_t* p, pointless_value_t* s, uint32_t hash, pointless_eq_cb cb, void* user, pointless_value_t** kk, const char** error);
 
+// batched versions of the above, for n independent keys, results go into kk[0..n) and vv[0..n)
+void pointless_reader_set_lookup_batch(pointless_t* p, pointless_value_t* s, pointless_value_t* keys, uint32_t n, pointless_value_t** kk, const char** error);
+void pointless_reader_set_lookup_batch_ext(pointless_t* p, pointless_value_t* s, uint32_t* hashes, pointless_eq_cb cb, void** users, uint32_t n, pointless_value_t** kk, const char** error);
+
 pointless_value_t* pointless_set_hash_vector(pointless_t* p, pointless_value_t* s);
 pointless_value_t* pointless_set_key_vector(pointless_t* p, pointless_value_t* s);
+void pointless_set_hash_table(pointless_t* p, pointless_value_t* s, pointless_hash_table_t* t);
+
+// direct children of a set, the hash vector followed by the key vector, or by each bucket key in
+// an interleaved table
+uint32_t pointless_set_n_children(pointless_t* p, pointless_value_t* s);
+pointless_value_t* pointless_set_child_at(pointless_t* p, pointless_value_t* s, uint32_t i);
 
 // maps
 uint32_t pointless_reader_map_n_items(pointless_t* p, pointless_value_t* m);
@@ -52,10 +66,17 @@ uint32_t pointless_reader_map_n_buckets(pointless_t* p, pointless_value_t* m);
 uint32_t pointless_reader_map_iter(pointless_t* p, pointless_value_t* m, pointless_value_t** k, pointless_value_t** vv, uint32_t* iter_state);
 void pointless_reader_map_lookup(pointless_t* p, pointless_value_t* m, pointless_value_t* k, pointless_value_t** kk, pointless_value_t** vv, const char** error);
 void pointless_reader_map_lookup_ext(pointless_t* p, pointless_value_t* m, uint32_t hash, pointless_eq_cb cb, void* user, pointless_value_t** kk, pointless_value_t** vv, const char** error);
+void pointless_reader_map_lookup_batch(pointless_t* p, pointless_value_t* m, pointless_value_t* keys, uint32_t n, pointless_value_t** kk, pointless_value_t** vv, const char** error);
+void pointless_reader_map_lookup_batch_ext(pointless_t* p, pointless_value_t* m, uint32_t* hashes, pointless_eq_cb cb, void** users, uint32_t n, pointless_value_t** kk, pointless_value_t** vv, const char** error);
 
 pointless_value_t* pointless_map_hash_vector(pointless_t* p, pointless_value_t* m);
 pointless_value_t* pointless_map_key_vector(pointless_t* p, pointless_value_t* m);
 pointless_value_t* pointless_map_value_vector(pointless_t* p, pointless_value_t* m);
+void pointless_map_hash_table(pointless_t* p, pointless_value_t* m, pointless_hash_table_t* t);
+
+// same as for sets, with each key followed by its value in an interleaved table
+uint32_t pointless_map_n_children(pointless_t* p, pointless_value_t* m);
+pointless_value_t* pointless_map_child_at(pointless_t* p, pointless_value_t* m, uint32_t i);
 
 // map/set conditional iterators
 void pointless_reader_map_iter_hash_init(pointless_t* p, pointless_value_t* m, uint32_t hash, pointless_hash_iter_state_t* iter_state);
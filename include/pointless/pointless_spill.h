@@ -0,0 +1,83 @@
+#ifndef __POINTLESS__SPILL__H__
+#define __POINTLESS__SPILL__H__
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifndef __cplusplus
+#include <limits.h>
+#include <stdint.h>
+#else
+#include <climits>
+#include <cstdint>
+#endif
+
+#include <pointless/pointless_malloc.h>
+#include <pointless/pointless_dynarray.h>
+#include <pointless/pointless_open_table.h>
+
+// create-time string/unicode and bitvector buffers, written to an unlinked temporary file as soon as they are created,
+// only their entries stay in memory, and the buffers are read back when they are compared or serialized
+
+#define POINTLESS_SPILL_STRING_UNICODE 0
+#define POINTLESS_SPILL_BITVECTOR 1
+#define POINTLESS_SPILL_N_KINDS 2
+
+typedef struct {
+	// where the create-time buffer is in the file, and its size
+	uint64_t offset;
+	uint64_t n_bytes;
+
+	// size on the heap, without alignment, and pointless_hash_create_32() of the value
+	uint64_t n_heap;
+	uint32_t hash;
+
+	// value handle, returned for duplicates
+	uint32_t handle;
+} pointless_spill_entry_t;
+
+typedef struct {
+	int fd;
+
+	// bytes in the file, followed by the ones still in the write buffer
+	uint64_t n_file;
+	char* buffer;
+	size_t n_buffer;
+
+	// entries in creation order, and buffer -> entry index for deduplication, per kind
+	pointless_dynarray_t entries[POINTLESS_SPILL_N_KINDS];
+	pointless_ref_table_t maps[POINTLESS_SPILL_N_KINDS];
+} pointless_spill_t;
+
+#define pointless_spill_entry_at(s, kind, i) (&pointless_dynarray_ITEM_AT(pointless_spill_entry_t, &(s)->entries[kind], i))
+
+// creates the file in dir, or in $TMPDIR or /tmp if dir is 0
+int pointless_spill_init(pointless_spill_t* s, const char* dir, const char** error);
+void pointless_spill_destroy(pointless_spill_t* s);
+
+// appends item n_items(entries[kind]) to the file, adding it to the deduplication map if dedup is set, returns 0 on failure
+int pointless_spill_append(pointless_spill_t* s, uint32_t kind, const void* buffer, uint64_t n_bytes, uint64_t n_heap, uint32_t hash, uint32_t handle, int dedup);
+
+// handle of an equal buffer in the deduplication map, or POINTLESS_OPEN_TABLE_MISSING, returns 0 on failure
+int pointless_spill_find(pointless_spill_t* s, uint32_t kind, const void* buffer, uint64_t n_bytes, uint32_t* handle);
+
+// item i, read back into a new buffer, which the caller must pointless_free(), safe to call from many threads while nothing is appended
+void* pointless_spill_get(pointless_spill_t* s, uint32_t kind, uint32_t i, const char** error);
+
+// reads items in file order through a large window, for serialization
+typedef struct {
+	pointless_spill_t* s;
+	char* window;
+	size_t n_window_alloc;
+	uint64_t offset;
+	size_t n_window;
+} pointless_spill_reader_t;
+
+void pointless_spill_reader_init(pointless_spill_reader_t* r, pointless_spill_t* s);
+void pointless_spill_reader_destroy(pointless_spill_reader_t* r);
+
+// item i, valid until the next call
+void* pointless_spill_reader_get(pointless_spill_reader_t* r, uint32_t kind, uint32_t i, const char** error);
+
+#endif
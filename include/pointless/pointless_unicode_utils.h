@@ -43,4 +43,22 @@ uint8_t* pointless_ucs2_to_ascii(uint16_t* ucs2);
 // ascii
 uint32_t* pointless_ascii_to_ucs4(uint8_t* ascii);
 
+// utf-8, with surrogates allowed, and no code points above 0x10FFFF
+int pointless_is_ucs4_utf8(uint32_t* s);
+size_t pointless_ucs4_utf8_len(uint32_t* s);
+uint8_t* pointless_ucs4_to_utf8(uint32_t* ucs4);
+uint32_t* pointless_utf8_to_ucs4(uint8_t* utf8);
+
+// true iff s[0:n] is well formed, in shortest form, and holds no 0 code point
+int pointless_is_utf8(uint8_t* s, size_t n);
+
+// true iff all code points of the well formed s[0:n] fit in 8 bits
+int pointless_is_utf8_ucs1(uint8_t* s, size_t n);
+
+// code points of a well formed, zero terminated utf-8 string
+size_t pointless_utf8_len(uint8_t* s);
+
+// returns the code point at *s, and moves *s past it, the terminating 0 is returned as is
+uint32_t pointless_utf8_next(uint8_t** s);
+
 #endif
@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <stddef.h>
 
 #include <pointless/bitutils.h>
 #include <pointless/pointless_int_ops.h>
@@ -36,6 +37,18 @@ values. The only data type which is not allowed in a cycle is hashable vectors.
 Each hashable value can only recurse down to hashable values.
 
 Checking all this is pretty expensive, and is done after the first set of tests.
+
+With more than one validation thread, string/unicode contents and set/map hash
+tables are checked by a pool of workers, each taking chunks of the offset
+vectors. The walk from the root, depth limits and cycle checks remain serial.
+
+For large files, there is also a lazy mode. At open time, only the header, the
+offset vector sizes and the root are checked. Each string, vector, bitvector,
+set and map is then validated the first time it is touched, through
+pointless_validate_lazy(), and marked as such in a per-container bitmap.
+Hashable vectors, and therefore all set/map keys, are validated along with all
+their children, since hashing them is recursive. Once any container fails
+validation, all further calls fail with the same error.
 */
 
 #include <pointless/pointless_defs.h>
@@ -44,13 +57,46 @@ Checking all this is pretty expensive, and is done after the first set of tests.
 #include <pointless/pointless_unicode_utils.h>
 #include <pointless/pointless_cycle_marker_wrappers.h>
 #include <pointless/pointless_walk.h>
+#include <pointless/pointless_checksum.h>
+#include <pointless/pointless_parallel.h>
 
 typedef struct {
 	pointless_t* p;
+	uint32_t n_threads;
 } pointless_validate_context_t;
 
+// validation modes for pointless_open_*()
+#define POINTLESS_VALIDATE_SKIP 0
+#define POINTLESS_VALIDATE_FULL 1
+#define POINTLESS_VALIDATE_LAZY 2
+#define POINTLESS_VALIDATE_CERTIFIED 3
+
 int32_t pointless_validate(pointless_validate_context_t* context, const char** error);
 
+// runs cb for items [0, n_items) on context->n_threads threads, stopping at the first failure
+typedef int32_t (*pointless_validate_item_cb)(pointless_validate_context_t* context, uint32_t i, void* user, const char** error);
+int32_t pointless_validate_parallel_for(pointless_validate_context_t* context, uint32_t n_items, pointless_validate_item_cb cb, void* user, const char** error);
+
+// full validation, unless a sidecar certificate (fname + ".validated") matches the device, inode, size,
+// mtime and header/offset vector checksum of the open file. a certificate is written after each successful
+// full validation, so anyone able to write next to the file can make it skip validation.
+int32_t pointless_validate_certified(pointless_validate_context_t* context, const char* fname, const char** error);
+
+// lazy validation, init is called at open time, and validate before any heap value is dereferenced
+// pointless_validate_lazy() always succeeds for files not opened in lazy mode
+int32_t pointless_validate_lazy_init(pointless_validate_context_t* context, const char** error);
+int32_t pointless_validate_lazy(pointless_t* p, pointless_value_t* v, const char** error);
+void pointless_validate_lazy_destroy(pointless_t* p);
+
+// section checksums, for files with POINTLESS_FF_FEATURE_CHECKSUM. the trailer and header
+// checksums are checked at open time, everything else only on request: offset vector i in [0, 5), in
+// header order, heap block i in [0, pointless_checksum_n_heap_blocks()), or all of them on n_threads threads
+int32_t pointless_checksum_trailer_init(pointless_t* p, uint64_t buflen, const char** error);
+uint64_t pointless_checksum_n_heap_blocks(pointless_t* p);
+int32_t pointless_checksum_verify_offsets(pointless_t* p, uint32_t i, const char** error);
+int32_t pointless_checksum_verify_heap_block(pointless_t* p, uint64_t i, const char** error);
+int32_t pointless_checksum_verify(pointless_t* p, uint32_t n_threads, const char** error);
+
 // checks if the offset vector reference is good, and that the heap data is valid, without
 // checking the children (if any)
 int32_t pointless_validate_heap_ref(pointless_validate_context_t* context, pointless_value_t* v, const char** error);
@@ -61,7 +107,11 @@ int32_t pointless_validate_inline_invariants(pointless_validate_context_t* conte
 // check heap data
 int32_t pointless_validate_heap_value(pointless_validate_context_t* context, pointless_value_t* v, const char** error);
 
+// checks that the stored hash of a string/unicode or vector, if any, matches its value, vectors
+// of values must have had their children validated
+int32_t pointless_validate_hash_slot(pointless_validate_context_t* context, pointless_value_t* v, const char** error);
+
 // validate hash table invariants
-int32_t pointless_hash_table_validate(pointless_t* p, uint32_t n_items, uint32_t n_buckets, uint32_t* hash_vector, pointless_value_t* key_vector, pointless_value_t* value_vector, const char** error);
+int32_t pointless_hash_table_validate(pointless_t* p, uint32_t n_items, pointless_hash_table_t* t, const char** error);
 
 #endif
@@ -13,5 +13,6 @@ typedef uint32_t (*pointless_walk_cb)(pointless_t* p, pointless_value_t* v, uint
 #define POINTLESS_WALK_STOP 2
 
 void pointless_walk(pointless_t* p, pointless_walk_cb cb, void* user);
+void pointless_walk_from(pointless_t* p, pointless_value_t* v, pointless_walk_cb cb, void* user);
 
 #endif
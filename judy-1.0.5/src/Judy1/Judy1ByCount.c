@@ -0,0 +1 @@
+../JudyCommon/JudyByCount.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyCreateBranch.c
\ No newline at end of file
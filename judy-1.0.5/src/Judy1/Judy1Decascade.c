@@ -0,0 +1 @@
+../JudyCommon/JudyDecascade.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyInsertBranch.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyIns.c
\ No newline at end of file
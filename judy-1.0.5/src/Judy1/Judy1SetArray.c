@@ -0,0 +1 @@
+../JudyCommon/JudyInsArray.c
\ No newline at end of file
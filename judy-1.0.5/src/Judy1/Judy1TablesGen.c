@@ -0,0 +1 @@
+../JudyCommon/JudyTables.c
\ No newline at end of file
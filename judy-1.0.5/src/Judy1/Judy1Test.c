@@ -0,0 +1 @@
+../JudyCommon/JudyGet.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyCascade.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyCount.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyDel.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyFirst.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyFreeArray.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyMallocIF.c
\ No newline at end of file
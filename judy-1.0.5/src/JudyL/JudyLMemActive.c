@@ -0,0 +1 @@
+../JudyCommon/JudyMemActive.c
\ No newline at end of file
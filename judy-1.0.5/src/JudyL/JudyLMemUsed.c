@@ -0,0 +1 @@
+../JudyCommon/JudyMemUsed.c
\ No newline at end of file
@@ -0,0 +1 @@
+../JudyCommon/JudyPrevNext.c
\ No newline at end of file
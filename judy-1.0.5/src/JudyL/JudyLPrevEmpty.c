@@ -0,0 +1 @@
+../JudyCommon/JudyPrevNextEmpty.c
\ No newline at end of file
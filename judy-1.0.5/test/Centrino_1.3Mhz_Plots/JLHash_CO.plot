@@ -1,560 +0,0 @@
-# StringCompare -n13335214 -A JLHash -P40 -L10 -C -M100000 /home/data/domnames.txt
-# This file is in a format to input to 'jbgraph'
-# XLABEL Stored
-# YLABEL Microseconds / Index
-# COLHEAD 1 Total Insert attempts
-# COLHEAD 2 Number Gets
-# COLHEAD 3 Duplicate strings
-# COLHEAD 4 Insert Time (uS)
-# COLHEAD 5 Get Time (uS)
-# COLHEAD 6 Hash Chain Length
-# COLHEAD 7 Average RAM/String
-# Linux localhost 2.6.3-4mdkenterprise #1 SMP Tue Mar 2 07:00:53 CET 2004 i686
-# 32 Bit CPU
-# Processor speed compiled at 1299 Mhz
-# JLHash table virtual size = 4294967296
-# 9999673 (75.0%) non-Word_t aligned string buffers
-# Ram used for input data = 333834600 bytes
-# Average string length = 16.0 bytes
-# 3400000 bytes malloc() for 'cached' strings for Get measurement
-# Access Time    =  0.102 uS average per string (mostly from Cache)
-# HashStr() Time =  0.274 uS average per string (mostly from Cache)
-# Access Time    =  0.285 uS average per string (mostly from RAM)
-# HashStr() Time =  0.474 uS average per string (mostly from RAM)
-# Pass 0
-# TotInserts  DeltaGets  DupStrs InsTime GetTime HChainLen Ram/String
-#          1          1        0  38.004   1.742  1.000000         108.0
-#          2          2        0   8.817   0.905  1.000000          74.0
-#          3          3        0   1.388   0.705  1.000000          60.0
-#          4          4        0   1.583   0.651  1.000000          58.0
-#          5          5        0   1.148   0.616  1.000000          52.8
-#          6          6        0   1.625   0.603  1.000000          52.7
-#          7          7        0   1.283   0.587  1.000000          50.3
-#          8          8        0   1.746   0.575  1.000000          52.0
-#          9          9        0   0.979   0.549  1.000000          48.9
-#         10         10        0   1.119   0.547  1.000000          47.6
-#         11         11        0   1.020   0.528  1.000000          45.8
-#         12         12        0   1.640   0.512  1.000000          46.7
-#         13         13        0   1.132   0.495  1.000000          45.2
-#         14         14        0   1.260   0.745  1.000000          44.3
-#         15         15        0   6.118   0.481  1.000000          42.9
-#         16         16        0   1.931   0.478  1.000000          45.8
-#         17         17        0   1.107   0.473  1.000000          44.5
-#         18         18        0   1.099   0.471  1.000000          44.0
-#         19         19        0   1.057   0.463  1.000000          42.9
-#         20         20        0   1.330   0.462  1.000000          42.2
-#         21         21        0   1.196   0.458  1.000000          41.5
-#         22         22        0   0.962   0.455  1.000000          40.7
-#         23         23        0   1.169   0.459  1.000000          40.5
-#         24         24        0   1.964   0.453  1.000000          42.5
-#         25         25        0   1.238   0.442  1.000000          41.8
-#         26         26        0   1.374   0.439  1.000000          41.1
-#         27         27        0   0.962   0.439  1.000000          40.6
-#         28         28        0   1.043   0.438  1.000000          40.1
-#         29         29        0   1.311   0.430  1.000000          39.6
-#         30         30        0   1.068   0.428  1.000000          38.9
-#         31         31        0   1.206   0.427  1.000000          38.5
-#         32         32        0  24.145   0.517  1.000000          44.2
-#         34         34        0   2.551   0.435  1.000000          43.9
-#         36         36        0   1.243   0.433  1.000000          43.7
-#         38         38        0   1.180   0.432  1.000000          43.3
-#         40         40        0   1.277   0.428  1.000000          42.9
-#         42         42        0   1.069   0.425  1.000000          42.5
-#         44         44        0   0.948   0.419  1.000000          42.0
-#         46         46        0   1.188   0.420  1.000000          41.9
-#         48         48        0   1.519   0.425  1.000000          42.0
-#         50         50        0   1.245   0.424  1.000000          42.2
-#         53         53        0   1.105   0.431  1.000000          42.3
-#         56         56        0   1.429   0.431  1.000000          43.0
-#         59         59        0   1.053   0.436  1.000000          42.6
-#         62         62        0   1.337   0.445  1.000000          43.2
-#         65         65        0   1.169   0.442  1.000000          43.6
-#         69         69        0   1.654   0.441  1.000000          42.8
-#         73         73        0   1.080   0.444  1.000000          42.5
-#         77         77        0   0.877   0.438  1.000000          41.9
-#         81         81        0   1.082   0.438  1.000000          41.8
-#         85         85        0   1.091   0.437  1.000000          41.7
-#         90         90        0   1.002   0.439  1.000000          41.2
-#         95         95        0   1.798   0.438  1.000000          42.1
-#        100        100        0   0.927   0.439  1.000000          41.8
-#        106        106        0   1.140   0.439  1.000000          42.4
-#        112        112        0   1.008   0.443  1.000000          42.5
-#        118        118        0   0.959   0.498  1.000000          42.0
-#        125        125        0   0.897   0.438  1.000000          41.5
-#        132        132        0   0.982   0.438  1.000000          41.1
-#        139        139        0   1.120   0.437  1.000000          41.7
-#        147        147        0   1.073   0.438  1.000000          41.8
-#        155        155        0   1.013   0.439  1.000000          41.8
-#        164        164        0   0.974   0.441  1.000000          41.7
-#        173        173        0   0.877   0.438  1.000000          41.3
-#        183        183        0   1.440   0.440  1.000000          41.7
-#        194        194        0   0.958   0.438  1.000000          41.5
-#        205        205        0   1.000   0.438  1.000000          41.6
-#        217        217        0   0.932   0.439  1.000000          41.4
-#        230        230        0   1.010   0.441  1.000000          41.7
-#        243        243        0   1.037   0.471  1.000000          41.8
-#        257        257        0   1.065   0.448  1.000000          41.7
-#        272        272        0   1.259   0.450  1.000000          41.8
-#        288        288        0   1.060   0.453  1.000000          42.3
-#        305        305        0   0.966   0.453  1.000000          42.0
-#        323        323        0   0.946   0.453  1.000000          41.6
-#        342        342        0   0.969   0.453  1.000000          41.7
-#        362        362        0   1.142   0.457  1.000000          41.5
-#        383        383        0   0.988   0.472  1.000000          41.4
-#        405        405        0   1.023   0.454  1.000000          41.3
-#        429        429        0   1.151   0.457  1.000000          41.4
-#        454        454        0   0.990   0.471  1.000000          41.4
-#        480        480        0   1.004   0.458  1.000000          41.3
-#        508        508        0   1.014   0.463  1.000000          41.4
-#        538        538        0   1.120   0.475  1.000000          41.2
-#        569        569        0   0.997   0.464  1.000000          41.1
-#        602        602        0   1.059   0.478  1.000000          40.9
-#        637        637        0   1.095   0.468  1.000000          40.7
-#        674        674        0   1.048   0.480  1.000000          40.6
-#        714        714        0   1.072   0.470  1.000000          40.4
-#        756        756        0   1.337   0.462  1.000000          40.2
-#        800        800        0   1.015   0.459  1.000000          40.1
-#        847        847        0   1.007   0.454  1.000000          40.0
-#        897        897        0   1.079   0.464  1.000000          39.9
-#        950        950        0   1.017   0.459  1.000000          39.8
-#       1006       1006        0   1.135   0.458  1.000000          39.9
-#       1065       1065        0   1.068   0.465  1.000000          39.9
-#       1128       1128        0   0.997   0.467  1.000000          39.8
-#       1194       1194        0   1.022   0.468  1.000000          39.5
-#       1264       1264        0   1.074   0.465  1.000000          39.5
-#       1339       1339        0   1.122   0.465  1.000000          39.3
-#       1418       1418        0   1.164   0.468  1.000000          39.3
-#       1502       1502        0   1.035   0.473  1.000000          39.2
-#       1591       1591        0   1.042   0.473  1.000000          39.2
-#       1685       1685        0   1.052   0.475  1.000000          39.2
-#       1784       1784        0   1.119   0.476  1.000000          39.2
-#       1884       1884        0   1.058   0.476  1.000000          39.1
-#       1995       1995        0   1.042   0.478  1.000000          39.1
-#       2113       2113        0   2.215   0.482  1.000000          38.9
-#       2239       2239        0   1.072   0.637  1.000000          38.8
-#       2371       2371        0   1.096   0.486  1.000000          38.7
-#       2512       2512        0   1.110   0.486  1.000000          38.8
-#       2661       2661        0   1.097   0.488  1.000000          38.8
-#       2818       2818        0   1.156   0.490  1.000000          38.7
-#       2985       2985        0   1.137   0.493  1.000000          38.7
-#       3162       3162        0   1.143   0.498  1.000000          38.7
-#       3350       3350        0   1.067   0.499  1.000000          38.5
-#       3548       3548        0   1.121   0.500  1.000000          38.5
-#       3758       3758        0   1.161   0.528  1.000000          38.6
-#       3981       3981        0   1.103   0.512  1.000000          38.5
-#       4217       4217        0   1.120   0.515  1.000000          38.5
-#       4467       4467        0   1.116   0.520  1.000000          38.4
-#       4732       4732        0   1.151   0.525  1.000000          38.4
-#       5012       5012        0   1.124   0.527  1.000000          38.3
-#       5309       5309        0   1.165   0.532  1.000000          38.3
-#       5623       5623        0   1.654   0.542  1.000000          38.2
-#       5957       5957        0   1.175   0.542  1.000000          38.2
-#       6310       6310        0   1.221   0.547  1.000000          38.2
-#       6683       6683        0   1.269   0.554  1.000000          38.3
-#       7079       7079        0   1.224   0.553  1.000000          38.3
-#       7499       7499        0   1.267   0.556  1.000000          38.4
-#       7943       7943        0   1.344   0.556  1.000000          38.6
-#       8414       8414        0   1.320   0.606  1.000000          38.8
-#       8913       8913        0   1.485   0.556  1.000000          39.2
-#       9441       9441        0   1.483   0.551  1.000000          39.7
-#      10000      10000        0   1.336   0.549  1.000000          40.0
-#      10593      10593        0   1.374   0.545  1.000000          40.3
-#      11220      11220        0   1.361   0.605  1.000000          40.7
-#      11885      11885        0   1.233   0.552  1.000000          40.8
-#      12589      12589        0   1.201   0.546  1.000000          40.9
-#      13335      13335        0   1.145   0.545  1.000000          40.9
-#      14125      14125        0   1.169   0.594  1.000000          40.8
-#      14962      14962        0   1.152   0.563  1.000000          40.8
-#      15849      15849        0   1.137   0.558  1.000000          40.7
-#      16788      16788        0   1.168   0.622  1.000000          40.7
-#      17783      17783        0   1.159   0.579  1.000000          40.6
-#      18836      18836        0   1.162   0.605  1.000000          40.5
-#      19953      19953        0   1.270   0.582  1.000000          40.5
-#      21135      21135        0   1.153   0.589  1.000000          40.4
-#      22387      22387        0   1.321   0.601  1.000000          40.3
-#      23714      23714        0   1.289   0.602  1.000000          40.3
-#      25119      25119        0   1.256   0.639  1.000000          40.2
-#      26607      26607        0   1.205   0.626  1.000000          40.1
-#      28184      28184        0   1.200   0.625  1.000000          40.1
-#      29854      29854        0   1.203   0.659  1.000000          40.2
-#      31623      31623        0   1.213   0.651  1.000000          40.2
-#      33497      33497        0   1.210   0.654  1.000000          40.4
-#      35481      35481        0   1.208   0.681  1.000000          40.5
-#      37584      37584        0   1.264   0.672  1.000000          40.6
-#      39811      39811        0   1.222   0.693  1.000000          40.7
-#      42170      42170        0   1.224   0.695  1.000000          40.7
-#      44668      44668        0   1.225   0.710  1.000000          40.8
-#      47315      47315        0   1.218   0.702  1.000000          40.8
-#      50119      50119        0   1.231   0.722  1.000000          40.8
-#      53088      53088        0   1.284   0.718  1.000000          40.8
-#      56234      56234        0   1.228   0.729  1.000000          40.8
-#      59566      59566        0   1.228   0.754  1.000000          40.7
-#      63096      63096        0   1.234   0.750  1.000000          40.7
-#      66834      66834        0   1.230   0.745  1.000000          40.6
-#      70795      70795        0   1.236   0.752  1.000000          40.5
-#      74989      74989        0   1.243   0.760  1.000000          40.4
-#      79433      79433        0   1.289   0.762  1.000000          40.3
-#      84140      84140        0   1.291   0.766  1.000000          40.2
-#      89125      89125        0   1.254   0.768  1.000000          40.1
-#      94406      94406        0   1.256   0.767  1.000011          40.0
-#     100000     100000        0   1.255   0.769  1.000010          39.9
-#     105925     100000        0   1.283   0.784  1.000010          39.8
-#     112202     100000        0   1.305   0.787  1.000010          39.7
-#     118850     100000        0   1.256   0.784  1.000010          39.5
-#     125893     100000        0   1.336   0.792  1.000010          39.4
-#     133352     100000        0   1.310   0.798  1.000010          39.3
-#     141254     100000        0   1.292   0.806  1.000000          39.3
-#     149624     100000        0   1.310   0.816  1.000000          39.2
-#     158489     100000        0   1.326   0.823  1.000000          39.1
-#     167880     100000        0   1.379   0.825  1.000010          39.1
-#     177828     100000        0   1.355   0.833  1.000000          39.0
-#     188365     100000        0   1.365   0.838  1.000010          38.9
-#     199526     100000        0   1.398   0.845  1.000030          38.9
-#     211349     100000        0   1.382   0.852  1.000030          38.8
-#     223872     100000        0   1.411   0.853  1.000010          38.8
-#     237137     100000        0   1.471   0.870  1.000030          38.7
-#     251189     100000        0   1.403   0.869  1.000030          38.6
-#     266073     100000        0   1.411   0.873  1.000020          38.6
-#     281838     100000        0   1.417   0.875  1.000050          38.5
-#     298538     100000        0   1.418   0.880  1.000040          38.4
-#     316228     100000        0   1.424   0.892  1.000020          38.3
-#     334965     100000        0   1.423   0.894  1.000040          38.3
-#     354813     100000        0   1.435   0.895  1.000020          38.2
-#     375837     100000        0   1.437   0.904  1.000070          38.1
-#     398107     100000        0   1.419   0.914  1.000070          38.0
-#     421697     100000        0   1.440   0.912  1.000100          37.9
-#     446684     100000        0   1.426   0.954  1.000080          37.8
-#     473151     100000        0   1.434   0.923  1.000080          37.7
-#     501187     100000        0   1.465   0.931  1.000150          37.7
-#     530884     100000        0   1.470   0.937  1.000060          37.6
-#     562341     100000        0   1.469   0.943  1.000100          37.6
-#     595662     100000        0   1.488   0.959  1.000100          37.5
-#     630957     100000        0   1.500   0.956  1.000130          37.5
-#     668344     100000        0   1.484   0.959  1.000070          37.4
-#     707946     100000        0   1.517   0.965  1.000110          37.4
-#     749894     100000        0   1.523   0.971  1.000070          37.3
-#     794328     100000        0   1.533   0.985  1.000130          37.3
-#     841395     100000        0   1.547   0.985  1.000180          37.3
-#     891251     100000        0   1.558   0.991  1.000100          37.2
-#     944061     100000        0   1.552   0.997  1.000130          37.2
-#    1000000     100000        0   1.577   1.004  1.000100          37.2
-#    1059254     100000        0   1.582   1.009  1.000140          37.1
-#    1122018     100000        0   1.588   1.011  1.000070          37.1
-#    1188502     100000        0   1.609   1.019  1.000130          37.1
-#    1258925     100000        0   1.594   1.032  1.000200          37.1
-#    1333521     100000        0   1.615   1.032  1.000130          37.1
-#    1412538     100000        0   1.610   1.036  1.000150          37.1
-#    1496236     100000        0   1.612   1.048  1.000150          37.1
-#    1584893     100000        0   1.627   1.049  1.000190          37.0
-#    1678804     100000        0   1.646   1.056  1.000210          37.0
-#    1778279     100000        0   1.646   1.060  1.000310          36.9
-#    1883649     100000        0   1.667   1.065  1.000230          36.9
-#    1995262     100000        0   1.699   1.069  1.000350          36.9
-#    2113489     100000        0   1.734   1.072  1.000300          37.0
-#    2238721     100000        0   1.790   1.086  1.000240          37.1
-#    2371374     100000        0   1.861   1.088  1.000250          37.4
-#    2511886     100000        0   1.925   1.092  1.000320          37.8
-#    2660725     100000        0   2.046   1.096  1.000320          38.4
-#    2818383     100000        0   1.983   1.109  1.000320          39.0
-#    2985383     100000        0   1.953   1.099  1.000460          39.6
-#    3162278     100000        0   1.883   1.098  1.000430          40.1
-#    3349654     100000        0   1.809   1.104  1.000420          40.4
-#    3548134     100000        0   1.725   1.110  1.000490          40.6
-#    3758374     100000        0   1.691   1.119  1.000330          40.6
-#    3981072     100000        0   1.663   1.132  1.000410          40.6
-#    4216965     100000        0   1.665   1.140  1.000460          40.6
-#    4466836     100000        0   1.672   1.135  1.000550          40.5
-#    4731513     100000        0   1.685   1.157  1.000490          40.5
-#    5011872     100000        0   1.688   1.180  1.000520          40.4
-#    5308844     100000        0   1.702   1.170  1.000580          40.3
-#    5623413     100000        0   1.715   1.181  1.000570          40.2
-#    5956621     100000        0   1.727   1.184  1.000820          40.2
-#    6309573     100000        0   1.734   1.203  1.000690          40.1
-#    6683439     100000        0   1.740   1.198  1.000910          40.0
-#    7079458     100000        0   1.742   1.214  1.000800          40.0
-#    7498942     100000        0   1.755   1.217  1.000750          40.0
-#    7943282     100000        0   1.767   1.223  1.000940          40.0
-#    8413951     100000        0   1.860   1.239  1.000920          40.1
-#    8912509     100000        0   1.795   1.249  1.001020          40.2
-#    9440609     100000        0   1.800   1.257  1.001150          40.3
-#   10000000     100000        0   1.798   1.257  1.000990          40.3
-#   10592537     100000        0   1.783   1.301  1.001150          40.4
-#   11220185     100000        0   1.845   1.295  1.001400          40.4
-#   11885022     100000        0   1.829   1.286  1.001310          40.4
-#   12589254     100000        0  10.482   1.917  1.001420          40.4
-#   13335214     100000        0   5.906   4.791  1.001610          40.3
-# Total Duplicate strings = 0
-# Begin JLHashFreeArray()...
-#                      returned 538058560 bytes
-# Free 13335214 strings, 1.065 uSecs Ave/string
-
-# Pass 1
-# Pass 2
-# Pass 3
-# Pass 4
-# Pass 5
-# Pass 6
-# Pass 7
-# Pass 8
-# Pass 9
-# TotInserts      0     0 InsTime GetTime      0 Ram/String
-           1      0     0   3.635   0.601      0  48.000
-           2      0     0   2.086   0.268      0  40.000
-           3      0     0   0.989   0.349      0  41.333
-           4      0     0   0.952   0.324      0  42.000
-           5      0     0   0.765   0.330      0  39.200
-           6      0     0   1.010   0.354      0  39.333
-           7      0     0   0.748   0.363      0  37.714
-           8      0     0   1.226   0.362      0  41.500
-           9      0     0   0.823   0.364      0  40.889
-          10      0     0   0.774   0.373      0  40.400
-          11      0     0   0.794   0.365      0  40.000
-          12      0     0   1.554   0.366      0  42.333
-          13      0     0   0.743   0.370      0  41.231
-          14      0     0   0.817   0.375      0  40.286
-          15      0     0   0.798   0.384      0  38.933
-          16      0     0   1.259   0.382      0  42.000
-          17      0     0   0.716   0.382      0  41.647
-          18      0     0   0.751   0.380      0  41.333
-          19      0     0   0.785   0.383      0  40.211
-          20      0     0   0.875   0.382      0  39.800
-          21      0     0   0.798   0.380      0  39.619
-          22      0     0   0.875   0.381      0  39.273
-          23      0     0   0.751   0.388      0  39.130
-          24      0     0   1.964   0.388      0  41.167
-          25      0     0   0.880   0.382      0  40.480
-          26      0     0   0.908   0.387      0  39.846
-          27      0     0   0.740   0.389      0  39.556
-          28      0     0   0.842   0.388      0  39.429
-          29      0     0   0.895   0.390      0  39.034
-          30      0     0   0.877   0.387      0  38.800
-          31      0     0   0.781   0.388      0  38.452
-          32      0     0   7.634   0.424      0  43.375
-          34      0     0   0.995   0.398      0  43.294
-          36      0     0   0.886   0.409      0  42.667
-          38      0     0   0.915   0.413      0  42.421
-          40      0     0   0.905   0.416      0  42.200
-          42      0     0   0.895   0.417      0  42.857
-          44      0     0   0.769   0.418      0  42.727
-          46      0     0   0.858   0.416      0  42.435
-          48      0     0   1.019   0.414      0  42.250
-          50      0     0   0.946   0.415      0  41.920
-          53      0     0   0.985   0.413      0  42.340
-          56      0     0   1.024   0.417      0  42.643
-          59      0     0   0.876   0.415      0  42.712
-          62      0     0   0.992   0.412      0  43.097
-          65      0     0   0.931   0.419      0  43.077
-          69      0     0   0.884   0.424      0  42.899
-          73      0     0   0.967   0.422      0  42.685
-          77      0     0   0.831   0.428      0  42.857
-          81      0     0   0.860   0.416      0  42.864
-          85      0     0   0.864   0.416      0  43.529
-          90      0     0   0.866   0.419      0  43.156
-          95      0     0   0.968   0.422      0  42.653
-         100      0     0   0.927   0.425      0  42.160
-         106      0     0   0.997   0.427      0  42.075
-         112      0     0   0.880   0.430      0  42.250
-         118      0     0   0.959   0.429      0  42.373
-         125      0     0   0.897   0.428      0  42.656
-         132      0     0   0.982   0.430      0  42.364
-         139      0     0   0.892   0.430      0  41.899
-         147      0     0   1.004   0.437      0  42.395
-         155      0     0   0.962   0.433      0  42.348
-         164      0     0   0.945   0.436      0  42.146
-         173      0     0   0.877   0.438      0  41.734
-         183      0     0   0.890   0.440      0  41.727
-         194      0     0   0.958   0.438      0  41.794
-         205      0     0   1.000   0.438      0  41.795
-         217      0     0   0.923   0.439      0  41.604
-         230      0     0   0.996   0.441      0  42.070
-         243      0     0   0.991   0.452      0  42.091
-         257      0     0   0.939   0.448      0  41.696
-         272      0     0   0.981   0.450      0  41.559
-         288      0     0   1.022   0.453      0  41.667
-         305      0     0   0.966   0.453      0  41.902
-         323      0     0   0.946   0.453      0  41.895
-         342      0     0   0.969   0.453      0  42.058
-         362      0     0   1.064   0.457      0  42.188
-         383      0     0   0.988   0.464      0  42.057
-         405      0     0   1.023   0.454      0  42.272
-         429      0     0   1.066   0.457      0  42.256
-         454      0     0   0.990   0.468      0  41.947
-         480      0     0   1.004   0.458      0  41.917
-         508      0     0   1.014   0.463      0  41.819
-         538      0     0   1.068   0.471      0  41.465
-         569      0     0   0.997   0.464      0  41.244
-         602      0     0   1.059   0.478      0  41.143
-         637      0     0   1.095   0.468      0  41.017
-         674      0     0   1.048   0.480      0  40.914
-         714      0     0   1.062   0.470      0  40.734
-         756      0     0   1.337   0.462      0  40.439
-         800      0     0   1.015   0.459      0  40.220
-         847      0     0   1.007   0.454      0  40.142
-         897      0     0   1.016   0.464      0  40.143
-         950      0     0   1.017   0.459      0  40.029
-        1006      0     0   1.033   0.458      0  40.016
-        1065      0     0   1.033   0.465      0  39.985
-        1128      0     0   0.997   0.467      0  39.897
-        1194      0     0   1.007   0.467      0  39.863
-        1264      0     0   1.027   0.465      0  39.750
-        1339      0     0   1.022   0.465      0  39.555
-        1418      0     0   1.007   0.468      0  39.368
-        1502      0     0   1.035   0.473      0  39.204
-        1591      0     0   1.023   0.473      0  39.110
-        1685      0     0   1.027   0.475      0  39.119
-        1784      0     0   0.998   0.476      0  39.029
-        1884      0     0   1.028   0.476      0  39.096
-        1995      0     0   1.012   0.478      0  38.983
-        2113      0     0   1.023   0.482      0  39.000
-        2239      0     0   0.998   0.493      0  38.916
-        2371      0     0   1.006   0.486      0  38.962
-        2512      0     0   1.035   0.486      0  38.861
-        2661      0     0   1.027   0.488      0  38.825
-        2818      0     0   1.046   0.490      0  38.755
-        2985      0     0   1.029   0.493      0  38.596
-        3162      0     0   1.063   0.498      0  38.530
-        3350      0     0   1.036   0.499      0  38.427
-        3548      0     0   1.037   0.500      0  38.444
-        3758      0     0   1.068   0.528      0  38.506
-        3981      0     0   1.073   0.512      0  38.551
-        4217      0     0   1.079   0.515      0  38.367
-        4467      0     0   1.072   0.520      0  38.433
-        4732      0     0   1.083   0.525      0  38.343
-        5012      0     0   1.061   0.527      0  38.311
-        5309      0     0   1.085   0.532      0  38.320
-        5623      0     0   1.072   0.542      0  38.251
-        5957      0     0   1.103   0.542      0  38.209
-        6310      0     0   1.142   0.547      0  38.255
-        6683      0     0   1.096   0.554      0  38.122
-        7079      0     0   1.132   0.553      0  38.204
-        7499      0     0   1.208   0.556      0  38.365
-        7943      0     0   1.227   0.556      0  38.610
-        8414      0     0   1.225   0.588      0  38.839
-        8913      0     0   1.310   0.556      0  39.063
-        9441      0     0   1.319   0.551      0  39.620
-       10000      0     0   1.270   0.549      0  40.091
-       10593      0     0   1.271   0.545      0  40.405
-       11220      0     0   1.175   0.570      0  40.668
-       11885      0     0   1.125   0.552      0  40.855
-       12589      0     0   1.080   0.546      0  40.874
-       13335      0     0   1.057   0.545      0  40.788
-       14125      0     0   1.067   0.574      0  40.824
-       14962      0     0   1.061   0.563      0  40.771
-       15849      0     0   1.059   0.558      0  40.713
-       16788      0     0   1.057   0.585      0  40.635
-       17783      0     0   1.070   0.579      0  40.554
-       18836      0     0   1.071   0.598      0  40.488
-       19953      0     0   1.091   0.582      0  40.426
-       21135      0     0   1.099   0.589      0  40.368
-       22387      0     0   1.099   0.601      0  40.336
-       23714      0     0   1.104   0.602      0  40.275
-       25119      0     0   1.113   0.629      0  40.186
-       26607      0     0   1.126   0.626      0  40.160
-       28184      0     0   1.174   0.625      0  40.113
-       29854      0     0   1.152   0.656      0  40.181
-       31623      0     0   1.154   0.651      0  40.274
-       33497      0     0   1.156   0.654      0  40.354
-       35481      0     0   1.154   0.677      0  40.434
-       37584      0     0   1.159   0.672      0  40.553
-       39811      0     0   1.165   0.693      0  40.664
-       42170      0     0   1.164   0.695      0  40.727
-       44668      0     0   1.166   0.710      0  40.820
-       47315      0     0   1.167   0.702      0  40.855
-       50119      0     0   1.167   0.722      0  40.883
-       53088      0     0   1.169   0.718      0  40.892
-       56234      0     0   1.169   0.729      0  40.829
-       59566      0     0   1.169   0.748      0  40.793
-       63096      0     0   1.173   0.750      0  40.721
-       66834      0     0   1.169   0.745      0  40.633
-       70795      0     0   1.173   0.752      0  40.553
-       74989      0     0   1.176   0.760      0  40.462
-       79433      0     0   1.189   0.762      0  40.373
-       84140      0     0   1.187   0.766      0  40.280
-       89125      0     0   1.192   0.768      0  40.185
-       94406      0     0   1.199   0.767      0  40.075
-      100000      0     0   1.201   0.769      0  39.939
-      105925      0     0   1.195   0.784      0  39.811
-      112202      0     0   1.183   0.787      0  39.690
-      118850      0     0   1.192   0.784      0  39.577
-      125893      0     0   1.203   0.792      0  39.473
-      133352      0     0   1.213   0.798      0  39.383
-      141254      0     0   1.226   0.806      0  39.303
-      149624      0     0   1.243   0.816      0  39.233
-      158489      0     0   1.252   0.823      0  39.167
-      167880      0     0   1.267   0.825      0  39.100
-      177828      0     0   1.276   0.833      0  39.041
-      188365      0     0   1.284   0.838      0  38.987
-      199526      0     0   1.293   0.845      0  38.928
-      211349      0     0   1.304   0.852      0  38.867
-      223872      0     0   1.310   0.853      0  38.806
-      237137      0     0   1.320   0.870      0  38.750
-      251189      0     0   1.331   0.869      0  38.690
-      266073      0     0   1.329   0.873      0  38.620
-      281838      0     0   1.338   0.875      0  38.553
-      298538      0     0   1.339   0.880      0  38.477
-      316228      0     0   1.339   0.892      0  38.394
-      334965      0     0   1.349   0.894      0  38.310
-      354813      0     0   1.352   0.895      0  38.220
-      375837      0     0   1.348   0.904      0  38.126
-      398107      0     0   1.350   0.914      0  38.043
-      421697      0     0   1.359   0.912      0  37.948
-      446684      0     0   1.359   0.927      0  37.865
-      473151      0     0   1.372   0.923      0  37.786
-      501187      0     0   1.380   0.931      0  37.707
-      530884      0     0   1.385   0.937      0  37.640
-      562341      0     0   1.391   0.943      0  37.581
-      595662      0     0   1.403   0.953      0  37.533
-      630957      0     0   1.414   0.956      0  37.486
-      668344      0     0   1.427   0.959      0  37.438
-      707946      0     0   1.438   0.965      0  37.398
-      749894      0     0   1.449   0.971      0  37.357
-      794328      0     0   1.462   0.981      0  37.312
-      841395      0     0   1.481   0.985      0  37.273
-      891251      0     0   1.490   0.991      0  37.240
-      944061      0     0   1.509   0.997      0  37.206
-     1000000      0     0   1.522   1.004      0  37.181
-     1059254      0     0   1.532   1.009      0  37.168
-     1122018      0     0   1.538   1.011      0  37.153
-     1188502      0     0   1.544   1.019      0  37.148
-     1258925      0     0   1.555   1.028      0  37.151
-     1333521      0     0   1.557   1.031      0  37.142
-     1412538      0     0   1.566   1.036      0  37.120
-     1496236      0     0   1.571   1.044      0  37.091
-     1584893      0     0   1.582   1.049      0  37.050
-     1678804      0     0   1.591   1.056      0  36.997
-     1778279      0     0   1.597   1.060      0  36.944
-     1883649      0     0   1.628   1.065      0  36.896
-     1995262      0     0   1.667   1.069      0  36.898
-     2113489      0     0   1.697   1.072      0  36.960
-     2238721      0     0   1.750   1.085      0  37.110
-     2371374      0     0   1.819   1.086      0  37.407
-     2511886      0     0   1.867   1.090      0  37.835
-     2660725      0     0   1.901   1.094      0  38.385
-     2818383      0     0   1.905   1.091      0  39.012
-     2985383      0     0   1.867   1.089      0  39.605
-     3162278      0     0   1.805   1.089      0  40.094
-     3349654      0     0   1.727   1.092      0  40.422
-     3548134      0     0   1.657   1.096      0  40.599
-     3758374      0     0   1.610   1.106      0  40.658
-     3981072      0     0   1.588   1.111      0  40.640
-     4216965      0     0   1.578   1.122      0  40.590
-     4466836      0     0   1.587   1.130      0  40.530
-     4731513      0     0   1.595   1.134      0  40.461
-     5011872      0     0   1.607   1.145      0  40.391
-     5308844      0     0   1.625   1.154      0  40.316
-     5623413      0     0   1.642   1.167      0  40.240
-     5956621      0     0   1.652   1.176      0  40.164
-     6309573      0     0   1.669   1.188      0  40.084
-     6683439      0     0   1.710   1.198      0  40.011
-     7079458      0     0   1.711   1.208      0  39.956
-     7498942      0     0   1.719   1.217      0  39.961
-     7943282      0     0   1.727   1.223      0  40.035
-     8413951      0     0   1.727   1.233      0  40.119
-     8912509      0     0   1.726   1.243      0  40.194
-     9440609      0     0   1.737   1.248      0  40.263
-    10000000      0     0   1.723   1.251      0  40.323
-    10592537      0     0   1.718   1.259      0  40.370
-    11220185      0     0   1.715   1.265      0  40.399
-    11885022      0     0   1.710   1.270      0  40.407
-    12589254      0     0   1.704   1.276      0  40.389
-    13335214      0     0   1.697   1.277      0  40.347
@@ -1,563 +0,0 @@
-# StringCompare -n14962357 -A JudyHS -P40 -L10 -C -M100000 /home/data/domnames.txt
-# This file is in a format to input to 'jbgraph'
-# XLABEL Stored
-# YLABEL Microseconds / Index
-# COLHEAD 1 Total Insert attempts
-# COLHEAD 2 Number Gets
-# COLHEAD 3 Duplicate strings
-# COLHEAD 4 Insert Time (uS)
-# COLHEAD 5 Get Time (uS)
-# COLHEAD 6 Hash Chain Length
-# COLHEAD 7 Average RAM/String
-# Linux localhost 2.6.3-4mdkenterprise #1 SMP Tue Mar 2 07:00:53 CET 2004 i686
-# 32 Bit CPU
-# Processor speed compiled at 1299 Mhz
-# 11218731 (75.0%) non-Word_t aligned string buffers
-# Ram used for input data = 372621771 bytes
-# Average string length = 15.9 bytes
-# 3200000 bytes malloc() for 'cached' strings for Get measurement
-# Access Time    =  0.112 uS average per string (mostly from Cache)
-# HashStr() Time =  0.271 uS average per string (mostly from Cache)
-# Access Time    =  0.295 uS average per string (mostly from RAM)
-# HashStr() Time =  0.476 uS average per string (mostly from RAM)
-# Pass 0
-# TotInserts  DeltaGets  DupStrs InsTime GetTime HChainLen Ram/String
-#          1          1        0  30.232   2.608  0.000000          52.0
-#          2          2        0   8.020   0.314  0.000000          44.0
-#          3          3        0   1.616   0.268  0.000000          42.7
-#          4          4        0   1.424   0.267  0.000000          45.0
-#          5          5        0   1.166   0.252  0.000000          41.6
-#          6          6        0   1.122   0.251  0.000000          39.3
-#          7          7        0   1.511   0.256  0.000000          41.1
-#          8          8        0   1.346   0.258  0.000000          39.5
-#          9          9        0   1.476   0.245  0.000000          38.7
-#         10         10        0   1.397   0.252  0.000000          41.2
-#         11         11        0   1.299   0.256  0.000000          40.4
-#         12         12        0   1.287   0.248  0.000000          39.7
-#         13         13        0   0.999   0.256  0.000000          39.1
-#         14         14        0   1.191   0.261  0.000000          38.9
-#         15         15        0   1.197   0.259  0.000000          38.7
-#         16         16        0   7.658   0.264  0.000000          41.0
-#         17         17        0   1.427   0.258  0.000000          40.0
-#         18         18        0   1.255   0.262  0.000000          39.1
-#         19         19        0   1.232   0.263  0.000000          38.7
-#         20         20        0   1.085   0.265  0.000000          38.4
-#         21         21        0   1.185   0.254  0.000000          37.9
-#         22         22        0   1.178   0.259  0.000000          38.0
-#         23         23        0   1.135   0.265  0.000000          37.6
-#         24         24        0   1.072   0.265  0.000000          37.0
-#         25         25        0   1.267   0.264  0.000000          36.6
-#         26         26        0   1.329   0.262  0.000000          36.3
-#         27         27        0   1.260   0.267  0.000000          36.3
-#         28         28        0   1.308   0.499  0.000000          36.1
-#         29         29        0   1.189   0.262  0.000000          36.0
-#         30         30        0   1.219   0.263  0.000000          35.6
-#         31         31        0   1.200   0.270  0.000000          36.1
-#         32         32        0   1.320   0.265  0.000000          35.9
-#         34         34        0   0.967   0.264  0.000000          35.3
-#         36         36        0   1.090   0.266  0.000000          35.1
-#         38         38        0   1.500   0.274  0.000000          36.8
-#         40         40        0   0.915   0.266  0.000000          36.2
-#         42         42        0   1.145   0.268  0.000000          36.0
-#         44         44        0   1.169   0.270  0.000000          36.0
-#         46         46        0   0.990   0.272  0.000000          35.9
-#         48         48        0   0.995   0.271  0.000000          35.5
-#         50         50        0   1.040   0.268  0.000000          35.4
-#         53         53        0   0.925   0.274  0.000000          35.2
-#         56         56        0   1.202   0.270  0.000000          35.1
-#         59         59        0   0.744   0.270  0.000000          34.3
-#         62         62        0   0.926   0.270  0.000000          34.1
-#         65         65        0   0.920   0.267  0.000000          34.0
-#         69         69        0   0.838   0.271  0.000000          33.9
-#         73         73        0   0.921   0.270  0.000000          33.9
-#         77         77        0   0.833   0.270  0.000000          33.8
-#         81         81        0   0.939   0.268  0.000000          33.9
-#         85         85        0   0.811   0.272  0.000000          33.7
-#         90         90        0   0.995   0.272  0.000000          34.2
-#         95         95        0   0.739   0.270  0.000000          33.5
-#        100        100        0   0.883   0.273  0.000000          33.2
-#        106        106        0   0.860   0.270  0.000000          32.6
-#        112        112        0   0.828   0.271  0.000000          32.4
-#        118        118        0   1.276   0.273  0.000000          32.2
-#        125        125        0   0.982   0.278  0.000000          32.4
-#        132        132        0   1.076   0.275  0.000000          32.8
-#        139        139        0   0.839   0.279  0.000000          32.3
-#        147        147        0   0.931   0.277  0.000000          32.6
-#        155        155        0   0.918   0.280  0.000000          32.5
-#        164        164        0   0.929   0.282  0.000000          32.8
-#        173        173        0   0.832   0.281  0.000000          32.6
-#        183        183        0   0.912   0.284  0.000000          32.7
-#        194        194        0   0.903   0.287  0.000000          32.6
-#        205        205        0   0.886   0.286  0.000000          32.5
-#        217        217        0   1.086   0.286  0.000000          32.3
-#        230        230        0   0.886   0.286  0.000000          32.5
-#        243        243        0   0.821   0.287  0.000000          32.5
-#        257        257        0   0.804   0.287  0.000000          32.1
-#        272        272        0   0.876   0.315  0.000000          32.0
-#        288        288        0   0.867   0.289  0.000000          31.8
-#        305        305        0   0.849   0.289  0.000000          31.8
-#        323        323        0   2.211   0.299  0.000000          32.1
-#        342        342        0   1.446   0.301  0.000000          32.8
-#        362        362        0   1.032   0.320  0.000000          33.0
-#        383        383        0   1.079   0.301  0.000000          33.4
-#        405        405        0   0.983   0.304  0.000000          33.4
-#        429        429        0   1.005   0.304  0.000000          33.3
-#        454        454        0   0.850   0.321  0.000000          33.0
-#        480        480        0   1.039   0.306  0.000000          33.4
-#        508        508        0   0.984   0.307  0.000000          33.5
-#        538        538        0   1.059   0.320  0.000000          33.6
-#        569        569        0   0.857   0.307  0.000000          33.5
-#        602        602        0   0.997   0.306  0.000000          33.8
-#        637        637        0   0.935   0.320  0.000000          33.7
-#        674        674        0   0.946   0.307  0.000000          33.7
-#        714        714        0   0.940   0.309  0.000000          33.6
-#        756        756        0   1.174   0.308  0.000000          33.8
-#        800        800        0   0.925   0.307  0.000000          34.0
-#        847        847        0   0.908   0.310  0.000000          33.9
-#        897        897        0   0.931   0.308  0.000000          34.0
-#        950        950        0   0.904   0.310  0.000000          34.0
-#       1006       1006        0   0.891   0.318  0.000000          33.9
-#       1065       1065        0   0.842   0.310  0.000000          33.7
-#       1128       1128        0   0.880   0.318  0.000000          33.6
-#       1194       1194        0   0.875   0.312  0.000000          33.6
-#       1264       1264        0   1.027   0.314  0.000000          33.6
-#       1339       1339        0   0.867   0.314  0.000000          33.5
-#       1418       1418        0   0.857   0.320  0.000000          33.3
-#       1502       1502        0   0.962   0.424  0.000000          33.4
-#       1591       1591        0   0.899   0.324  0.000000          33.5
-#       1685       1685        0   0.935   0.323  0.000000          33.5
-#       1784       1784        0   0.936   0.323  0.000000          33.6
-#       1884       1884        0   0.961   0.324  0.000000          33.8
-#       1995       1995        0   0.894   0.325  0.000000          33.7
-#       2113       2113        0   0.883   0.323  0.000000          33.7
-#       2239       2239        0   0.851   0.324  0.000000          33.6
-#       2371       2371        0   0.901   0.329  0.000000          33.5
-#       2512       2512        0   0.937   0.328  0.000000          33.6
-#       2661       2661        0   1.014   0.423  0.000000          33.7
-#       2818       2818        0   1.001   0.423  0.000000          33.7
-#       2985       2985        0   0.983   0.424  0.000000          33.7
-#       3162       3162        0   1.056   0.431  0.000000          33.8
-#       3350       3350        0   0.995   0.431  0.000000          33.7
-#       3548       3548        0   1.012   0.434  0.000000          33.7
-#       3758       3758        0   0.997   0.435  0.000000          33.7
-#       3981       3981        0   1.122   0.600  0.000000          33.8
-#       4217       4217        0   1.111   0.427  0.000000          33.8
-#       4467       4467        0   1.000   0.423  0.000000          33.8
-#       4732       4732        0   1.023   0.429  0.000000          33.8
-#       5012       5012        0   1.016   0.435  0.000000          33.8
-#       5309       5309        0   1.012   0.491  0.000000          33.8
-#       5623       5623        0   1.489   0.473  0.000000          33.8
-#       5957       5957        0   1.029   0.456  0.000000          33.7
-#       6310       6310        0   1.056   0.456  0.000000          33.6
-#       6683       6683        0   1.093   0.463  0.000000          33.5
-#       7079       7079        0   1.102   0.469  0.000000          33.5
-#       7499       7499        0   1.040   0.472  0.000000          33.3
-#       7943       7943        0   1.069   0.425  0.000000          33.2
-#       8414       8414        0   1.042   0.427  0.000000          33.1
-#       8913       8913        0   1.375   0.433  0.000000          33.0
-#       9441       9441        0   1.063   0.434  0.000000          32.9
-#      10000      10000        0   1.042   0.437  0.000000          32.8
-#      10593      10593        0   1.068   0.499  0.000000          32.7
-#      11220      11220        0   1.071   0.437  0.000000          32.6
-#      11885      11885        0   1.010   0.459  0.000000          32.4
-#      12589      12589        0   1.064   0.444  0.000000          32.3
-#      13335      13335        0   1.042   0.445  0.000000          32.2
-#      14125      14125        0   1.053   0.456  0.000000          32.1
-#      14962      14962        0   1.092   0.448  0.000000          32.0
-#      15849      15849        0   1.049   0.449  0.000000          31.9
-#      16788      16788        0   1.065   0.495  0.000000          31.8
-#      17783      17783        0   1.087   0.478  0.000000          31.7
-#      18836      18836        0   1.064   0.458  0.000000          31.7
-#      19953      19953        0   1.059   0.467  0.000000          31.6
-#      21135      21135        0   1.087   0.469  0.000000          31.5
-#      22387      22387        0   1.091   0.507  0.000000          31.5
-#      23714      23714        0   1.116   0.504  0.000000          31.4
-#      25119      25119        0   1.108   0.483  0.000000          31.4
-#      26607      26607        0   1.093   0.499  0.000000          31.3
-#      28184      28184        0   1.104   0.524  0.000000          31.2
-#      29854      29854        0   1.129   0.517  0.000000          31.2
-#      31623      31623        0   1.115   0.516  0.000000          31.1
-#      33497      33497        0   1.230   0.520  0.000000          31.1
-#      35481      35481        0   1.110   0.544  0.000000          31.0
-#      37584      37584        0   1.147   0.542  0.000000          30.9
-#      39811      39811        0   1.141   0.574  0.000000          30.8
-#      42170      42170        0   1.134   0.552  0.000000          30.8
-#      44668      44668        0   1.232   0.600  0.000000          30.7
-#      47315      47315        0   1.183   0.604  0.000000          30.7
-#      50119      50119        0   1.230   0.601  0.000000          30.7
-#      53088      53088        0   1.216   0.589  0.000000          30.6
-#      56234      56234        0   1.176   0.621  0.000000          30.6
-#      59566      59566        0   1.178   0.601  0.000000          30.5
-#      63096      63096        0   1.183   0.616  0.000000          30.5
-#      66834      66834        0   1.205   0.643  0.000000          30.5
-#      70795      70795        0   1.207   0.644  0.000000          30.5
-#      74989      74989        0   1.214   0.634  0.000000          30.4
-#      79433      79433        0   1.270   0.643  0.000000          30.4
-#      84140      84140        0   1.263   0.652  0.000000          30.4
-#      89125      89125        0   1.269   0.660  0.000000          30.4
-#      94406      94406        0   1.342   0.683  0.000000          30.5
-#     100000     100000        0   1.403   0.699  0.000000          30.7
-#     105925     100000        0   1.350   0.699  0.000000          30.8
-#     112202     100000        0   1.378   0.705  0.000000          31.0
-#     118850     100000        0   1.390   0.700  0.000000          31.2
-#     125893     100000        0   1.405   0.710  0.000000          31.4
-#     133352     100000        0   1.534   0.727  0.000000          31.5
-#     141254     100000        0   1.375   0.730  0.000000          31.7
-#     149624     100000        0   1.378   0.739  0.000000          31.8
-#     158489     100000        0   1.603   0.740  0.000000          31.9
-#     167880     100000        0   1.325   0.751  0.000000          31.9
-#     177828     100000        0   1.322   0.755  0.000000          32.0
-#     188365     100000        0   1.333   0.760  0.000000          32.0
-#     199526     100000        0   1.312   0.760  0.000000          32.1
-#     211349     100000        0   1.326   0.768  0.000000          32.1
-#     223872     100000        0   1.320   0.787  0.000000          32.1
-#     237137     100000        0   1.304   0.778  0.000000          32.1
-#     251189     100000        0   1.368   0.769  0.000000          32.1
-#     266073     100000        0   1.324   0.795  0.000000          32.1
-#     281838     100000        0   1.323   0.800  0.000000          32.1
-#     298538     100000        0   1.336   0.827  0.000000          32.0
-#     316228     100000        0   1.349   0.812  0.000000          32.0
-#     334965     100000        0   1.330   0.816  0.000000          32.0
-#     354813     100000        0   1.330   0.816  0.000000          32.0
-#     375837     100000        0   1.358   0.798  0.000000          32.1
-#     398107     100000        0   1.483   0.827  0.000000          32.1
-#     421697     100000        0   1.354   0.832  0.000000          32.2
-#     446684     100000        0   1.353   0.837  0.000000          32.2
-#     473151     100000        0   1.365   0.839  0.000000          32.3
-#     501187     100000        0   1.542   0.846  0.000000          32.3
-#     530884     100000        0   1.345   0.844  0.000000          32.4
-#     562341     100000        0   1.357   0.825  0.000000          32.4
-#     595662     100000        0   1.338   0.830  0.000000          32.5
-#     630957     100000        0   1.349   0.818  0.000000          32.5
-#     668344     100000        0   1.338   0.825  0.000000          32.5
-#     707946     100000        0   1.328   0.817  0.000000          32.5
-#     749894     100000        0   1.331   0.821  0.000000          32.5
-#     794328     100000        0   1.327   0.818  0.000000          32.5
-#     841395     100000        0   1.342   0.820  0.000000          32.4
-#     891251     100000        0   1.318   0.813  0.000000          32.4
-#     944061     100000        0   1.326   0.814  0.000000          32.4
-#    1000000     100000        0   1.316   0.812  0.000000          32.3
-#    1059254     100000        0   1.310   0.810  0.000000          32.3
-#    1122018     100000        0   1.309   0.808  0.000000          32.2
-#    1188502     100000        0   1.506   0.932  0.000000          32.1
-#    1258925     100000        0   1.468   0.810  0.000000          32.0
-#    1333521     100000        0   1.493   0.919  0.000000          32.0
-#    1412538     100000        0   1.445   0.913  0.000000          31.9
-#    1496236     100000        0   1.428   0.908  0.000000          31.8
-#    1584893     100000        0   1.422   0.890  0.000000          31.7
-#    1678804     100000        0   1.396   0.884  0.000000          31.7
-#    1778279     100000        0   1.385   0.824  0.000000          31.6
-#    1883649     100000        0   1.434   0.876  0.000000          31.5
-#    1995262     100000        0   1.415   0.868  0.000000          31.5
-#    2113489     100000        0   1.364   0.850  0.000000          31.4
-#    2238721     100000        0   1.376   0.843  0.000000          31.3
-#    2371374     100000        0   1.380   0.838  0.000000          31.3
-#    2511886     100000        0   1.389   0.851  0.000000          31.2
-#    2660725     100000        0   1.380   0.847  0.000000          31.2
-#    2818383     100000        0   1.382   0.854  0.000000          31.1
-#    2985383     100000        0   1.388   0.861  0.000000          31.0
-#    3162278     100000        0   1.399   0.865  0.000000          31.0
-#    3349654     100000        0   1.425   0.872  0.000000          30.9
-#    3548134     100000        0   1.413   0.882  0.000000          30.8
-#    3758374     100000        0   1.431   0.885  0.000000          30.8
-#    3981072     100000        0   1.428   0.920  0.000000          30.7
-#    4216965     100000        0   1.444   0.902  0.000000          30.6
-#    4466836     100000        0   1.468   0.916  0.000000          30.5
-#    4731513     100000        0   1.466   0.924  0.000000          30.5
-#    5011872     100000        0   1.468   0.930  0.000000          30.4
-#    5308844     100000        0   1.476   0.944  0.000000          30.3
-#    5623413     100000        0   1.482   0.952  0.000000          30.2
-#    5956621     100000        0   1.484   0.962  0.000000          30.1
-#    6309573     100000        0   1.496   0.983  0.000000          30.1
-#    6683439     100000        0   1.530   0.976  0.000000          30.0
-#    7079458     100000        0   1.514   1.006  0.000000          29.9
-#    7498942     100000        0   1.564   1.007  0.000000          29.9
-#    7943282     100000        0   1.550   1.016  0.000000          29.8
-#    8413951     100000        0   1.575   1.036  0.000000          29.7
-#    8912509     100000        0   1.659   1.038  0.000000          29.7
-#    9440609     100000        0   1.630   1.045  0.000000          29.6
-#   10000000     100000        0   1.612   1.180  0.000000          29.6
-#   10592537     100000        0   1.629   1.073  0.000000          29.5
-#   11220185     100000        0   1.650   1.085  0.000000          29.5
-#   11885022     100000        0   1.663   1.101  0.000000          29.5
-#   12589254     100000        0   5.162   1.354  0.000000          29.4
-#   13335214     100000        0   1.689   1.138  0.000000          29.4
-#   14125375     100000        0   1.700   1.138  0.000000          29.3
-#   14962357     100000        0   1.695   1.149  0.000000          29.3
-# Total Duplicate strings = 0
-# Begin JudyHSFreeArray()...
-#                      returned 438636072 bytes
-# Free 14962357 strings, 0.621 uSecs Ave/string
-
-# Pass 1
-# Pass 2
-# Pass 3
-# Pass 4
-# Pass 5
-# Pass 6
-# Pass 7
-# Pass 8
-# Pass 9
-# TotInserts      0     0 InsTime GetTime      0 Ram/String
-           1      0     0   6.463   1.451      0  48.000
-           2      0     0   2.444   0.246      0  44.000
-           3      0     0   0.955   0.235      0  41.333
-           4      0     0   0.855   0.227      0  42.000
-           5      0     0   0.794   0.230      0  38.400
-           6      0     0   0.836   0.230      0  36.000
-           7      0     0   0.910   0.230      0  35.429
-           8      0     0   0.887   0.227      0  34.000
-           9      0     0   0.791   0.225      0  32.889
-          10      0     0   0.724   0.232      0  34.400
-          11      0     0   0.818   0.227      0  33.818
-          12      0     0   0.838   0.232      0  34.000
-          13      0     0   0.856   0.242      0  36.923
-          14      0     0   0.705   0.238      0  36.000
-          15      0     0   0.855   0.238      0  35.467
-          16      0     0   0.866   0.240      0  35.500
-          17      0     0   0.858   0.239      0  35.059
-          18      0     0   0.724   0.249      0  35.111
-          19      0     0   0.824   0.248      0  34.947
-          20      0     0   0.924   0.245      0  34.800
-          21      0     0   0.828   0.247      0  35.238
-          22      0     0   0.690   0.246      0  35.091
-          23      0     0   0.827   0.246      0  36.522
-          24      0     0   0.848   0.248      0  36.167
-          25      0     0   0.687   0.252      0  36.000
-          26      0     0   0.712   0.250      0  35.846
-          27      0     0   0.812   0.249      0  36.000
-          28      0     0   0.813   0.249      0  35.714
-          29      0     0   0.858   0.258      0  35.862
-          30      0     0   0.747   0.252      0  35.600
-          31      0     0   0.744   0.253      0  35.097
-          32      0     0   0.789   0.254      0  34.875
-          34      0     0   0.879   0.251      0  35.059
-          36      0     0   0.858   0.258      0  34.667
-          38      0     0   0.807   0.258      0  35.158
-          40      0     0   0.785   0.260      0  35.300
-          42      0     0   0.741   0.263      0  34.667
-          44      0     0   0.852   0.263      0  36.364
-          46      0     0   0.855   0.262      0  36.261
-          48      0     0   0.846   0.267      0  35.750
-          50      0     0   0.752   0.264      0  35.520
-          53      0     0   0.805   0.265      0  34.868
-          56      0     0   0.857   0.269      0  35.071
-          59      0     0   0.744   0.268      0  34.847
-          62      0     0   0.776   0.269      0  35.032
-          65      0     0   0.866   0.267      0  34.646
-          69      0     0   0.744   0.269      0  34.493
-          73      0     0   0.835   0.270      0  35.397
-          77      0     0   0.833   0.268      0  35.273
-          81      0     0   0.857   0.268      0  34.667
-          85      0     0   0.811   0.272      0  34.494
-          90      0     0   0.797   0.269      0  34.489
-          95      0     0   0.739   0.270      0  33.979
-         100      0     0   0.787   0.269      0  33.800
-         106      0     0   0.789   0.270      0  33.547
-         112      0     0   0.828   0.271      0  33.643
-         118      0     0   0.864   0.271      0  33.797
-         125      0     0   0.789   0.276      0  33.248
-         132      0     0   0.809   0.273      0  33.030
-         139      0     0   0.839   0.278      0  32.835
-         147      0     0   0.884   0.276      0  33.252
-         155      0     0   0.857   0.278      0  32.955
-         164      0     0   0.850   0.282      0  32.756
-         173      0     0   0.832   0.281      0  32.462
-         183      0     0   0.806   0.282      0  31.825
-         194      0     0   0.844   0.284      0  31.918
-         205      0     0   0.803   0.282      0  31.493
-         217      0     0   0.903   0.285      0  31.982
-         230      0     0   0.867   0.286      0  31.948
-         243      0     0   0.821   0.287      0  31.802
-         257      0     0   0.804   0.287      0  31.658
-         272      0     0   0.876   0.291      0  31.721
-         288      0     0   0.866   0.287      0  31.792
-         305      0     0   0.848   0.287      0  31.921
-         323      0     0   0.998   0.296      0  31.554
-         342      0     0   0.991   0.291      0  32.281
-         362      0     0   1.032   0.296      0  32.829
-         383      0     0   0.924   0.297      0  32.595
-         405      0     0   0.983   0.298      0  32.523
-         429      0     0   0.934   0.299      0  32.606
-         454      0     0   0.850   0.313      0  33.172
-         480      0     0   1.039   0.306      0  33.008
-         508      0     0   0.984   0.306      0  33.535
-         538      0     0   1.012   0.306      0  33.375
-         569      0     0   0.857   0.307      0  33.230
-         602      0     0   0.913   0.306      0  33.289
-         637      0     0   0.876   0.306      0  33.300
-         674      0     0   0.946   0.307      0  33.193
-         714      0     0   0.935   0.309      0  33.395
-         756      0     0   1.006   0.308      0  33.302
-         800      0     0   0.925   0.307      0  33.255
-         847      0     0   0.908   0.310      0  33.818
-         897      0     0   0.913   0.308      0  33.779
-         950      0     0   0.901   0.310      0  33.625
-        1006      0     0   0.866   0.310      0  33.435
-        1065      0     0   0.842   0.310      0  33.510
-        1128      0     0   0.880   0.312      0  33.394
-        1194      0     0   0.875   0.312      0  33.320
-        1264      0     0   0.855   0.314      0  33.278
-        1339      0     0   0.845   0.313      0  33.177
-        1418      0     0   0.857   0.314      0  33.078
-        1502      0     0   0.903   0.318      0  33.190
-        1591      0     0   0.899   0.319      0  33.360
-        1685      0     0   0.924   0.320      0  33.496
-        1784      0     0   0.898   0.320      0  33.404
-        1884      0     0   0.917   0.322      0  33.231
-        1995      0     0   0.885   0.324      0  33.211
-        2113      0     0   0.883   0.323      0  33.304
-        2239      0     0   0.851   0.324      0  33.402
-        2371      0     0   0.901   0.329      0  33.407
-        2512      0     0   0.937   0.328      0  33.460
-        2661      0     0   0.965   0.420      0  33.514
-        2818      0     0   0.986   0.419      0  33.469
-        2985      0     0   0.983   0.422      0  33.324
-        3162      0     0   0.992   0.426      0  33.264
-        3350      0     0   0.971   0.430      0  33.398
-        3548      0     0   0.982   0.434      0  33.359
-        3758      0     0   0.997   0.435      0  33.420
-        3981      0     0   0.999   0.440      0  33.516
-        4217      0     0   0.981   0.427      0  33.525
-        4467      0     0   1.000   0.420      0  33.595
-        4732      0     0   0.957   0.425      0  33.515
-        5012      0     0   0.950   0.435      0  33.534
-        5309      0     0   0.993   0.439      0  33.481
-        5623      0     0   0.971   0.441      0  33.435
-        5957      0     0   0.948   0.446      0  33.427
-        6310      0     0   0.982   0.451      0  33.374
-        6683      0     0   0.968   0.458      0  33.235
-        7079      0     0   0.963   0.469      0  33.154
-        7499      0     0   0.999   0.468      0  33.120
-        7943      0     0   1.007   0.425      0  33.031
-        8414      0     0   0.977   0.427      0  32.928
-        8913      0     0   1.039   0.433      0  32.851
-        9441      0     0   1.031   0.434      0  32.744
-       10000      0     0   1.010   0.437      0  32.649
-       10593      0     0   1.050   0.487      0  32.585
-       11220      0     0   1.007   0.437      0  32.440
-       11885      0     0   1.010   0.437      0  32.312
-       12589      0     0   0.973   0.440      0  32.236
-       13335      0     0   0.991   0.445      0  32.098
-       14125      0     0   0.984   0.444      0  31.988
-       14962      0     0   1.092   0.447      0  31.878
-       15849      0     0   0.994   0.444      0  31.790
-       16788      0     0   0.985   0.447      0  31.697
-       17783      0     0   0.994   0.451      0  31.628
-       18836      0     0   1.007   0.455      0  31.562
-       19953      0     0   1.002   0.459      0  31.544
-       21135      0     0   1.016   0.469      0  31.482
-       22387      0     0   1.016   0.474      0  31.438
-       23714      0     0   1.019   0.475      0  31.371
-       25119      0     0   1.052   0.483      0  31.315
-       26607      0     0   1.026   0.493      0  31.245
-       28184      0     0   1.033   0.496      0  31.192
-       29854      0     0   1.048   0.499      0  31.114
-       31623      0     0   1.053   0.510      0  31.061
-       33497      0     0   1.092   0.520      0  31.005
-       35481      0     0   1.075   0.527      0  30.960
-       37584      0     0   1.095   0.535      0  30.904
-       39811      0     0   1.127   0.543      0  30.849
-       42170      0     0   1.089   0.552      0  30.757
-       44668      0     0   1.119   0.559      0  30.711
-       47315      0     0   1.113   0.566      0  30.671
-       50119      0     0   1.129   0.576      0  30.635
-       53088      0     0   1.144   0.589      0  30.635
-       56234      0     0   1.171   0.597      0  30.595
-       59566      0     0   1.146   0.601      0  30.567
-       63096      0     0   1.152   0.607      0  30.533
-       66834      0     0   1.155   0.617      0  30.465
-       70795      0     0   1.172   0.629      0  30.434
-       74989      0     0   1.214   0.634      0  30.390
-       79433      0     0   1.199   0.643      0  30.414
-       84140      0     0   1.219   0.652      0  30.395
-       89125      0     0   1.238   0.658      0  30.416
-       94406      0     0   1.272   0.671      0  30.521
-      100000      0     0   1.300   0.672      0  30.589
-      105925      0     0   1.326   0.699      0  30.778
-      112202      0     0   1.363   0.705      0  31.016
-      118850      0     0   1.353   0.698      0  31.189
-      125893      0     0   1.351   0.702      0  31.389
-      133352      0     0   1.334   0.710      0  31.545
-      141254      0     0   1.312   0.710      0  31.709
-      149624      0     0   1.314   0.719      0  31.804
-      158489      0     0   1.286   0.731      0  31.886
-      167880      0     0   1.292   0.724      0  31.953
-      177828      0     0   1.269   0.733      0  32.006
-      188365      0     0   1.277   0.739      0  32.049
-      199526      0     0   1.277   0.742      0  32.057
-      211349      0     0   1.275   0.742      0  32.075
-      223872      0     0   1.260   0.750      0  32.078
-      237137      0     0   1.267   0.765      0  32.081
-      251189      0     0   1.270   0.761      0  32.079
-      266073      0     0   1.271   0.769      0  32.075
-      281838      0     0   1.276   0.772      0  32.063
-      298538      0     0   1.277   0.778      0  32.058
-      316228      0     0   1.316   0.788      0  32.033
-      334965      0     0   1.286   0.784      0  32.016
-      354813      0     0   1.294   0.788      0  32.052
-      375837      0     0   1.306   0.791      0  32.083
-      398107      0     0   1.305   0.785      0  32.123
-      421697      0     0   1.349   0.797      0  32.168
-      446684      0     0   1.314   0.794      0  32.219
-      473151      0     0   1.336   0.805      0  32.273
-      501187      0     0   1.304   0.806      0  32.318
-      530884      0     0   1.341   0.812      0  32.371
-      562341      0     0   1.318   0.813      0  32.419
-      595662      0     0   1.308   0.816      0  32.453
-      630957      0     0   1.297   0.818      0  32.474
-      668344      0     0   1.283   0.823      0  32.484
-      707946      0     0   1.328   0.817      0  32.481
-      749894      0     0   1.282   0.821      0  32.470
-      794328      0     0   1.324   0.818      0  32.449
-      841395      0     0   1.318   0.820      0  32.417
-      891251      0     0   1.317   0.813      0  32.375
-      944061      0     0   1.319   0.814      0  32.329
-     1000000      0     0   1.294   0.812      0  32.282
-     1059254      0     0   1.310   0.810      0  32.222
-     1122018      0     0   1.303   0.808      0  32.158
-     1188502      0     0   1.302   0.823      0  32.085
-     1258925      0     0   1.267   0.810      0  32.009
-     1333521      0     0   1.246   0.813      0  31.930
-     1412538      0     0   1.254   0.819      0  31.848
-     1496236      0     0   1.250   0.819      0  31.772
-     1584893      0     0   1.257   0.827      0  31.698
-     1678804      0     0   1.261   0.822      0  31.623
-     1778279      0     0   1.278   0.824      0  31.553
-     1883649      0     0   1.280   0.871      0  31.491
-     1995262      0     0   1.325   0.844      0  31.428
-     2113489      0     0   1.325   0.841      0  31.372
-     2238721      0     0   1.298   0.843      0  31.313
-     2371374      0     0   1.314   0.838      0  31.254
-     2511886      0     0   1.319   0.851      0  31.196
-     2660725      0     0   1.330   0.847      0  31.136
-     2818383      0     0   1.332   0.854      0  31.073
-     2985383      0     0   1.356   0.861      0  31.009
-     3162278      0     0   1.375   0.865      0  30.943
-     3349654      0     0   1.374   0.872      0  30.874
-     3548134      0     0   1.370   0.882      0  30.803
-     3758374      0     0   1.388   0.885      0  30.729
-     3981072      0     0   1.378   0.894      0  30.654
-     4216965      0     0   1.382   0.902      0  30.578
-     4466836      0     0   1.394   0.904      0  30.500
-     4731513      0     0   1.421   0.924      0  30.422
-     5011872      0     0   1.431   0.930      0  30.343
-     5308844      0     0   1.437   0.944      0  30.265
-     5623413      0     0   1.443   0.952      0  30.188
-     5956621      0     0   1.453   0.962      0  30.113
-     6309573      0     0   1.444   0.974      0  30.042
-     6683439      0     0   1.459   0.976      0  29.974
-     7079458      0     0   1.480   0.985      0  29.909
-     7498942      0     0   1.489   1.007      0  29.848
-     7943282      0     0   1.506   1.016      0  29.789
-     8413951      0     0   1.519   1.017      0  29.731
-     8912509      0     0   1.527   1.038      0  29.677
-     9440609      0     0   1.547   1.045      0  29.624
-    10000000      0     0   1.553   1.061      0  29.573
-    10592537      0     0   1.576   1.073      0  29.527
-    11220185      0     0   1.590   1.082      0  29.484
-    11885022      0     0   1.603   1.086      0  29.444
-    12589254      0     0   1.603   1.103      0  29.407
-    13335214      0     0   1.621   1.105      0  29.373
-    14125375      0     0   1.636   1.120      0  29.343
-    14962357      0     0   1.646   1.137      0  29.316
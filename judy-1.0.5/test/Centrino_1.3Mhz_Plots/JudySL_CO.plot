@@ -1,567 +0,0 @@
-# StringCompare -n16788040 -A JudySL -P40 -L10 -C -M100000 /home/data/domnames.txt
-# This file is in a format to input to 'jbgraph'
-# XLABEL Stored
-# YLABEL Microseconds / Index
-# COLHEAD 1 Total Insert attempts
-# COLHEAD 2 Number Gets
-# COLHEAD 3 Duplicate strings
-# COLHEAD 4 Insert Time (uS)
-# COLHEAD 5 Get Time (uS)
-# COLHEAD 6 Hash Chain Length
-# COLHEAD 7 Average RAM/String
-# Linux localhost 2.6.3-4mdkenterprise #1 SMP Tue Mar 2 07:00:53 CET 2004 i686
-# 32 Bit CPU
-# Processor speed compiled at 1299 Mhz
-# 12587648 (75.0%) non-Word_t aligned string buffers
-# Ram used for input data = 418243455 bytes
-# Average string length = 15.9 bytes
-# 3200000 bytes malloc() for 'cached' strings for Get measurement
-# Access Time    =  0.101 uS average per string (mostly from Cache)
-# HashStr() Time =  0.270 uS average per string (mostly from Cache)
-# Access Time    =  0.296 uS average per string (mostly from RAM)
-# HashStr() Time =  0.482 uS average per string (mostly from RAM)
-# Pass 0
-# TotInserts  DeltaGets  DupStrs InsTime GetTime HChainLen Ram/String
-#          1          1        0  24.309   5.002  0.000000          16.0
-#          2          2        0  21.507   0.328  0.000000          26.0
-#          3          3        0   1.485   0.184  0.000000          25.3
-#          4          4        0   1.438   0.173  0.000000          28.0
-#          5          5        0   1.045   0.183  0.000000          25.6
-#          6          6        0   1.435   0.172  0.000000          27.3
-#          7          7        0   0.820   0.166  0.000000          25.1
-#          8          8        0   1.261   0.157  0.000000          27.5
-#          9          9        0   1.092   0.159  0.000000          26.2
-#         10         10        0   0.993   0.154  0.000000          25.6
-#         11         11        0   1.030   0.156  0.000000          24.4
-#         12         12        0   2.002   0.157  0.000000          26.7
-#         13         13        0   1.041   0.153  0.000000          25.5
-#         14         14        0   0.993   0.151  0.000000          25.1
-#         15         15        0   1.127   0.152  0.000000          24.5
-#         16         16        0   6.505   0.167  0.000000          28.5
-#         17         17        0   1.215   0.163  0.000000          28.0
-#         18         18        0   1.001   0.159  0.000000          27.3
-#         19         19        0   0.945   0.163  0.000000          26.5
-#         20         20        0   0.935   0.159  0.000000          25.8
-#         21         21        0   1.032   0.159  0.000000          25.5
-#         22         22        0   1.381   0.160  0.000000          25.3
-#         23         23        0   1.505   0.167  0.000000          25.4
-#         24         24        0   2.011   0.165  0.000000          27.5
-#         25         25        0   1.118   0.160  0.000000          27.0
-#         26         26        0   0.883   0.162  0.000000          26.8
-#         27         27        0   1.025   0.158  0.000000          26.4
-#         28         28        0   1.024   0.164  0.000000          25.9
-#         29         29        0   0.938   0.163  0.000000          25.9
-#         30         30        0   1.272   0.159  0.000000          25.9
-#         31         31        0   1.132   0.165  0.000000          25.4
-#         32         32        0  26.102   0.294  0.000000          31.5
-#         34         34        0   1.351   0.228  0.000000          31.2
-#         36         36        0   1.230   0.228  0.000000          31.0
-#         38         38        0   1.286   0.230  0.000000          31.3
-#         40         40        0   1.182   0.225  0.000000          31.1
-#         42         42        0   1.211   0.233  0.000000          31.4
-#         44         44        0   1.158   0.285  0.000000          31.0
-#         46         46        0   1.280   0.234  0.000000          30.8
-#         48         48        0   1.042   0.235  0.000000          30.6
-#         50         50        0   1.325   0.236  0.000000          30.8
-#         53         53        0   1.140   0.238  0.000000          30.6
-#         56         56        0   1.038   0.235  0.000000          30.3
-#         59         59        0   1.012   0.234  0.000000          30.2
-#         62         62        0   1.834   0.240  0.000000          30.5
-#         65         65        0   1.084   0.239  0.000000          30.4
-#         69         69        0   1.006   0.240  0.000000          30.2
-#         73         73        0   0.838   0.240  0.000000          29.6
-#         77         77        0   0.969   0.244  0.000000          29.8
-#         81         81        0   1.057   0.241  0.000000          29.7
-#         85         85        0   0.920   0.247  0.000000          29.6
-#         90         90        0   0.873   0.245  0.000000          29.1
-#         95         95        0   1.041   0.248  0.000000          29.1
-#        100        100        0   1.169   0.252  0.000000          29.0
-#        106        106        0   1.025   0.254  0.000000          29.4
-#        112        112        0   0.992   0.314  0.000000          29.0
-#        118        118        0   0.902   0.257  0.000000          28.6
-#        125        125        0   1.013   0.256  0.000000          28.8
-#        132        132        0   1.438   0.258  0.000000          28.7
-#        139        139        0   0.984   0.257  0.000000          28.8
-#        147        147        0   1.134   0.260  0.000000          29.5
-#        155        155        0   1.127   0.264  0.000000          29.5
-#        164        164        0   0.975   0.261  0.000000          29.1
-#        173        173        0   0.924   0.267  0.000000          28.6
-#        183        183        0   1.115   0.267  0.000000          28.6
-#        194        194        0   1.188   0.272  0.000000          29.1
-#        205        205        0   1.063   0.272  0.000000          28.7
-#        217        217        0   1.030   0.273  0.000000          28.7
-#        230        230        0   0.879   0.274  0.000000          28.2
-#        243        243        0   1.329   0.274  0.000000          28.1
-#        257        257        0   1.788   0.279  0.000000          28.9
-#        272        272        0   0.900   0.277  0.000000          28.6
-#        288        288        0   1.180   0.276  0.000000          28.8
-#        305        305        0   1.091   0.276  0.000000          28.6
-#        323        323        0   1.082   0.284  0.000000          28.4
-#        342        342        0   1.313   0.277  0.000000          28.9
-#        362        362        0   1.203   0.280  0.000000          28.8
-#        383        383        0   1.041   0.282  0.000000          28.8
-#        405        405        0   1.047   0.283  0.000000          28.9
-#        429        429        0   0.988   0.285  0.000000          28.7
-#        454        454        0   1.055   0.286  0.000000          28.5
-#        480        480        0   1.300   0.287  0.000000          28.8
-#        508        508        0   1.050   0.291  0.000000          28.6
-#        538        538        0   1.133   0.300  0.000000          28.5
-#        569        569        0   1.041   0.289  0.000000          28.3
-#        602        602        0   1.161   0.294  0.000000          28.3
-#        637        637        0   1.178   0.298  0.000000          28.5
-#        674        674        0   1.167   0.287  0.000000          28.5
-#        714        714        0   1.180   0.287  0.000000          28.5
-#        756        756        0   1.364   0.286  0.000000          28.7
-#        800        800        0   1.087   0.290  0.000000          28.4
-#        847        847        0   1.186   0.290  0.000000          28.3
-#        897        897        0   1.218   0.277  0.000000          30.2
-#        950        950        0   1.147   0.276  0.000000          30.1
-#       1006       1006        0   1.059   0.283  0.000000          29.9
-#       1065       1065        0   1.245   0.280  0.000000          29.7
-#       1128       1128        0   1.164   0.286  0.000000          29.5
-#       1194       1194        0   1.136   0.282  0.000000          29.3
-#       1264       1264        0   1.176   0.282  0.000000          29.3
-#       1339       1339        0   1.160   0.287  0.000000          30.5
-#       1418       1418        0   1.123   0.289  0.000000          30.3
-#       1502       1502        0   1.163   0.285  0.000000          30.0
-#       1591       1591        0   1.284   0.286  0.000000          30.0
-#       1685       1685        0   1.158   0.288  0.000000          30.0
-#       1784       1784        0   1.149   0.289  0.000000          30.7
-#       1884       1884        0   1.093   0.289  0.000000          30.4
-#       1995       1995        0   1.241   0.292  0.000000          30.2
-#       2113       2113        0   1.217   0.297  0.000000          30.1
-#       2239       2239        0   1.161   0.297  0.000000          30.6
-#       2371       2371        0   1.135   0.296  0.000000          30.4
-#       2512       2512        0   1.093   0.301  0.000000          30.2
-#       2661       2661        0   1.096   0.302  0.000000          30.0
-#       2818       2818        0   1.193   0.359  0.000000          30.4
-#       2985       2985        0   1.238   0.303  0.000000          30.2
-#       3162       3162        0   1.119   0.303  0.000000          29.9
-#       3350       3350        0   1.229   0.302  0.000000          30.3
-#       3548       3548        0   1.257   0.307  0.000000          30.1
-#       3758       3758        0   1.177   0.311  0.000000          29.9
-#       3981       3981        0   1.293   0.311  0.000000          30.3
-#       4217       4217        0   1.178   0.316  0.000000          30.0
-#       4467       4467        0   1.215   0.318  0.000000          30.2
-#       4732       4732        0   1.200   0.321  0.000000          30.0
-#       5012       5012        0   1.187   0.326  0.000000          29.7
-#       5309       5309        0   1.276   0.330  0.000000          29.9
-#       5623       5623        0   1.208   0.330  0.000000          30.0
-#       5957       5957        0   1.234   0.337  0.000000          29.8
-#       6310       6310        0   1.297   0.338  0.000000          30.0
-#       6683       6683        0   1.245   0.344  0.000000          29.8
-#       7079       7079        0   1.275   0.350  0.000000          29.9
-#       7499       7499        0   1.287   0.352  0.000000          29.6
-#       7943       7943        0   1.257   0.356  0.000000          29.7
-#       8414       8414        0   1.249   0.357  0.000000          29.7
-#       8913       8913        0   1.263   0.362  0.000000          29.5
-#       9441       9441        0   1.230   0.363  0.000000          29.3
-#      10000      10000        0   1.226   0.369  0.000000          29.1
-#      10593      10593        0   1.257   0.371  0.000000          28.9
-#      11220      11220        0   1.308   0.377  0.000000          28.8
-#      11885      11885        0   1.276   0.409  0.000000          28.6
-#      12589      12589        0   1.283   0.398  0.000000          28.4
-#      13335      13335        0   1.318   0.450  0.000000          28.5
-#      14125      14125        0   1.309   0.392  0.000000          28.5
-#      14962      14962        0   1.280   0.395  0.000000          28.3
-#      15849      15849        0   1.304   0.400  0.000000          28.2
-#      16788      16788        0   1.295   0.405  0.000000          28.0
-#      17783      17783        0   1.324   0.411  0.000000          27.9
-#      18836      18836        0   1.338   0.416  0.000000          27.8
-#      19953      19953        0   1.353   0.426  0.000000          27.8
-#      21135      21135        0   1.342   0.429  0.000000          27.8
-#      22387      22387        0   1.365   0.448  0.000000          27.8
-#      23714      23714        0   1.343   0.451  0.000000          27.8
-#      25119      25119        0   1.361   0.452  0.000000          27.8
-#      26607      26607        0   1.482   0.469  0.000000          27.7
-#      28184      28184        0   1.368   0.479  0.000000          27.7
-#      29854      29854        0   1.350   0.477  0.000000          27.6
-#      31623      31623        0   1.477   0.511  0.000000          27.6
-#      33497      33497        0   1.397   0.501  0.000000          27.5
-#      35481      35481        0   1.496   0.515  0.000000          27.5
-#      37584      37584        0   1.404   0.529  0.000000          27.4
-#      39811      39811        0   1.420   0.543  0.000000          27.4
-#      42170      42170        0   1.443   0.554  0.000000          27.4
-#      44668      44668        0   1.439   0.568  0.000000          27.3
-#      47315      47315        0   1.469   0.592  0.000000          27.3
-#      50119      50119        0   1.473   0.593  0.000000          27.3
-#      53088      53088        0   1.524   0.623  0.000000          27.2
-#      56234      56234        0   1.491   0.617  0.000000          27.2
-#      59566      59566        0   1.510   0.631  0.000000          27.1
-#      63096      63096        0   1.508   0.644  0.000000          27.1
-#      66834      66834        0   1.517   0.667  0.000000          27.0
-#      70795      70795        0   1.549   0.688  0.000000          26.9
-#      74989      74989        0   1.614   0.689  0.000000          26.9
-#      79433      79433        0   1.573   0.701  0.000000          26.8
-#      84140      84140        0   1.596   0.715  0.000000          26.8
-#      89125      89125        0   1.594   0.731  0.000000          26.8
-#      94406      94406        0   1.602   0.742  0.000000          26.7
-#     100000     100000        0   1.631   0.755  0.000000          26.7
-#     105925     100000        0   1.646   0.773  0.000000          26.6
-#     112202     100000        0   1.691   0.788  0.000000          26.6
-#     118850     100000        0   1.721   0.808  0.000000          26.5
-#     125893     100000        0   1.695   0.810  0.000000          26.5
-#     133352     100000        0   1.785   0.823  0.000000          26.5
-#     141254     100000        0   1.755   0.835  0.000000          26.4
-#     149624     100000        0   1.781   0.859  0.000000          26.4
-#     158489     100000        0   1.784   0.868  0.000000          26.4
-#     167880     100000        0   1.762   0.889  0.000000          26.3
-#     177828     100000        0   1.789   0.896  0.000000          26.3
-#     188365     100000        0   1.820   0.904  0.000000          26.2
-#     199526     100000        0   1.830   0.914  0.000000          26.1
-#     211349     100000        0   1.870   0.930  0.000000          26.1
-#     223872     100000        0   1.861   0.944  0.000000          26.0
-#     237137     100000        0   1.862   0.967  0.000000          26.0
-#     251189     100000        0   1.894   0.975  0.000000          25.9
-#     266073     100000        0   1.906   0.985  0.000000          25.9
-#     281838     100000        0   1.942   1.006  0.000000          25.8
-#     298538     100000        0   1.997   1.027  0.000000          25.8
-#     316228     100000        0   1.965   1.029  0.000000          25.7
-#     334965     100000        0   1.966   1.042  0.000000          25.7
-#     354813     100000        0   1.975   1.054  0.000000          25.6
-#     375837     100000        0   1.999   1.074  0.000000          25.6
-#     398107     100000        0   2.026   1.083  0.000000          25.6
-#     421697     100000        0   2.046   1.094  0.000000          25.5
-#     446684     100000        0   2.057   1.117  0.000000          25.5
-#     473151     100000        0   2.069   1.124  0.000000          25.4
-#     501187     100000        0   2.083   1.135  0.000000          25.4
-#     530884     100000        0   2.112   1.153  0.000000          25.3
-#     562341     100000        0   2.116   1.164  0.000000          25.3
-#     595662     100000        0   2.148   1.179  0.000000          25.2
-#     630957     100000        0   2.182   1.195  0.000000          25.2
-#     668344     100000        0   2.206   1.207  0.000000          25.2
-#     707946     100000        0   2.183   1.228  0.000000          25.1
-#     749894     100000        0   2.186   1.233  0.000000          25.1
-#     794328     100000        0   2.216   1.251  0.000000          25.0
-#     841395     100000        0   2.243   1.260  0.000000          25.0
-#     891251     100000        0   2.254   1.270  0.000000          25.0
-#     944061     100000        0   2.272   1.285  0.000000          24.9
-#    1000000     100000        0   2.274   1.304  0.000000          24.9
-#    1059254     100000        0   2.300   1.312  0.000000          24.8
-#    1122018     100000        0   2.307   1.339  0.000000          24.8
-#    1188502     100000        0   2.321   1.345  0.000000          24.7
-#    1258925     100000        0   2.341   1.349  0.000000          24.7
-#    1333521     100000        0   2.351   1.373  0.000000          24.7
-#    1412538     100000        0   2.367   1.383  0.000000          24.6
-#    1496236     100000        0   2.396   1.393  0.000000          24.6
-#    1584893     100000        0   2.407   1.404  0.000000          24.5
-#    1678804     100000        0   2.427   1.415  0.000000          24.5
-#    1778279     100000        0   2.432   1.432  0.000000          24.4
-#    1883649     100000        0   2.460   1.444  0.000000          24.4
-#    1995262     100000        0   2.459   1.461  0.000000          24.4
-#    2113489     100000        0   2.493   1.471  0.000000          24.3
-#    2238721     100000        0   2.502   1.496  0.000000          24.3
-#    2371374     100000        0   2.530   1.508  0.000000          24.3
-#    2511886     100000        0   2.538   1.516  0.000000          24.2
-#    2660725     100000        0   2.551   1.539  0.000000          24.2
-#    2818383     100000        0   2.578   1.543  0.000000          24.1
-#    2985383     100000        0   2.590   1.562  0.000000          24.1
-#    3162278     100000        0   2.617   1.576  0.000000          24.1
-#    3349654     100000        0   2.625   1.615  0.000000          24.0
-#    3548134     100000        0   2.650   1.621  0.000000          24.0
-#    3758374     100000        0   2.679   1.642  0.000000          23.9
-#    3981072     100000        0   2.701   1.659  0.000000          23.9
-#    4216965     100000        0   2.722   1.671  0.000000          23.9
-#    4466836     100000        0   2.752   1.690  0.000000          23.8
-#    4731513     100000        0   2.772   1.707  0.000000          23.8
-#    5011872     100000        0   2.792   1.730  0.000000          23.7
-#    5308844     100000        0   3.166   1.753  0.000000          23.7
-#    5623413     100000        0   2.819   1.757  0.000000          23.7
-#    5956621     100000        0   2.841   1.776  0.000000          23.6
-#    6309573     100000        0   2.864   1.804  0.000000          23.6
-#    6683439     100000        0   2.885   1.807  0.000000          23.5
-#    7079458     100000        0   2.910   1.849  0.000000          23.5
-#    7498942     100000        0   2.932   1.865  0.000000          23.4
-#    7943282     100000        0   2.956   1.880  0.000000          23.4
-#    8413951     100000        0   2.989   1.914  0.000000          23.3
-#    8912509     100000        0   3.009   1.928  0.000000          23.3
-#    9440609     100000        0   3.035   1.950  0.000000          23.2
-#   10000000     100000        0   3.067   1.981  0.000000          23.2
-#   10592537     100000        0   3.109   2.017  0.000000          23.1
-#   11220185     100000        0   3.118   2.044  0.000000          23.1
-#   11885022     100000        0   3.151   2.074  0.000000          23.0
-#   12589254     100000        0   3.184   2.092  0.000000          23.0
-#   13335214     100000        0   3.202   2.133  0.000000          22.9
-#   14125375     100000        0   3.230   2.148  0.000000          22.8
-#   14962357     100000        0   3.258   2.190  0.000000          22.8
-#   15848932     100000        0   3.281   2.220  0.000000          22.7
-#   16788040     100000        0   3.319   2.228  0.000000          22.6
-# Total Duplicate strings = 0
-# Begin JudySLFreeArray()...
-#                      returned 380043160 bytes
-# Free 16788040 strings, 0.615 uSecs Ave/string
-
-# Pass 1
-# Pass 2
-# Pass 3
-# Pass 4
-# Pass 5
-# Pass 6
-# Pass 7
-# Pass 8
-# Pass 9
-# TotInserts      0     0 InsTime GetTime      0 Ram/String
-           1      0     0   4.734   0.951      0  20.000
-           2      0     0   4.802   0.251      0  24.000
-           3      0     0   0.851   0.143      0  26.667
-           4      0     0   0.893   0.150      0  28.000
-           5      0     0   0.708   0.151      0  28.000
-           6      0     0   0.871   0.145      0  28.667
-           7      0     0   0.661   0.151      0  26.286
-           8      0     0   1.261   0.149      0  30.000
-           9      0     0   0.634   0.150      0  28.000
-          10      0     0   0.647   0.151      0  28.000
-          11      0     0   0.634   0.143      0  26.909
-          12      0     0   1.137   0.149      0  29.000
-          13      0     0   0.640   0.153      0  28.308
-          14      0     0   0.634   0.148      0  27.429
-          15      0     0   0.644   0.149      0  27.200
-          16      0     0   1.163   0.161      0  30.750
-          17      0     0   0.707   0.153      0  30.353
-          18      0     0   0.669   0.152      0  29.556
-          19      0     0   0.694   0.155      0  29.053
-          20      0     0   0.675   0.153      0  28.800
-          21      0     0   0.664   0.155      0  28.762
-          22      0     0   0.732   0.160      0  28.000
-          23      0     0   0.631   0.154      0  27.478
-          24      0     0   0.905   0.158      0  29.500
-          25      0     0   0.661   0.158      0  28.960
-          26      0     0   0.681   0.159      0  28.615
-          27      0     0   0.695   0.158      0  28.148
-          28      0     0   0.706   0.156      0  27.714
-          29      0     0   0.672   0.161      0  27.172
-          30      0     0   0.663   0.159      0  27.067
-          31      0     0   0.686   0.159      0  26.710
-          32      0     0   0.978   0.177      0  33.625
-          34      0     0   0.814   0.174      0  33.294
-          36      0     0   0.962   0.218      0  33.111
-          38      0     0   0.774   0.222      0  32.632
-          40      0     0   0.839   0.220      0  32.000
-          42      0     0   0.798   0.225      0  32.190
-          44      0     0   0.848   0.226      0  31.636
-          46      0     0   0.844   0.229      0  30.957
-          48      0     0   0.828   0.226      0  31.167
-          50      0     0   0.802   0.230      0  30.480
-          53      0     0   0.811   0.230      0  30.415
-          56      0     0   0.897   0.234      0  29.714
-          59      0     0   0.863   0.233      0  29.492
-          62      0     0   0.925   0.236      0  29.742
-          65      0     0   0.858   0.235      0  29.231
-          69      0     0   0.848   0.238      0  29.449
-          73      0     0   0.784   0.240      0  29.151
-          77      0     0   0.855   0.237      0  28.883
-          81      0     0   0.887   0.241      0  29.185
-          85      0     0   0.894   0.247      0  29.271
-          90      0     0   0.873   0.245      0  29.289
-          95      0     0   0.849   0.248      0  29.600
-         100      0     0   0.859   0.252      0  29.640
-         106      0     0   0.943   0.254      0  29.547
-         112      0     0   0.872   0.258      0  29.071
-         118      0     0   0.902   0.257      0  29.119
-         125      0     0   0.833   0.256      0  28.960
-         132      0     0   0.873   0.258      0  28.515
-         139      0     0   0.918   0.257      0  28.259
-         147      0     0   0.888   0.260      0  27.918
-         155      0     0   0.869   0.264      0  28.077
-         164      0     0   0.936   0.261      0  28.000
-         173      0     0   0.907   0.267      0  27.838
-         183      0     0   0.870   0.267      0  27.366
-         194      0     0   0.916   0.272      0  27.485
-         205      0     0   0.950   0.272      0  28.078
-         217      0     0   0.915   0.273      0  28.111
-         230      0     0   0.879   0.274      0  27.826
-         243      0     0   0.973   0.274      0  27.934
-         257      0     0   0.944   0.279      0  28.000
-         272      0     0   0.900   0.277      0  27.676
-         288      0     0   0.999   0.276      0  27.444
-         305      0     0   0.918   0.276      0  27.370
-         323      0     0   1.051   0.284      0  27.641
-         342      0     0   1.090   0.277      0  28.082
-         362      0     0   1.065   0.280      0  27.878
-         383      0     0   1.041   0.282      0  28.010
-         405      0     0   1.026   0.283      0  28.425
-         429      0     0   0.988   0.285      0  28.177
-         454      0     0   1.055   0.286      0  28.467
-         480      0     0   1.094   0.287      0  28.042
-         508      0     0   1.050   0.291      0  28.126
-         538      0     0   1.096   0.298      0  28.416
-         569      0     0   1.041   0.289      0  28.359
-         602      0     0   1.161   0.294      0  28.332
-         637      0     0   1.178   0.298      0  28.509
-         674      0     0   1.167   0.287      0  28.641
-         714      0     0   1.170   0.287      0  28.958
-         756      0     0   1.270   0.286      0  28.841
-         800      0     0   1.087   0.290      0  28.610
-         847      0     0   1.186   0.290      0  28.434
-         897      0     0   1.218   0.277      0  30.100
-         950      0     0   1.106   0.276      0  30.097
-        1006      0     0   1.059   0.283      0  29.920
-        1065      0     0   1.129   0.280      0  29.923
-        1128      0     0   1.058   0.286      0  29.652
-        1194      0     0   1.067   0.282      0  29.471
-        1264      0     0   1.176   0.282      0  29.256
-        1339      0     0   1.092   0.287      0  29.028
-        1418      0     0   1.081   0.289      0  28.996
-        1502      0     0   1.093   0.285      0  30.088
-        1591      0     0   1.036   0.286      0  29.715
-        1685      0     0   1.063   0.288      0  29.550
-        1784      0     0   1.094   0.289      0  29.330
-        1884      0     0   1.084   0.289      0  29.246
-        1995      0     0   1.066   0.292      0  30.129
-        2113      0     0   1.097   0.297      0  29.925
-        2239      0     0   1.128   0.297      0  29.747
-        2371      0     0   1.103   0.296      0  29.545
-        2512      0     0   1.082   0.301      0  30.013
-        2661      0     0   1.080   0.302      0  29.844
-        2818      0     0   1.135   0.322      0  29.612
-        2985      0     0   1.074   0.303      0  29.994
-        3162      0     0   1.099   0.303      0  29.736
-        3350      0     0   1.100   0.302      0  29.586
-        3548      0     0   1.092   0.307      0  29.948
-        3758      0     0   1.133   0.311      0  29.824
-        3981      0     0   1.127   0.311      0  29.521
-        4217      0     0   1.144   0.316      0  29.796
-        4467      0     0   1.165   0.318      0  29.630
-        4732      0     0   1.137   0.321      0  29.863
-        5012      0     0   1.149   0.326      0  29.686
-        5309      0     0   1.137   0.330      0  29.922
-        5623      0     0   1.110   0.330      0  29.685
-        5957      0     0   1.152   0.337      0  29.730
-        6310      0     0   1.149   0.338      0  29.636
-        6683      0     0   1.169   0.344      0  29.757
-        7079      0     0   1.188   0.350      0  29.522
-        7499      0     0   1.172   0.352      0  29.485
-        7943      0     0   1.184   0.356      0  29.481
-        8414      0     0   1.177   0.357      0  29.364
-        8913      0     0   1.173   0.362      0  29.487
-        9441      0     0   1.176   0.363      0  29.274
-       10000      0     0   1.182   0.369      0  29.111
-       10593      0     0   1.205   0.371      0  28.880
-       11220      0     0   1.197   0.377      0  28.883
-       11885      0     0   1.200   0.409      0  28.710
-       12589      0     0   1.207   0.398      0  28.586
-       13335      0     0   1.224   0.420      0  28.478
-       14125      0     0   1.213   0.392      0  28.337
-       14962      0     0   1.224   0.395      0  28.230
-       15849      0     0   1.243   0.400      0  28.074
-       16788      0     0   1.244   0.405      0  27.968
-       17783      0     0   1.261   0.411      0  27.827
-       18836      0     0   1.272   0.416      0  27.712
-       19953      0     0   1.283   0.426      0  27.697
-       21135      0     0   1.265   0.429      0  27.584
-       22387      0     0   1.287   0.448      0  27.546
-       23714      0     0   1.296   0.451      0  27.511
-       25119      0     0   1.298   0.452      0  27.519
-       26607      0     0   1.313   0.469      0  27.518
-       28184      0     0   1.325   0.479      0  27.524
-       29854      0     0   1.323   0.477      0  27.444
-       31623      0     0   1.338   0.511      0  27.434
-       33497      0     0   1.346   0.501      0  27.402
-       35481      0     0   1.368   0.515      0  27.335
-       37584      0     0   1.365   0.529      0  27.333
-       39811      0     0   1.377   0.543      0  27.306
-       42170      0     0   1.382   0.554      0  27.303
-       44668      0     0   1.404   0.568      0  27.259
-       47315      0     0   1.414   0.592      0  27.225
-       50119      0     0   1.417   0.593      0  27.198
-       53088      0     0   1.448   0.619      0  27.141
-       56234      0     0   1.452   0.617      0  27.096
-       59566      0     0   1.447   0.631      0  27.072
-       63096      0     0   1.474   0.644      0  27.052
-       66834      0     0   1.487   0.667      0  27.033
-       70795      0     0   1.506   0.683      0  26.991
-       74989      0     0   1.518   0.689      0  26.935
-       79433      0     0   1.525   0.701      0  26.883
-       84140      0     0   1.546   0.715      0  26.842
-       89125      0     0   1.556   0.731      0  26.823
-       94406      0     0   1.565   0.742      0  26.731
-      100000      0     0   1.589   0.755      0  26.702
-      105925      0     0   1.608   0.773      0  26.692
-      112202      0     0   1.627   0.788      0  26.645
-      118850      0     0   1.634   0.807      0  26.616
-      125893      0     0   1.645   0.810      0  26.572
-      133352      0     0   1.658   0.823      0  26.512
-      141254      0     0   1.670   0.835      0  26.464
-      149624      0     0   1.688   0.857      0  26.408
-      158489      0     0   1.700   0.866      0  26.358
-      167880      0     0   1.730   0.882      0  26.324
-      177828      0     0   1.730   0.896      0  26.276
-      188365      0     0   1.749   0.904      0  26.217
-      199526      0     0   1.769   0.914      0  26.156
-      211349      0     0   1.780   0.930      0  26.109
-      223872      0     0   1.791   0.944      0  26.065
-      237137      0     0   1.809   0.961      0  26.013
-      251189      0     0   1.828   0.971      0  25.967
-      266073      0     0   1.840   0.984      0  25.922
-      281838      0     0   1.870   0.997      0  25.863
-      298538      0     0   1.883   1.009      0  25.818
-      316228      0     0   1.897   1.023      0  25.746
-      334965      0     0   1.913   1.037      0  25.691
-      354813      0     0   1.917   1.049      0  25.659
-      375837      0     0   1.939   1.061      0  25.606
-      398107      0     0   1.957   1.075      0  25.560
-      421697      0     0   1.977   1.086      0  25.502
-      446684      0     0   1.994   1.103      0  25.468
-      473151      0     0   2.009   1.113      0  25.425
-      501187      0     0   2.019   1.127      0  25.383
-      530884      0     0   2.036   1.139      0  25.343
-      562341      0     0   2.060   1.151      0  25.294
-      595662      0     0   2.073   1.162      0  25.255
-      630957      0     0   2.093   1.177      0  25.212
-      668344      0     0   2.100   1.189      0  25.170
-      707946      0     0   2.116   1.203      0  25.128
-      749894      0     0   2.139   1.216      0  25.089
-      794328      0     0   2.147   1.229      0  25.046
-      841395      0     0   2.163   1.239      0  25.009
-      891251      0     0   2.171   1.252      0  24.968
-      944061      0     0   2.196   1.267      0  24.935
-     1000000      0     0   2.206   1.283      0  24.885
-     1059254      0     0   2.215   1.293      0  24.840
-     1122018      0     0   2.237   1.304      0  24.795
-     1188502      0     0   2.254   1.318      0  24.749
-     1258925      0     0   2.268   1.332      0  24.703
-     1333521      0     0   2.285   1.346      0  24.658
-     1412538      0     0   2.303   1.357      0  24.623
-     1496236      0     0   2.314   1.371      0  24.592
-     1584893      0     0   2.333   1.383      0  24.544
-     1678804      0     0   2.354   1.402      0  24.498
-     1778279      0     0   2.366   1.415      0  24.459
-     1883649      0     0   2.388   1.426      0  24.411
-     1995262      0     0   2.407   1.435      0  24.367
-     2113489      0     0   2.417   1.451      0  24.324
-     2238721      0     0   2.434   1.464      0  24.292
-     2371374      0     0   2.448   1.481      0  24.247
-     2511886      0     0   2.467   1.494      0  24.212
-     2660725      0     0   2.486   1.511      0  24.176
-     2818383      0     0   2.499   1.522      0  24.141
-     2985383      0     0   2.521   1.541      0  24.100
-     3162278      0     0   2.541   1.556      0  24.056
-     3349654      0     0   2.564   1.572      0  24.010
-     3548134      0     0   2.584   1.589      0  23.966
-     3758374      0     0   2.603   1.610      0  23.929
-     3981072      0     0   2.624   1.633      0  23.896
-     4216965      0     0   2.646   1.645      0  23.859
-     4466836      0     0   2.668   1.656      0  23.822
-     4731513      0     0   2.688   1.681      0  23.792
-     5011872      0     0   2.714   1.702      0  23.741
-     5308844      0     0   2.739   1.724      0  23.701
-     5623413      0     0   2.757   1.747      0  23.659
-     5956621      0     0   2.783   1.766      0  23.619
-     6309573      0     0   2.806   1.785      0  23.568
-     6683439      0     0   2.830   1.805      0  23.533
-     7079458      0     0   2.873   1.838      0  23.488
-     7498942      0     0   2.891   1.861      0  23.440
-     7943282      0     0   2.911   1.880      0  23.395
-     8413951      0     0   2.936   1.904      0  23.344
-     8912509      0     0   2.962   1.928      0  23.296
-     9440609      0     0   2.983   1.950      0  23.243
-    10000000      0     0   3.010   1.981      0  23.191
-    10592537      0     0   3.039   2.016      0  23.139
-    11220185      0     0   3.070   2.043      0  23.082
-    11885022      0     0   3.096   2.068      0  23.025
-    12589254      0     0   3.121   2.092      0  22.965
-    13335214      0     0   3.144   2.124      0  22.904
-    14125375      0     0   3.165   2.148      0  22.842
-    14962357      0     0   3.191   2.176      0  22.777
-    15848932      0     0   3.212   2.209      0  22.712
-    16788040      0     0   3.284   2.226      0  22.637
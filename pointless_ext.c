@@ -41,6 +41,8 @@ static struct PyPointless_CAPI CAPI = {
 
 PyObject* pointless_write_object(PyObject* self, PyObject* args, PyObject* kwds);
 extern const char pointless_write_object_doc[];
+PyObject* pointless_write_object_async(PyObject* self, PyObject* args, PyObject* kwds);
+extern const char pointless_write_object_async_doc[];
 
 PyObject* pointless_write_object_to_primvector(PyObject* self, PyObject* args, PyObject* kwds);
 PyObject* pointless_write_object_to_bytearray(PyObject* self, PyObject* args, PyObject* kwds);
@@ -58,6 +60,7 @@ extern const char pointless_is_eq_doc[];
 static PyMethodDef pointless_module_methods[] =
 {
 	{"serialize",              (PyCFunction)pointless_write_object,               METH_VARARGS | METH_KEYWORDS, pointless_write_object_doc               },
+	{"serialize_async",        (PyCFunction)pointless_write_object_async,         METH_VARARGS | METH_KEYWORDS, pointless_write_object_async_doc         },
 	{"serialize_to_buffer",    (PyCFunction)pointless_write_object_to_primvector, METH_VARARGS | METH_KEYWORDS, pointless_write_object_to_buffer_doc     },
 	{"serialize_to_bytearray", (PyCFunction)pointless_write_object_to_bytearray,  METH_VARARGS | METH_KEYWORDS, pointless_write_object_to_buffer_doc     },
 	{"pyobject_hash",          (PyCFunction)pointless_pyobject_hash_32,           METH_VARARGS,                 pointless_pyobject_hash_32_doc           },
@@ -94,11 +97,6 @@ PyMODINIT_FUNC
 
 PyInit_pointless(void)
 {
-	if (sizeof(Word_t) != sizeof(void*)) {
-		PyErr_SetString(PyExc_ValueError, "word size mismatch");
-		MODULEINITERROR;
-	}
-
 	PyObject* module_pointless = 0;
 
 	module_pointless = PyModule_Create(&moduledef);
@@ -110,7 +108,7 @@ PyInit_pointless(void)
 	struct {
 		PyTypeObject* type;
 		const char* name;
-	} types[15] = {
+	} types[16] = {
 		{&PyPointlessType,                  "Pointless"                  },
 		{&PyPointlessVectorType,            "PointlessVector"            },
 		{&PyPointlessVectorIterType,        "PointlessVectorIter"        },
@@ -126,11 +124,12 @@ PyInit_pointless(void)
 		{&PyPointlessPrimVectorType,        "PointlessPrimVector"        },
 		{&PyPointlessPrimVectorIterType,    "PointlessPrimVectorIter"    },
 		{&PyPointlessPrimVectorRevIterType, "PointlessPrimVectorRevIter" },
+		{&PyPointlessSerializeFutureType,   "PointlessSerializeFuture"   },
 	};
 
 	int i;
 
-	for (i = 0; i < 15; i++) {
+	for (i = 0; i < 16; i++) {
 		if (PyType_Ready(types[i].type) < 0) {
 			Py_DECREF(module_pointless);
 			MODULEINITERROR;
@@ -16,6 +16,12 @@
 
 STATIC_ASSERT(Py_UNICODE_SIZE == 2 || Py_UNICODE_SIZE == 4, "Py_UNICODE_SIZE must be 2 or 4");
 
+// decoded string or unicode, and the string id it was decoded from
+typedef struct {
+	uint32_t id;
+	PyObject* value;
+} PyPointlessStringCacheEntry;
+
 typedef struct {
 	PyObject_HEAD
 	int is_open;
@@ -26,6 +32,14 @@ typedef struct {
 	Py_ssize_t n_map_refs;
 	Py_ssize_t n_set_refs;
 	pointless_t p;
+	// export held on the source object of a borrowed buffer
+	int is_borrowed;
+	Py_buffer borrowed;
+	// optional direct-mapped cache of decoded strings, slot is string id modulo string_cache_n
+	uint32_t string_cache_n;
+	PyPointlessStringCacheEntry* string_cache;
+	uint64_t string_cache_hits;
+	uint64_t string_cache_misses;
 } PyPointless;
 
 typedef struct {
@@ -162,7 +176,7 @@ PyObject* PyPointless_str(PyObject* py_object);
 PyObject* PyPointless_repr(PyObject* py_object);
 
 uint32_t pypointless_cmp_eq(pointless_t* p, pointless_complete_value_t* v, PyObject* py_object, const char** error);
-uint32_t pyobject_hash_32(PyObject* py_object, uint32_t version, const char** error);
+uint32_t pyobject_hash_32(PyObject* py_object, uint32_t features, const char** error);
 uint32_t pointless_pybitvector_hash_32(PyPointlessBitvector* bitvector);
 
 // custom types
@@ -181,6 +195,7 @@ extern PyTypeObject PyPointlessMapItemIterType;
 extern PyTypeObject PyPointlessPrimVectorType;
 extern PyTypeObject PyPointlessPrimVectorIterType;
 extern PyTypeObject PyPointlessPrimVectorRevIterType;
+extern PyTypeObject PyPointlessSerializeFutureType;
 
 #define PyPointless_Check(op) PyObject_TypeCheck(op, &PyPointlessType)
 #define PyPointlessVector_Check(op) PyObject_TypeCheck(op, &PyPointlessVectorType)
@@ -1,33 +1,139 @@
 #include "../pointless_ext.h"
 
+#include <pthread.h>
+
 typedef struct {
 	pointless_create_t c;   // create-time state
 	int is_error;           // true iff error, python exception is also set
 	int error_line;
-	Pvoid_t objects_used;   // PyObject* -> create-time-handle
+	pointless_ptr_table_t objects_used; // PyObject* -> create-time-handle
 	int unwiden_strings;    // true iff: we find the smallest representations for strings
 	int normalize_bitvector;
+
+	// the output points into memory borrowed from python objects, which is pinned until it is written: buffer exports
+	// of bytearrays and primitive vectors, and references to the Pointless objects values are recreated from,
+	// with copy_buffers, the bytearrays and primitive vectors are copied instead, so they can be changed right away
+	pointless_dynarray_t pinned_views;
+	pointless_dynarray_t pinned_objects;
+	pointless_dynarray_t copies;
+	int copy_buffers;
 } pointless_export_state_t;
 
-static uint32_t pointless_export_get_seen(pointless_export_state_t* state, PyObject* py_object)
+static void pointless_export_init(pointless_export_state_t* state)
 {
-	PWord_t handle = 0;
-	JLG(handle, state->objects_used, (Word_t)py_object);
-	return handle ? (uint32_t)(*handle) : POINTLESS_CREATE_VALUE_FAIL;
+	pointless_ptr_table_init(&state->objects_used);
+	pointless_dynarray_init(&state->pinned_views, sizeof(Py_buffer));
+	pointless_dynarray_init(&state->pinned_objects, sizeof(PyObject*));
+	pointless_dynarray_init(&state->copies, sizeof(void*));
+	state->copy_buffers = 0;
+	state->is_error = 0;
+	state->error_line = -1;
+	state->unwiden_strings = 0;
+	state->normalize_bitvector = 1;
 }
 
-static int pointless_export_set_seen(pointless_export_state_t* state, PyObject* py_object, uint32_t handle)
+// must be called with the GIL held
+static void pointless_export_destroy(pointless_export_state_t* state)
 {
-	PWord_t value = 0;
-	JLI(value, state->objects_used, (Word_t)py_object);
+	size_t i;
+
+	for (i = 0; i < pointless_dynarray_n_items(&state->pinned_views); i++)
+		PyBuffer_Release(&pointless_dynarray_ITEM_AT(Py_buffer, &state->pinned_views, i));
+
+	for (i = 0; i < pointless_dynarray_n_items(&state->pinned_objects); i++)
+		Py_DECREF(pointless_dynarray_ITEM_AT(PyObject*, &state->pinned_objects, i));
+
+	for (i = 0; i < pointless_dynarray_n_items(&state->copies); i++)
+		pointless_free(pointless_dynarray_ITEM_AT(void*, &state->copies, i));
+
+	pointless_ptr_table_destroy(&state->objects_used);
+	pointless_dynarray_destroy(&state->pinned_views);
+	pointless_dynarray_destroy(&state->pinned_objects);
+	pointless_dynarray_destroy(&state->copies);
+}
+
+// the memory of a bytearray or primitive vector, which can not be resized until the export state is destroyed,
+// or a copy of it, with copy_buffers
+static int pointless_export_pin_buffer(pointless_export_state_t* state, PyObject* py_object, void** buf)
+{
+	Py_buffer view;
+
+	if (PyObject_GetBuffer(py_object, &view, PyBUF_SIMPLE) != 0) {
+		state->is_error = 1;
+		state->error_line = __LINE__;
+		return 0;
+	}
+
+	if (state->copy_buffers) {
+		void* copy = pointless_malloc(view.len > 0 ? (size_t)view.len : 1);
 
-	if (value == 0)
+		if (copy == 0 || !pointless_dynarray_push(&state->copies, &copy)) {
+			pointless_free(copy);
+			PyBuffer_Release(&view);
+			PyErr_NoMemory();
+			state->is_error = 1;
+			state->error_line = __LINE__;
+			return 0;
+		}
+
+		memcpy(copy, view.buf, (size_t)view.len);
+		PyBuffer_Release(&view);
+		*buf = copy;
+		return 1;
+	}
+
+	if (!pointless_dynarray_push(&state->pinned_views, &view)) {
+		PyBuffer_Release(&view);
+		PyErr_NoMemory();
+		state->is_error = 1;
+		state->error_line = __LINE__;
 		return 0;
+	}
 
-	*value = (Word_t)handle;
+	*buf = view.buf;
 	return 1;
 }
 
+// the GIL is only released for the output when no bytearray or primitive vector memory is borrowed, pinning
+// only keeps them from being resized, so other threads could otherwise change them in place while it is written
+static PyThreadState* pointless_export_release_gil(pointless_export_state_t* state)
+{
+	if (pointless_dynarray_n_items(&state->pinned_views) > 0)
+		return 0;
+
+	return PyEval_SaveThread();
+}
+
+static void pointless_export_acquire_gil(PyThreadState* thread_state)
+{
+	if (thread_state)
+		PyEval_RestoreThread(thread_state);
+}
+
+static int pointless_export_pin_object(pointless_export_state_t* state, PyObject* py_object)
+{
+	if (!pointless_dynarray_push(&state->pinned_objects, &py_object)) {
+		PyErr_NoMemory();
+		state->is_error = 1;
+		state->error_line = __LINE__;
+		return 0;
+	}
+
+	Py_INCREF(py_object);
+	return 1;
+}
+
+static uint32_t pointless_export_get_seen(pointless_export_state_t* state, PyObject* py_object)
+{
+	uint32_t handle = pointless_ptr_table_get(&state->objects_used, py_object);
+	return (handle != POINTLESS_OPEN_TABLE_MISSING) ? handle : POINTLESS_CREATE_VALUE_FAIL;
+}
+
+static int pointless_export_set_seen(pointless_export_state_t* state, PyObject* py_object, uint32_t handle)
+{
+	return pointless_ptr_table_set(&state->objects_used, py_object, handle);
+}
+
 static uint32_t pointless_export_py_rec(pointless_export_state_t* state, PyObject* py_object, uint32_t depth)
 {
 	// don't go too deep
@@ -144,6 +250,9 @@ static uint32_t pointless_export_py_rec(pointless_export_state_t* state, PyObjec
 		PyPointlessVector* v = (PyPointlessVector*)py_object;
 		const char* error = 0;
 
+		if (!pointless_export_pin_object(state, (PyObject*)v->pp))
+			return POINTLESS_CREATE_VALUE_FAIL;
+
 		switch(v->v.type) {
 			case POINTLESS_VECTOR_VALUE:
 			case POINTLESS_VECTOR_VALUE_HASHABLE:
@@ -212,7 +321,12 @@ static uint32_t pointless_export_py_rec(pointless_export_state_t* state, PyObjec
 			return POINTLESS_CREATE_VALUE_FAIL;
 		}
 
-		handle = pointless_create_vector_u8_owner(&state->c, (uint8_t*)PyByteArray_AsString(py_object), (uint32_t)n_items);
+		void* data = 0;
+
+		if (!pointless_export_pin_buffer(state, py_object, &data))
+			return POINTLESS_CREATE_VALUE_FAIL;
+
+		handle = pointless_create_vector_u8_owner(&state->c, (uint8_t*)data, (uint32_t)n_items);
 		RETURN_OOM_IF_FAIL(handle, state);
 
 		if (!pointless_export_set_seen(state, py_object, handle)) {
@@ -224,7 +338,10 @@ static uint32_t pointless_export_py_rec(pointless_export_state_t* state, PyObjec
 		// we just hand over the memory
 		PyPointlessPrimVector* prim_vector = (PyPointlessPrimVector*)py_object;
 		uint32_t n_items = pointless_dynarray_n_items(&prim_vector->array);
-		void* data = prim_vector->array._data;
+		void* data = 0;
+
+		if (!pointless_export_pin_buffer(state, py_object, &data))
+			return POINTLESS_CREATE_VALUE_FAIL;
 
 		switch (prim_vector->type) {
 			case POINTLESS_PRIM_VECTOR_TYPE_I8:
@@ -311,9 +428,9 @@ static uint32_t pointless_export_py_rec(pointless_export_state_t* state, PyObjec
 				break;
 			case PyUnicode_4BYTE_KIND:
 				if (state->unwiden_strings && pointless_is_ucs4_ascii((uint32_t*)python_buffer))
-					handle = pointless_create_unicode_ucs4(&state->c, (uint32_t*)python_buffer);
-				else
 					handle = pointless_create_string_ucs4(&state->c, (uint32_t*)python_buffer);
+				else
+					handle = pointless_create_unicode_ucs4(&state->c, (uint32_t*)python_buffer);
 				break;
 			// will happen for PyUnicode_WCHAR_KIND on python versions < 3.12
 			default:
@@ -443,6 +560,10 @@ static uint32_t pointless_export_py_rec(pointless_export_state_t* state, PyObjec
 	} else if (PyPointlessSet_Check(py_object)) {
 		PyPointlessSet* set = (PyPointlessSet*)py_object;
 		const char* error = 0;
+
+		if (!pointless_export_pin_object(state, (PyObject*)set->pp))
+			return POINTLESS_CREATE_VALUE_FAIL;
+
 		handle = pointless_recreate_value(&set->pp->p, &set->v, &state->c, &error);
 
 		if (handle == POINTLESS_CREATE_VALUE_FAIL) {
@@ -459,6 +580,10 @@ static uint32_t pointless_export_py_rec(pointless_export_state_t* state, PyObjec
 	} else if (PyPointlessMap_Check(py_object)) {
 		PyPointlessMap* map = (PyPointlessMap*)py_object;
 		const char* error = 0;
+
+		if (!pointless_export_pin_object(state, (PyObject*)map->pp))
+			return POINTLESS_CREATE_VALUE_FAIL;
+
 		handle = pointless_recreate_value(&map->pp->p, &map->v, &state->c, &error);
 
 		if (handle == POINTLESS_CREATE_VALUE_FAIL) {
@@ -493,68 +618,343 @@ static void pointless_export_py(pointless_export_state_t* state, PyObject* py_ob
 		pointless_create_set_root(&state->c, root);
 }
 
-const char pointless_write_object_doc[] =
-"0\n"
-"pointless.serialize_to_file(object, fname)\n"
-"\n"
-"Serializes the object to a file.\n"
-"\n"
-"  object: the object\n"
-"  fname:  the file name\n"
-;
-PyObject* pointless_write_object(PyObject* self, PyObject* args, PyObject* kwds)
+// each of checksums, interleaved, mphf, fasthash, hash_slots and utf8 turns on one file format feature, and nothing else
+static int pointless_export_begin(pointless_export_state_t* state, PyObject* checksums, PyObject* interleaved, PyObject* mphf, PyObject* fasthash, PyObject* hash_slots, PyObject* utf8, unsigned int n_threads, const char* spill_dir, Py_ssize_t file_backing)
+{
+	const char* error = 0;
+	uint32_t features = 0;
+
+	if (checksums == Py_True)
+		features |= POINTLESS_FF_FEATURE_CHECKSUM;
+
+	if (interleaved == Py_True)
+		features |= POINTLESS_FF_FEATURE_INTERLEAVED;
+
+	if (mphf == Py_True)
+		features |= POINTLESS_FF_FEATURE_MPHF;
+
+	if (fasthash == Py_True)
+		features |= POINTLESS_FF_FEATURE_FASTHASH;
+
+	if (hash_slots == Py_True)
+		features |= POINTLESS_FF_FEATURE_HASH_SLOTS;
+
+	if (utf8 == Py_True)
+		features |= POINTLESS_FF_FEATURE_UTF8;
+
+	// files without any of them stay readable by older versions
+	if (features == 0) {
+		pointless_create_begin_64(&state->c);
+	} else if (!pointless_create_begin_64_features(&state->c, features, &error)) {
+		if ((features & POINTLESS_FF_FEATURE_INTERLEAVED) && (features & POINTLESS_FF_FEATURE_MPHF))
+			PyErr_SetString(PyExc_ValueError, "interleaved and mphf can not be combined");
+		else
+			PyErr_Format(PyExc_ValueError, "pointless_create_begin_64_features: %s", error);
+
+		return 0;
+	}
+
+	pointless_create_begin_parallel(&state->c, n_threads);
+
+	if (spill_dir && !pointless_create_begin_spill(&state->c, spill_dir, &error)) {
+		PyErr_Format(PyExc_IOError, "pointless_create_begin_spill: %s", error);
+		return 0;
+	}
+
+	if (file_backing >= 0) {
+		if (!pointless_create_begin_file_backing(&state->c, spill_dir, (size_t)file_backing, &error)) {
+			PyErr_Format(PyExc_IOError, "pointless_create_begin_file_backing: %s", error);
+			return 0;
+		}
+
+		pointless_dynarray_set_backing(&state->objects_used.entries, state->c.backing);
+	}
+
+	return 1;
+}
+
+// a serialization which finishes on a thread of its own, it owns the export state and its pinned memory
+typedef struct {
+	PyObject_HEAD
+	pointless_export_state_t state;
+	char* fname;
+	pthread_t thread;
+	pthread_mutex_t join_lock;
+	int is_started; // the thread has been started, and not yet joined
+	int is_done;    // set by the thread once the output is written
+	int is_pinned;  // the export state has not been destroyed
+	int is_ok;
+	const char* error;
+} PyPointlessSerializeFuture;
+
+static PyPointlessSerializeFuture* PyPointlessSerializeFuture_New()
+{
+	PyPointlessSerializeFuture* future = PyObject_New(PyPointlessSerializeFuture, &PyPointlessSerializeFutureType);
+
+	if (future == 0)
+		return 0;
+
+	if (pthread_mutex_init(&future->join_lock, 0) != 0) {
+		PyObject_Del(future);
+		PyErr_SetString(PyExc_OSError, "pthread_mutex_init() failure");
+		return 0;
+	}
+
+	pointless_export_init(&future->state);
+	future->fname = 0;
+	future->is_started = 0;
+	future->is_done = 0;
+	future->is_pinned = 1;
+	future->is_ok = 0;
+	future->error = 0;
+
+	return future;
+}
+
+static void* PyPointlessSerializeFuture_thread(void* user)
+{
+	PyPointlessSerializeFuture* future = (PyPointlessSerializeFuture*)user;
+	future->is_ok = pointless_create_output_and_end_f(&future->state.c, future->fname, &future->error);
+	__sync_fetch_and_add(&future->is_done, 1);
+	return 0;
+}
+
+// waits for the thread without the GIL, then releases the pinned memory
+static void PyPointlessSerializeFuture_join(PyPointlessSerializeFuture* self)
+{
+	Py_BEGIN_ALLOW_THREADS
+	pthread_mutex_lock(&self->join_lock);
+
+	if (self->is_started) {
+		pthread_join(self->thread, 0);
+		self->is_started = 0;
+	}
+
+	pthread_mutex_unlock(&self->join_lock);
+	Py_END_ALLOW_THREADS
+
+	if (self->is_pinned) {
+		pointless_export_destroy(&self->state);
+		self->is_pinned = 0;
+	}
+}
+
+static void PyPointlessSerializeFuture_dealloc(PyPointlessSerializeFuture* self)
+{
+	PyPointlessSerializeFuture_join(self);
+	pthread_mutex_destroy(&self->join_lock);
+	pointless_free(self->fname);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* PyPointlessSerializeFuture_done(PyPointlessSerializeFuture* self)
+{
+	if (__sync_fetch_and_add(&self->is_done, 0) == 0)
+		Py_RETURN_FALSE;
+
+	// the thread has finished, so this does not block
+	PyPointlessSerializeFuture_join(self);
+	Py_RETURN_TRUE;
+}
+
+static PyObject* PyPointlessSerializeFuture_result(PyPointlessSerializeFuture* self)
+{
+	PyPointlessSerializeFuture_join(self);
+
+	if (!self->is_ok) {
+		PyErr_Format(PyExc_IOError, "pointless_create_output: %s", self->error);
+		return 0;
+	}
+
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyMethodDef PyPointlessSerializeFuture_methods[] = {
+	{"done",   (PyCFunction)PyPointlessSerializeFuture_done,   METH_NOARGS, "true iff the file has been written, or writing it failed"},
+	{"result", (PyCFunction)PyPointlessSerializeFuture_result, METH_NOARGS, "waits for the file to be written, raises IOError on failure"},
+	{NULL, NULL}
+};
+
+PyTypeObject PyPointlessSerializeFutureType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"pointless.PyPointlessSerializeFuture",          /*tp_name*/
+	sizeof(PyPointlessSerializeFuture),              /*tp_basicsize*/
+	0,                                               /*tp_itemsize*/
+	(destructor)PyPointlessSerializeFuture_dealloc,  /*tp_dealloc*/
+	0,                                               /*tp_print*/
+	0,                                               /*tp_getattr*/
+	0,                                               /*tp_setattr*/
+	0,                                               /*tp_compare*/
+	0,                                               /*tp_repr*/
+	0,                                               /*tp_as_number*/
+	0,                                               /*tp_as_sequence*/
+	0,                                               /*tp_as_mapping*/
+	0,                                               /*tp_hash */
+	0,                                               /*tp_call*/
+	0,                                               /*tp_str*/
+	PyObject_GenericGetAttr,                         /*tp_getattro*/
+	0,                                               /*tp_setattro*/
+	0,                                               /*tp_as_buffer*/
+	Py_TPFLAGS_DEFAULT,                              /*tp_flags*/
+	"PyPointlessSerializeFuture",                    /*tp_doc */
+	0,                                               /*tp_traverse */
+	0,                                               /*tp_clear */
+	0,                                               /*tp_richcompare */
+	0,                                               /*tp_weaklistoffset */
+	0,                                               /*tp_iter */
+	0,                                               /*tp_iternext */
+	PyPointlessSerializeFuture_methods,              /*tp_methods */
+};
+
+static PyObject* pointless_write_object_f(int is_async, PyObject* self, PyObject* args, PyObject* kwds)
 {
 	const char* fname = 0;
 	PyObject* object = 0;
 	PyObject* retval = 0;
 	PyObject* normalize_bitvector = Py_True;
 	PyObject* unwiden_strings = Py_False;
+	PyObject* checksums = Py_False;
+	PyObject* interleaved = Py_False;
+	PyObject* mphf = Py_False;
+	PyObject* fasthash = Py_False;
+	PyObject* hash_slots = Py_False;
+	PyObject* utf8 = Py_False;
+	unsigned int n_threads = 1;
+	const char* spill_dir = 0;
+	Py_ssize_t file_backing = -1;
 	int create_end = 0;
+	int is_ok = 0;
 
 	const char* error = 0;
 
-	pointless_export_state_t state;
-	state.objects_used = 0;
-	state.is_error = 0;
-	state.error_line = -1;
-	state.unwiden_strings = 0;
-	state.normalize_bitvector = 1;
+	pointless_export_state_t local_state;
+	pointless_export_state_t* state = &local_state;
+	PyPointlessSerializeFuture* future = 0;
 
-	static char* kwargs[] = {"object", "filename", "unwiden_strings", "normalize_bitvector", 0};
+	static char* kwargs[] = {"object", "filename", "unwiden_strings", "normalize_bitvector", "checksums", "interleaved", "mphf", "fasthash", "hash_slots", "utf8", "n_threads", "spill_dir", "file_backing", 0};
 
-	if (!PyArg_ParseTupleAndKeywords(args, kwds, "Os|O!O!:serialize", kwargs, &object, &fname, &PyBool_Type, &unwiden_strings, &PyBool_Type, &normalize_bitvector))
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, is_async ? "Os|O!O!O!O!O!O!O!O!Izn:serialize_async" : "Os|O!O!O!O!O!O!O!O!Izn:serialize", kwargs, &object, &fname, &PyBool_Type, &unwiden_strings, &PyBool_Type, &normalize_bitvector, &PyBool_Type, &checksums, &PyBool_Type, &interleaved, &PyBool_Type, &mphf, &PyBool_Type, &fasthash, &PyBool_Type, &hash_slots, &PyBool_Type, &utf8, &n_threads, &spill_dir, &file_backing))
 		return 0;
 
-	state.unwiden_strings = (unwiden_strings == Py_True);
-	state.normalize_bitvector = (normalize_bitvector == Py_True);
+	if (is_async) {
+		future = PyPointlessSerializeFuture_New();
 
-	pointless_create_begin_64(&state.c);
+		if (future == 0)
+			return 0;
 
-	pointless_export_py(&state, object);
+		future->fname = pointless_strdup(fname);
 
-	if (state.is_error)
+		if (future->fname == 0) {
+			Py_DECREF(future);
+			return PyErr_NoMemory();
+		}
+
+		state = &future->state;
+		state->copy_buffers = 1;
+	} else {
+		pointless_export_init(state);
+	}
+
+	state->unwiden_strings = (unwiden_strings == Py_True);
+	state->normalize_bitvector = (normalize_bitvector == Py_True);
+
+	create_end = 1;
+
+	if (!pointless_export_begin(state, checksums, interleaved, mphf, fasthash, hash_slots, utf8, n_threads, spill_dir, file_backing))
 		goto cleanup;
 
+	pointless_export_py(state, object);
+
+	if (state->is_error)
+		goto cleanup;
+
+	if (is_async) {
+		if (pthread_create(&future->thread, 0, PyPointlessSerializeFuture_thread, future) != 0) {
+			PyErr_SetString(PyExc_OSError, "pthread_create() failure");
+			goto cleanup;
+		}
+
+		future->is_started = 1;
+		create_end = 0;
+
+		retval = (PyObject*)future;
+		future = 0;
+		goto cleanup;
+	}
+
 	create_end = 0;
 
-	if (!pointless_create_output_and_end_f(&state.c, fname, &error)) {
+	// nothing below touches python objects, but other threads could change borrowed buffers in place while it runs
+	PyThreadState* thread_state = pointless_export_release_gil(state);
+	is_ok = pointless_create_output_and_end_f(&state->c, fname, &error);
+	pointless_export_acquire_gil(thread_state);
+
+	if (!is_ok) {
 		PyErr_Format(PyExc_IOError, "pointless_create_output: %s", error);
 		goto cleanup;
 	}
 
+	Py_INCREF(Py_None);
 	retval = Py_None;
 
 cleanup:
 
 	if (create_end)
-		pointless_create_end(&state.c);
+		pointless_create_end(&state->c);
 
-	JudyLFreeArray(&state.objects_used, 0);
+	if (is_async)
+		Py_XDECREF(future);
+	else
+		pointless_export_destroy(state);
 
-	Py_XINCREF(retval);
 	return retval;
 }
 
+const char pointless_write_object_doc[] =
+"0\n"
+"pointless.serialize_to_file(object, fname)\n"
+"\n"
+"Serializes the object to a file.\n"
+"\n"
+"  object:      the object\n"
+"  fname:       the file name\n"
+"  checksums:   store section checksums, see Pointless.VerifyChecksums()\n"
+"  interleaved: store the hash, key and value of each set/map bucket together\n"
+"  mphf:        place the keys of each set/map with a minimal perfect hash, leaving no empty buckets,\n"
+"               can not be combined with interleaved\n"
+"  fasthash:    hash strings with the faster v2 string hash\n"
+"  hash_slots:  store the hash of each string, and of each vector within a set/map key, so hashing\n"
+"               them and telling unequal ones apart is constant time\n"
+"  utf8:        store unicode strings as utf-8 instead of ucs-4\n"
+"               each of the above only turns on itself, and any of them gives a file of version 3\n"
+"  n_threads:   build the set/map hash tables on this many threads, the output does not depend on it\n"
+"  spill_dir:   keep string and bitvector data in a temporary file in this directory instead of in memory,\n"
+"               the output does not depend on it\n"
+"  file_backing: keep create-time arrays and tables larger than this many bytes in memory mapped temporary\n"
+"               files in spill_dir, or in $TMPDIR, so they can be paged out, the output does not depend on it\n"
+;
+PyObject* pointless_write_object(PyObject* self, PyObject* args, PyObject* kwds)
+{
+	return pointless_write_object_f(0, self, args, kwds);
+}
+
+const char pointless_write_object_async_doc[] =
+"0\n"
+"pointless.serialize_async(object, fname)\n"
+"\n"
+"Serializes the object to a file like pointless.serialize(), and takes the same arguments. The object is\n"
+"exported before this returns, and the file is then written on a thread of its own, without the GIL.\n"
+"Returns a handle, whose done() tells if the file has been written, and whose result() waits for it,\n"
+"raising IOError if writing it failed.\n"
+"\n"
+"Bytearrays and primitive vectors in the object are copied, so they can be changed as soon as this returns.\n"
+;
+PyObject* pointless_write_object_async(PyObject* self, PyObject* args, PyObject* kwds)
+{
+	return pointless_write_object_f(1, self, args, kwds);
+}
+
 
 const char pointless_write_object_to_buffer_doc[] =
 "0\n"
@@ -562,38 +962,83 @@ const char pointless_write_object_to_buffer_doc[] =
 "\n"
 "Serializes the object to a buffer.\n"
 "\n"
-"  object: the object\n"
+"  object:      the object\n"
+"  checksums:   store section checksums, see Pointless.VerifyChecksums()\n"
+"  interleaved: store the hash, key and value of each set/map bucket together\n"
+"  mphf:        place the keys of each set/map with a minimal perfect hash, leaving no empty buckets,\n"
+"               can not be combined with interleaved\n"
+"  fasthash:    hash strings with the faster v2 string hash\n"
+"  hash_slots:  store the hash of each string, and of each vector within a set/map key, so hashing\n"
+"               them and telling unequal ones apart is constant time\n"
+"  utf8:        store unicode strings as utf-8 instead of ucs-4\n"
+"               each of the above only turns on itself, and any of them gives a file of version 3\n"
+"  n_threads:   build the set/map hash tables on this many threads, the output does not depend on it\n"
+"  spill_dir:   keep string and bitvector data in a temporary file in this directory instead of in memory,\n"
+"               the output does not depend on it\n"
+"  file_backing: keep create-time arrays and tables larger than this many bytes in memory mapped temporary\n"
+"               files in spill_dir, or in $TMPDIR, so they can be paged out, the output does not depend on it\n"
 ;
 
+// called once the size of the output is known, with or without the GIL, the output is then written straight into the bytearray
+static void* pointless_write_object_bytearray_alloc(size_t n_bytes, void* user)
+{
+	PyObject** bytearray = (PyObject**)user;
+	void* buf = 0;
+
+	if (n_bytes > PY_SSIZE_T_MAX)
+		return 0;
+
+	PyGILState_STATE gil = PyGILState_Ensure();
+	*bytearray = PyByteArray_FromStringAndSize(0, (Py_ssize_t)n_bytes);
+
+	if (*bytearray)
+		buf = PyByteArray_AS_STRING(*bytearray);
+
+	PyGILState_Release(gil);
+
+	return buf;
+}
+
 static PyObject* pointless_write_object_to(int buffer_type, PyObject* self, PyObject* args, PyObject* kwds)
 {
 	PyObject* object = 0;
 	PyObject* retval = 0;
 	PyObject* normalize_bitvector = Py_True;
 	PyObject* unwiden_strings = Py_False;
+	PyObject* checksums = Py_False;
+	PyObject* interleaved = Py_False;
+	PyObject* mphf = Py_False;
+	PyObject* fasthash = Py_False;
+	PyObject* hash_slots = Py_False;
+	PyObject* utf8 = Py_False;
+	unsigned int n_threads = 1;
+	const char* spill_dir = 0;
+	Py_ssize_t file_backing = -1;
 	int create_end = 0;
 
 	void* buf = 0;
 	size_t buflen = 0;
+	PyObject* bytearray = 0;
+
+	int is_ok = 0;
 
 	const char* error = 0;
 
 	pointless_export_state_t state;
-	state.objects_used = 0;
-	state.is_error = 0;
-	state.error_line = -1;
-	state.unwiden_strings = 0;
-	state.normalize_bitvector = 1;
+	pointless_export_init(&state);
 
-	static char* kwargs[] = {"object", "unwiden_strings", "normalize_bitvector", 0};
+	static char* kwargs[] = {"object", "unwiden_strings", "normalize_bitvector", "checksums", "interleaved", "mphf", "fasthash", "hash_slots", "utf8", "n_threads", "spill_dir", "file_backing", 0};
 
-	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O!O!:serialize", kwargs, &object, &PyBool_Type, &unwiden_strings, &PyBool_Type, &normalize_bitvector))
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O!O!O!O!O!O!O!O!Izn:serialize", kwargs, &object, &PyBool_Type, &unwiden_strings, &PyBool_Type, &normalize_bitvector, &PyBool_Type, &checksums, &PyBool_Type, &interleaved, &PyBool_Type, &mphf, &PyBool_Type, &fasthash, &PyBool_Type, &hash_slots, &PyBool_Type, &utf8, &n_threads, &spill_dir, &file_backing))
 		return 0;
 
 	state.unwiden_strings = (unwiden_strings == Py_True);
 	state.normalize_bitvector = (normalize_bitvector == Py_True);
 
-	pointless_create_begin_64(&state.c);
+	create_end = 1;
+
+	if (!pointless_export_begin(&state, checksums, interleaved, mphf, fasthash, hash_slots, utf8, n_threads, spill_dir, file_backing))
+		goto cleanup;
 
 	pointless_export_py(&state, object);
 
@@ -602,22 +1047,35 @@ static PyObject* pointless_write_object_to(int buffer_type, PyObject* self, PyOb
 
 	create_end = 0;
 
-	if (!pointless_create_output_and_end_b(&state.c, &buf, &buflen, &error)) {
+	// the output is written once, into the storage of what is returned
+	PyThreadState* thread_state = pointless_export_release_gil(&state);
+
+	if (buffer_type == 0)
+		is_ok = pointless_create_output_and_end_b(&state.c, &buf, &buflen, &error);
+	else
+		is_ok = pointless_create_output_and_end_a(&state.c, pointless_write_object_bytearray_alloc, &bytearray, &buf, &buflen, &error);
+
+	pointless_export_acquire_gil(thread_state);
+
+	if (!is_ok) {
 		PyErr_Format(PyExc_IOError, "pointless_create_output: %s", error);
 		goto cleanup;
 	}
 
-	if (buffer_type == 0)
+	if (buffer_type == 0) {
 		retval = (PyObject*)PyPointlessPrimVector_from_buffer(buf, buflen);
-	else
-		retval = (PyObject*)PyByteArray_FromStringAndSize(buf, buflen);
+	} else {
+		retval = bytearray;
+		bytearray = 0;
+	}
 
 cleanup:
 
 	if (create_end)
 		pointless_create_end(&state.c);
 
-	JudyLFreeArray(&state.objects_used, 0);
+	pointless_export_destroy(&state);
+	Py_XDECREF(bytearray);
 
 	return retval;
 }
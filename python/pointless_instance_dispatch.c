@@ -49,6 +49,12 @@ PyObject* pypointless_float(PyPointless* p, float f)
 
 PyObject* pypointless_value_unicode(pointless_t* p, pointless_value_t* v)
 {
+	// validation allows surrogates, as does Python
+	if (v->type == POINTLESS_UNICODE_UTF8) {
+		uint8_t* utf8 = pointless_reader_unicode_value_utf8(p, v);
+		return PyUnicode_DecodeUTF8((const char*)utf8, (Py_ssize_t)pointless_reader_unicode_utf8_len(p, v), "surrogatepass");
+	}
+
 	Py_ssize_t unicode_len = (Py_ssize_t)pointless_reader_unicode_len(p, v);
 	uint32_t* unicode_ucs4 = pointless_reader_unicode_value_ucs4(p, v);
 	return PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, (uint32_t*)unicode_ucs4, unicode_len);
@@ -60,8 +66,57 @@ PyObject* pypointless_value_string(pointless_t* p, pointless_value_t* v)
 	return PyUnicode_FromKindAndData(PyUnicode_1BYTE_KIND , (const char*)string_ascii, strlen((const char*)string_ascii));
 }
 
+static PyObject* pypointless_value_string_cached(PyPointless* p, pointless_value_t* v)
+{
+	// cache is allocated on first use, when the number of strings is known
+	if (p->string_cache == 0) {
+		if (p->string_cache_n > p->p.header->n_string_unicode)
+			p->string_cache_n = p->p.header->n_string_unicode;
+
+		p->string_cache = (PyPointlessStringCacheEntry*)pointless_calloc(p->string_cache_n, sizeof(PyPointlessStringCacheEntry));
+
+		if (p->string_cache == 0)
+			return PyErr_NoMemory();
+	}
+
+	PyPointlessStringCacheEntry* e = &p->string_cache[v->data.data_u32 % p->string_cache_n];
+
+	if (e->value && e->id == v->data.data_u32) {
+		p->string_cache_hits += 1;
+		Py_INCREF(e->value);
+		return e->value;
+	}
+
+	p->string_cache_misses += 1;
+
+	PyObject* value = (v->type == POINTLESS_STRING_) ? pypointless_value_string(&p->p, v) : pypointless_value_unicode(&p->p, v);
+
+	if (value == 0)
+		return 0;
+
+	// evicts whichever string had the slot before
+	Py_XDECREF(e->value);
+	Py_INCREF(value);
+	e->id = v->data.data_u32;
+	e->value = value;
+
+	return value;
+}
+
 PyObject* pypointless_value(PyPointless* p, pointless_value_t* v)
 {
+	// no-op, unless the file was opened with lazy validation
+	const char* error = 0;
+
+	if (!pointless_validate_lazy(&p->p, v, &error)) {
+		PyErr_Format(PyExc_ValueError, "pointless validation error: %s", error);
+		return 0;
+	}
+
+	// strings and unicodes are shared through the cache, if enabled
+	if (p->string_cache_n > 0 && (v->type == POINTLESS_STRING_ || v->type == POINTLESS_UNICODE_ || v->type == POINTLESS_UNICODE_UTF8))
+		return pypointless_value_string_cached(p, v);
+
 	// create the actual value
 	switch (v->type) {
 		case POINTLESS_VECTOR_VALUE:
@@ -82,6 +137,7 @@ PyObject* pypointless_value(PyPointless* p, pointless_value_t* v)
 			return pypointless_value_string(&p->p, v);
 
 		case POINTLESS_UNICODE_:
+		case POINTLESS_UNICODE_UTF8:
 			return pypointless_value_unicode(&p->p, v);
 
 		case POINTLESS_BITVECTOR:
@@ -202,7 +202,7 @@ static uint32_t PyPointlessMap_eq_cb(pointless_t* p, pointless_complete_value_t*
 static int PyPointlessMap_contains_(PyPointlessMap* m, PyObject* key)
 {
 	const char* error = 0;
-	uint32_t hash = pyobject_hash_32(key, m->pp->p.header->version, &error);
+	uint32_t hash = pyobject_hash_32(key, m->pp->p.features, &error);
 
 	if (error) {
 		PyErr_Format(PyExc_ValueError, "pointless hash error: %s", error);
@@ -282,7 +282,7 @@ static PyMemberDef PyPointlessMap_memberlist[] = {
 static PyObject* PyPointlessMap_subscript(PyPointlessMap* m, PyObject* key)
 {
 	const char* error = 0;
-	uint32_t hash = pyobject_hash_32(key, m->pp->p.header->version, &error);
+	uint32_t hash = pyobject_hash_32(key, m->pp->p.features, &error);
 
 	if (error) {
 		PyErr_Format(PyExc_ValueError, "pointless hash error: %s", error);
@@ -322,7 +322,7 @@ static PyObject* PyPointlessMap_get(PyPointlessMap* m, PyObject* args)
 		return NULL;
 
 	const char* error = 0;
-	uint32_t hash = pyobject_hash_32(key, m->pp->p.header->version, &error);
+	uint32_t hash = pyobject_hash_32(key, m->pp->p.features, &error);
 
 	if (error) {
 		PyErr_Format(PyExc_ValueError, "pointless hash error: %s", error);
@@ -347,11 +347,99 @@ static PyObject* PyPointlessMap_get(PyPointlessMap* m, PyObject* args)
 	return pypointless_value(m->pp, v);
 }
 
+static PyObject* PyPointlessMap_get_many(PyPointlessMap* m, PyObject* args)
+{
+	PyObject* keys;
+	PyObject* failobj = Py_None;
+
+	if (!PyArg_UnpackTuple(args, "get_many", 1, 2, &keys, &failobj))
+		return NULL;
+
+	PyObject* seq = PySequence_Fast(keys, "keys must be iterable");
+
+	if (seq == 0)
+		return 0;
+
+	PyObject* retval = 0;
+	Py_ssize_t i, n = PySequence_Fast_GET_SIZE(seq);
+	PyObject** items = PySequence_Fast_ITEMS(seq);
+
+	uint32_t* hashes = 0;
+	pointless_value_t** kk = 0;
+	pointless_value_t** vv = 0;
+
+	const char* error = 0;
+
+	if (n > UINT32_MAX) {
+		PyErr_SetString(PyExc_ValueError, "too many keys");
+		goto cleanup;
+	}
+
+	hashes = (uint32_t*)PyMem_Malloc(sizeof(uint32_t) * n);
+	kk = (pointless_value_t**)PyMem_Malloc(sizeof(pointless_value_t*) * n);
+	vv = (pointless_value_t**)PyMem_Malloc(sizeof(pointless_value_t*) * n);
+
+	if (hashes == 0 || kk == 0 || vv == 0) {
+		PyErr_NoMemory();
+		goto cleanup;
+	}
+
+	// all keys are hashed before any lookups
+	for (i = 0; i < n; i++) {
+		hashes[i] = pyobject_hash_32(items[i], m->pp->p.features, &error);
+
+		if (error) {
+			PyErr_Format(PyExc_ValueError, "pointless hash error: %s", error);
+			goto cleanup;
+		}
+	}
+
+	pointless_reader_map_lookup_batch_ext(&m->pp->p, &m->v, hashes, PyPointlessMap_eq_cb, (void**)items, (uint32_t)n, kk, vv, &error);
+
+	if (error) {
+		PyErr_Format(PyExc_ValueError, "pointless map query error: %s", error);
+		goto cleanup;
+	}
+
+	retval = PyList_New(n);
+
+	if (retval == 0)
+		goto cleanup;
+
+	for (i = 0; i < n; i++) {
+		PyObject* v = 0;
+
+		if (vv[i] == 0) {
+			Py_INCREF(failobj);
+			v = failobj;
+		} else {
+			v = pypointless_value(m->pp, vv[i]);
+		}
+
+		if (v == 0) {
+			Py_DECREF(retval);
+			retval = 0;
+			goto cleanup;
+		}
+
+		PyList_SET_ITEM(retval, i, v);
+	}
+
+cleanup:
+
+	PyMem_Free(hashes);
+	PyMem_Free(kk);
+	PyMem_Free(vv);
+	Py_DECREF(seq);
+
+	return retval;
+}
 
 static PyMethodDef PyPointlessMap_methods[] = {
 	{"__contains__", (PyCFunction)PyPointlessMap_contains,    METH_O | METH_COEXIST, ""},
 	{"__getitem__",  (PyCFunction)PyPointlessMap_subscript,   METH_O | METH_COEXIST, ""},
 	{"get",          (PyCFunction)PyPointlessMap_get,         METH_VARARGS, ""},
+	{"get_many",     (PyCFunction)PyPointlessMap_get_many,    METH_VARARGS, ""},
 	{"keys",         (PyCFunction)PyPointlessMap_keys,        METH_NOARGS, ""},
 	{"values",       (PyCFunction)PyPointlessMap_values,      METH_NOARGS, ""},
 	{"items",        (PyCFunction)PyPointlessMap_items,       METH_NOARGS, ""},
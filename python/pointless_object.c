@@ -1,7 +1,34 @@
 #include "../pointless_ext.h"
 
+static void PyPointless_release_borrowed(PyPointless* self)
+{
+	if (self->is_borrowed) {
+		PyBuffer_Release(&self->borrowed);
+		self->is_borrowed = 0;
+	}
+}
+
+static void PyPointless_clear_string_cache(PyPointless* self)
+{
+	uint32_t i;
+
+	if (self->string_cache) {
+		for (i = 0; i < self->string_cache_n; i++)
+			Py_XDECREF(self->string_cache[i].value);
+
+		pointless_free(self->string_cache);
+		self->string_cache = 0;
+	}
+
+	self->string_cache_n = 0;
+	self->string_cache_hits = 0;
+	self->string_cache_misses = 0;
+}
+
 static void PyPointless_dealloc(PyPointless* self)
 {
+	PyPointless_clear_string_cache(self);
+
 	if (self->is_open) {
 		Py_BEGIN_ALLOW_THREADS
 		pointless_close(&self->p);
@@ -9,6 +36,8 @@ static void PyPointless_dealloc(PyPointless* self)
 		self->is_open = 0;
 	}
 
+	PyPointless_release_borrowed(self);
+
 	self->allow_print = 0;
 
 	if (self->n_root_refs != 0 ||
@@ -41,6 +70,11 @@ static PyObject* PyPointless_new(PyTypeObject* type, PyObject* args, PyObject* k
 	if (self) {
 		self->allow_print = 0;
 		self->is_open = 0;
+		self->is_borrowed = 0;
+		self->string_cache_n = 0;
+		self->string_cache = 0;
+		self->string_cache_hits = 0;
+		self->string_cache_misses = 0;
 		self->n_root_refs = 0;
 		self->n_vector_refs = 0;
 		self->n_bitvector_refs = 0;
@@ -105,9 +139,93 @@ static PyObject* PyPointless_GetRefs(PyPointless* self)
 	);
 }
 
+static PyObject* PyPointless_GetStringCacheStats(PyPointless* self)
+{
+	// slots are only filled once a string is decoded into them
+	uint32_t i, n_entries = 0;
+
+	if (self->string_cache) {
+		for (i = 0; i < self->string_cache_n; i++)
+			n_entries += (self->string_cache[i].value != 0);
+	}
+
+	return Py_BuildValue("{s:I,s:K,s:K}",
+		"n_entries", (unsigned int)n_entries,
+		"n_hits", (unsigned long long)self->string_cache_hits,
+		"n_misses", (unsigned long long)self->string_cache_misses
+	);
+}
+
+static PyObject* PyPointless_VerifyChecksums(PyPointless* self, PyObject* args, PyObject* kwds)
+{
+	unsigned int n_threads = 1;
+	const char* error = 0;
+
+	static char* kwargs[] = {"n_threads", 0};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|I:VerifyChecksums", kwargs, &n_threads))
+		return 0;
+
+	if (!pointless_checksum_verify(&self->p, n_threads, &error)) {
+		PyErr_Format(PyExc_ValueError, "pointless checksum error: %s", error);
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject* PyPointless_prefetch(PyPointless* self, PyObject* args, PyObject* kwds)
+{
+	PyObject* obj = Py_None;
+	unsigned int max_depth = POINTLESS_MAX_DEPTH;
+	PyObject* background = Py_False;
+	pointless_value_t* v = 0;
+	PyPointless* pp = 0;
+	const char* error = 0;
+	int i = 0;
+
+	static char* kwargs[] = {"obj", "max_depth", "background", 0};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|OIO!:prefetch", kwargs, &obj, &max_depth, &PyBool_Type, &background))
+		return 0;
+
+	if (obj == Py_None) {
+		pp = self;
+		v = &self->p.header->root;
+	} else if (PyPointlessVector_Check(obj)) {
+		pp = ((PyPointlessVector*)obj)->pp;
+		v = &((PyPointlessVector*)obj)->v;
+	} else if (PyPointlessMap_Check(obj)) {
+		pp = ((PyPointlessMap*)obj)->pp;
+		v = &((PyPointlessMap*)obj)->v;
+	} else if (PyPointlessSet_Check(obj)) {
+		pp = ((PyPointlessSet*)obj)->pp;
+		v = &((PyPointlessSet*)obj)->v;
+	} else if (PyPointlessBitvector_Check(obj) && ((PyPointlessBitvector*)obj)->is_pointless) {
+		pp = ((PyPointlessBitvector*)obj)->pp;
+		v = &((PyPointlessBitvector*)obj)->v;
+	}
+
+	if (pp != self) {
+		PyErr_SetString(PyExc_ValueError, "obj must be None, or a vector, map, set or bitvector from this pointless object");
+		return 0;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	i = pointless_prefetch(&self->p, v, max_depth, (background == Py_True) ? POINTLESS_PREFETCH_ASYNC : 0, &error);
+	Py_END_ALLOW_THREADS
+
+	if (!i) {
+		PyErr_Format(PyExc_ValueError, "pointless prefetch error: %s", error);
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
 static PyObject* PyPointless_sizeof(PyPointless* self)
 {
-	if (self->p.fd == 0)
+	if (self->p.fd_ptr == 0)
 		return PyLong_FromUnsignedLongLong(sizeof(PyPointless) + self->p.buflen);
 	else
 		return PyLong_FromUnsignedLongLong(sizeof(PyPointless) + self->p.fd_len);
@@ -119,6 +237,9 @@ static PyMethodDef PyPointless_methods[] = {
 	{"GetINode",   (PyCFunction)PyPointless_GetINode,  METH_NOARGS, "get inode of file descriptor" },
 	{"GetFileNo",  (PyCFunction)PyPointless_GetFileNo, METH_NOARGS, "get file descriptor" },
 	{"GetRefs",    (PyCFunction)PyPointless_GetRefs,   METH_NOARGS, "get inside-reference count to base object" },
+	{"GetStringCacheStats", (PyCFunction)PyPointless_GetStringCacheStats, METH_NOARGS, "get size, hits and misses of the decoded string cache" },
+	{"prefetch",   (PyCFunction)PyPointless_prefetch, METH_VARARGS | METH_KEYWORDS, "prefetch the file pages of obj, or the root, and everything below it" },
+	{"VerifyChecksums", (PyCFunction)PyPointless_VerifyChecksums, METH_VARARGS | METH_KEYWORDS, "verify section checksums, optionally on n_threads threads" },
 	{NULL}
 };
 
@@ -140,6 +261,9 @@ static int PyPointless_init(PyPointless* self, PyObject* args, PyObject* kwds)
 		self->is_open = 0;
 	}
 
+	PyPointless_release_borrowed(self);
+	PyPointless_clear_string_cache(self);
+
 	self->allow_print = 1;
 
 	if (self->n_root_refs != 0 ||
@@ -162,15 +286,136 @@ static int PyPointless_init(PyPointless* self, PyObject* args, PyObject* kwds)
 
 	PyObject* allow_print = Py_True;
 	PyObject* validate = Py_True;
-	static char* kwargs[] = {"filename_or_buffer", "allow_print", "validate", 0};
-
-	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O!O!", kwargs, &fname_or_buffer, &PyBool_Type, &allow_print, &PyBool_Type, &validate))
+	unsigned int validate_threads = 1;
+	PyObject* borrow = Py_False;
+	unsigned long long offset = 0;
+	unsigned long long length = 0;
+	PyObject* populate = Py_False;
+	const char* advice = 0;
+	PyObject* lock = Py_False;
+	PyObject* hugepages = Py_False;
+	unsigned int string_cache = 0;
+	static char* kwargs[] = {"filename_or_buffer", "allow_print", "validate", "validate_threads", "borrow", "offset", "length", "populate", "advice", "lock", "hugepages", "string_cache", 0};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O!OIO!KKO!zO!O!I", kwargs, &fname_or_buffer, &PyBool_Type, &allow_print, &validate, &validate_threads, &PyBool_Type, &borrow, &offset, &length, &PyBool_Type, &populate, &advice, &PyBool_Type, &lock, &PyBool_Type, &hugepages, &string_cache))
 		return -1;
 
+	// maximum number of decoded strings kept alive, 0 disables the cache
+	self->string_cache_n = (uint32_t)string_cache;
+
 	if (allow_print == Py_False)
 		self->allow_print = 0;
 
-	int do_validate = (validate == Py_True);
+	// validate is either a boolean, 'lazy' for on-first-touch validation, or 'certified' to trust a sidecar certificate
+	int validate_mode = POINTLESS_VALIDATE_FULL;
+
+	if (validate == Py_False) {
+		validate_mode = POINTLESS_VALIDATE_SKIP;
+	} else if (PyUnicode_Check(validate) && PyUnicode_CompareWithASCIIString(validate, "lazy") == 0) {
+		validate_mode = POINTLESS_VALIDATE_LAZY;
+	} else if (PyUnicode_Check(validate) && PyUnicode_CompareWithASCIIString(validate, "certified") == 0) {
+		validate_mode = POINTLESS_VALIDATE_CERTIFIED;
+	} else if (validate != Py_True) {
+		PyErr_SetString(PyExc_ValueError, "validate must be True, False, 'lazy' or 'certified'");
+		return -1;
+	}
+
+	if (validate_threads > POINTLESS_PARALLEL_MAX_THREADS) {
+		PyErr_Format(PyExc_ValueError, "validate_threads must be at most %i", POINTLESS_PARALLEL_MAX_THREADS);
+		return -1;
+	}
+
+	// threads are only used by full validation, which 'certified' falls back to without a matching certificate
+	if (validate_threads != 1 && (validate_mode == POINTLESS_VALIDATE_SKIP || validate_mode == POINTLESS_VALIDATE_LAZY)) {
+		PyErr_SetString(PyExc_ValueError, "validate_threads requires validate to be True or 'certified'");
+		return -1;
+	}
+
+	// residency options only apply to files, buffers are already in memory
+	pointless_open_options_t options;
+	pointless_open_options_init(&options);
+	options.validate_mode = validate_mode;
+	options.validate_threads = validate_threads;
+	options.populate = (populate == Py_True);
+	options.lock = (lock == Py_True);
+	options.hugepage_load = (hugepages == Py_True);
+
+	if (advice == 0 || strcmp(advice, "normal") == 0) {
+		options.advice = POINTLESS_ADVICE_NORMAL;
+	} else if (strcmp(advice, "willneed") == 0) {
+		options.advice = POINTLESS_ADVICE_WILLNEED;
+	} else if (strcmp(advice, "random") == 0) {
+		options.advice = POINTLESS_ADVICE_RANDOM;
+	} else if (strcmp(advice, "sequential") == 0) {
+		options.advice = POINTLESS_ADVICE_SEQUENTIAL;
+	} else {
+		PyErr_SetString(PyExc_ValueError, "advice must be None, 'normal', 'willneed', 'random' or 'sequential'");
+		return -1;
+	}
+
+	// a file descriptor, with an optional window into the file
+	if (PyLong_Check(fname_or_buffer) && !PyBool_Check(fname_or_buffer)) {
+		int fd = (int)PyLong_AsLong(fname_or_buffer);
+
+		if (fd == -1 && PyErr_Occurred())
+			return -1;
+
+		Py_BEGIN_ALLOW_THREADS
+		i = pointless_open_fd_options(&self->p, fd, (uint64_t)offset, (uint64_t)length, &options, &error);
+		Py_END_ALLOW_THREADS
+
+		if (!i) {
+			PyErr_Format(PyExc_IOError, "error opening file descriptor %i: %s", fd, error);
+			return -1;
+		}
+
+		self->is_open = 1;
+		return 0;
+	}
+
+	// files are mapped, not copied, so borrowing only applies to buffers
+	if (borrow == Py_True && !PyUnicode_Check(fname_or_buffer)) {
+		if (populate == Py_True || advice != 0 || lock == Py_True || hugepages == Py_True) {
+			PyErr_SetString(PyExc_ValueError, "populate, advice, lock and hugepages do not apply to borrowed buffers");
+			return -1;
+		}
+
+		if (PyPointlessPrimVector_Check(fname_or_buffer) && ((PyPointlessPrimVector*)fname_or_buffer)->type != POINTLESS_PRIM_VECTOR_TYPE_U8) {
+			PyErr_SetString(PyExc_ValueError, "buffer must be primvector with uint8");
+			return -1;
+		}
+
+		if (PyObject_GetBuffer(fname_or_buffer, &self->borrowed, PyBUF_SIMPLE) != 0)
+			return -1;
+
+		self->is_borrowed = 1;
+
+		// the reader needs 8-byte alignment, and writable buffers could change under it after validation
+		if (((uintptr_t)self->borrowed.buf) % 8 != 0 || !self->borrowed.readonly) {
+			PyPointless_release_borrowed(self);
+			PyErr_SetString(PyExc_ValueError, "borrowed buffers must be read-only and 8-byte aligned, e.g. bytes");
+			return -1;
+		}
+
+		if (validate_mode == POINTLESS_VALIDATE_CERTIFIED) {
+			PyPointless_release_borrowed(self);
+			PyErr_SetString(PyExc_ValueError, "certified validation requires a filename");
+			return -1;
+		}
+
+		Py_BEGIN_ALLOW_THREADS
+		i = pointless_open_b_borrow(&self->p, self->borrowed.buf, (size_t)self->borrowed.len, validate_mode, validate_threads, &error);
+		Py_END_ALLOW_THREADS
+
+		if (!i) {
+			PyPointless_release_borrowed(self);
+			PyErr_Format(PyExc_IOError, "error parsing file from buffer: %s", error);
+			return -1;
+		}
+
+		self->is_open = 1;
+		return 0;
+	}
 
 	if (PyUnicode_Check(fname_or_buffer)) {
 		string_of_unicode = PyUnicode_AsLatin1String(fname_or_buffer);
@@ -194,22 +439,32 @@ static int PyPointless_init(PyPointless* self, PyObject* args, PyObject* kwds)
 		buf = PyByteArray_AS_STRING(fname_or_buffer);
 		buflen = (size_t)PyByteArray_GET_SIZE(fname_or_buffer);
 	} else {
-		PyErr_SetString(PyExc_ValueError, "filename_or_buffer must be string/unicode/bytearray/primvector-with-uint-8");
+		PyErr_SetString(PyExc_ValueError, "filename_or_buffer must be string/unicode/file-descriptor/bytearray/primvector-with-uint-8");
+		return -1;
+	}
+
+	if (validate_mode == POINTLESS_VALIDATE_CERTIFIED && fname_ == 0) {
+		PyErr_SetString(PyExc_ValueError, "certified validation requires a filename");
+		Py_XDECREF(string_of_unicode);
 		return -1;
 	}
 
 	Py_BEGIN_ALLOW_THREADS
 
-	if (do_validate) {
-		if (fname_)
-			i = pointless_open_f(&self->p, fname_, &error);
-		else
-			i = pointless_open_b(&self->p, buf, buflen, &error);
+	if (fname_) {
+		i = pointless_open_f_options(&self->p, fname_, &options, &error);
 	} else {
-		if (fname_)
-			i = pointless_open_f_skip_validate(&self->p, fname_, &error);
-		else
-			i = pointless_open_b_skip_validate(&self->p, buf, buflen, &error);
+		switch (validate_mode) {
+			case POINTLESS_VALIDATE_FULL:
+				i = pointless_open_b_parallel_validate(&self->p, buf, buflen, validate_threads, &error);
+				break;
+			case POINTLESS_VALIDATE_LAZY:
+				i = pointless_open_b_lazy_validate(&self->p, buf, buflen, &error);
+				break;
+			default:
+				i = pointless_open_b_skip_validate(&self->p, buf, buflen, &error);
+				break;
+		}
 	}
 
 	Py_END_ALLOW_THREADS
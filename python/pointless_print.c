@@ -103,6 +103,12 @@ static int _pypointless_str_rec(pointless_t* p, pointless_complete_value_t* v, _
 {
 	// convert value
 	pointless_value_t _v = pointless_value_from_complete(v);
+	const char* error = 0;
+
+	if (!pointless_validate_lazy(p, &_v, &error)) {
+		PyErr_Format(PyExc_ValueError, "pointless validation error: %s", error);
+		return 0;
+	}
 
 	// both compressible types
 	if (pointless_is_vector_type(v->type))
@@ -116,6 +122,7 @@ static int _pypointless_str_rec(pointless_t* p, pointless_complete_value_t* v, _
 
 	switch (v->type) {
 		case POINTLESS_UNICODE_:
+		case POINTLESS_UNICODE_UTF8:
 			return _pypointless_unicode_str(p, &_v, state);
 		case POINTLESS_STRING_:
 			return _pypointless_string_str(p, &_v, state);
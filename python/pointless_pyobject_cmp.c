@@ -123,6 +123,14 @@ static pypointless_cmp_cb pypointless_cmp_func(pypointless_cmp_value_t* v, uint3
 	if (v->is_pointless) {
 		*type = v->value.pointless.v.type;
 
+		// 64-bit values are always inline, everything else may need lazy validation
+		if (*type != POINTLESS_I64 && *type != POINTLESS_U64) {
+			pointless_value_t _v = pointless_value_from_complete(&v->value.pointless.v);
+
+			if (!pointless_validate_lazy(v->value.pointless.p, &_v, &state->error))
+				return 0;
+		}
+
 		switch (*type) {
 			case POINTLESS_I32:
 			case POINTLESS_U32:
@@ -133,6 +141,7 @@ static pypointless_cmp_cb pypointless_cmp_func(pypointless_cmp_value_t* v, uint3
 				return pypointless_cmp_none;
 			case POINTLESS_STRING_:
 			case POINTLESS_UNICODE_:
+			case POINTLESS_UNICODE_UTF8:
 				return pypointless_cmp_string_unicode;
 			case POINTLESS_SET_VALUE:
 			case POINTLESS_MAP_VALUE_VALUE:
@@ -221,8 +230,9 @@ typedef struct {
 		uint32_t* string_32;
 		uint16_t* string_16;
 		uint8_t* string_8;
+		uint8_t* string_utf8;
 	} string;
-	uint8_t n_bits;
+	uint8_t n_bits; // 0 for utf-8
 } _var_string_t;
 
 static _var_string_t pypointless_cmp_extract_string(pypointless_cmp_value_t* v, pypointless_cmp_state_t* state)
@@ -235,6 +245,9 @@ static _var_string_t pypointless_cmp_extract_string(pypointless_cmp_value_t* v,
 		if (v_.type == POINTLESS_UNICODE_) {
 			s.n_bits = 32;
 			s.string.string_32 = pointless_reader_unicode_value_ucs4(v->value.pointless.p, &v_);
+		} else if (v_.type == POINTLESS_UNICODE_UTF8) {
+			s.n_bits = 0;
+			s.string.string_utf8 = pointless_reader_unicode_value_utf8(v->value.pointless.p, &v_);
 		} else {
 			s.n_bits = 8;
 			s.string.string_8 = pointless_reader_string_value_ascii(v->value.pointless.p, &v_);
@@ -277,8 +290,24 @@ static int32_t pypointless_cmp_string_unicode(pypointless_cmp_value_t* a, pypoin
 	if (state->error)
 		return 0;
 
-	assert(s_a.n_bits == 8 || s_a.n_bits == 16 || s_a.n_bits == 32);
-	assert(s_b.n_bits == 8 || s_b.n_bits == 16 || s_b.n_bits == 32);
+	assert(s_a.n_bits == 0 || s_a.n_bits == 8 || s_a.n_bits == 16 || s_a.n_bits == 32);
+	assert(s_b.n_bits == 0 || s_b.n_bits == 8 || s_b.n_bits == 16 || s_b.n_bits == 32);
+
+	// utf-8 against anything
+	if (s_a.n_bits == 0 && s_b.n_bits == 0)
+		return pointless_cmp_string_utf8_utf8(s_a.string.string_utf8, s_b.string.string_utf8);
+	if (s_a.n_bits == 0 && s_b.n_bits == 8)
+		return pointless_cmp_string_utf8_8(s_a.string.string_utf8, s_b.string.string_8);
+	if (s_a.n_bits == 0 && s_b.n_bits == 16)
+		return pointless_cmp_string_utf8_16(s_a.string.string_utf8, s_b.string.string_16);
+	if (s_a.n_bits == 0 && s_b.n_bits == 32)
+		return pointless_cmp_string_utf8_32(s_a.string.string_utf8, s_b.string.string_32);
+	if (s_a.n_bits == 8 && s_b.n_bits == 0)
+		return -pointless_cmp_string_utf8_8(s_b.string.string_utf8, s_a.string.string_8);
+	if (s_a.n_bits == 16 && s_b.n_bits == 0)
+		return -pointless_cmp_string_utf8_16(s_b.string.string_utf8, s_a.string.string_16);
+	if (s_a.n_bits == 32 && s_b.n_bits == 0)
+		return -pointless_cmp_string_utf8_32(s_b.string.string_utf8, s_a.string.string_32);
 
 	if (s_a.n_bits == 8 && s_b.n_bits == 8)
 		return pointless_cmp_string_8_8(s_a.string.string_8, s_b.string.string_8);
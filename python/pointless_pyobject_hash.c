@@ -1,7 +1,7 @@
 #include "../pointless_ext.h"
 
 typedef struct {
-	uint32_t version;
+	uint32_t features;
 	uint32_t depth;
 	const char** error;
 } pyobject_hash_state_t;
@@ -36,6 +36,40 @@ static uint32_t pyobject_hash_tuple_32(PyObject* py_object, pyobject_hash_state_
 	return pointless_vector_hash_end_32(&v_state);
 }
 
+// a value vector from a file with another string hash, whose items are hashed again, as a tuple would be
+static uint32_t pyobject_hash_pointless_vector_32(PyPointlessVector* v, pyobject_hash_state_t* state)
+{
+	uint32_t h, i;
+	PyObject* o = 0;
+
+	pointless_vector_hash_state_32_t v_state;
+	pointless_vector_hash_init_32(&v_state, v->slice_n);
+
+	state->depth += 1;
+
+	for (i = 0; i < v->slice_n; i++) {
+		o = PySequence_GetItem((PyObject*)v, (Py_ssize_t)i);
+
+		if (o == 0) {
+			PyErr_Clear();
+			*state->error = "unable to read vector item";
+			break;
+		}
+
+		h = pyobject_hash_rec_32(o, state);
+		Py_DECREF(o);
+
+		if (*state->error)
+			break;
+
+		pointless_vector_hash_next_32(&v_state, h);
+	}
+
+	state->depth -= 1;
+
+	return pointless_vector_hash_end_32(&v_state);
+}
+
 static uint32_t pyobject_hash_primvector_32(PyPointlessPrimVector* v, pyobject_hash_state_t* state)
 {
 	uint64_t i;
@@ -90,7 +124,7 @@ static uint32_t pyobject_hash_primvector_32(PyPointlessPrimVector* v, pyobject_h
 static uint32_t pyobject_hash_unicode_32(PyObject* py_object, pyobject_hash_state_t* state)
 {
 	if (PyUnicode_READY(py_object) != 0) {
-		state->error = "PyUnicode_READY failed";
+		*state->error = "PyUnicode_READY failed";
 		PyErr_Clear();
 		return 0;
 
@@ -98,24 +132,38 @@ static uint32_t pyobject_hash_unicode_32(PyObject* py_object, pyobject_hash_stat
 
 	uint32_t hash = 0;
 
-	switch (state->version) {
-		case POINTLESS_FF_VERSION_OFFSET_32_NEWHASH:
-		case POINTLESS_FF_VERSION_OFFSET_64_NEWHASH:
-			switch (PyUnicode_KIND(py_object)) {
-				case PyUnicode_1BYTE_KIND:
-					hash = pointless_hash_string_v1_32((uint8_t*)PyUnicode_1BYTE_DATA(py_object));
-					break;
-				case PyUnicode_2BYTE_KIND:
-					hash = pointless_hash_unicode_ucs2_v1_32((uint16_t*)PyUnicode_2BYTE_DATA(py_object));
-					break;
-				case PyUnicode_4BYTE_KIND:
-					hash = pointless_hash_unicode_ucs4_v1_32((uint32_t*)PyUnicode_4BYTE_DATA(py_object));
-					break;
-				// will happen for PyUnicode_WCHAR_KIND on python versions < 3.12
-				default:
-					state->error = "hash statement fallthrough";
-					break;
-			}
+	if (!(state->features & POINTLESS_FF_FEATURE_FASTHASH)) {
+		switch (PyUnicode_KIND(py_object)) {
+			case PyUnicode_1BYTE_KIND:
+				hash = pointless_hash_string_v1_32((uint8_t*)PyUnicode_1BYTE_DATA(py_object));
+				break;
+			case PyUnicode_2BYTE_KIND:
+				hash = pointless_hash_unicode_ucs2_v1_32((uint16_t*)PyUnicode_2BYTE_DATA(py_object));
+				break;
+			case PyUnicode_4BYTE_KIND:
+				hash = pointless_hash_unicode_ucs4_v1_32((uint32_t*)PyUnicode_4BYTE_DATA(py_object));
+				break;
+			// will happen for PyUnicode_WCHAR_KIND on python versions < 3.12
+			default:
+				*state->error = "hash statement fallthrough";
+				break;
+		}
+	} else {
+		switch (PyUnicode_KIND(py_object)) {
+			case PyUnicode_1BYTE_KIND:
+				hash = pointless_hash_string_v2_32((uint8_t*)PyUnicode_1BYTE_DATA(py_object), PyUnicode_GET_LENGTH(py_object));
+				break;
+			case PyUnicode_2BYTE_KIND:
+				hash = pointless_hash_unicode_ucs2_v2_32((uint16_t*)PyUnicode_2BYTE_DATA(py_object), PyUnicode_GET_LENGTH(py_object));
+				break;
+			case PyUnicode_4BYTE_KIND:
+				hash = pointless_hash_unicode_ucs4_v2_32((uint32_t*)PyUnicode_4BYTE_DATA(py_object), PyUnicode_GET_LENGTH(py_object));
+				break;
+			// will happen for PyUnicode_WCHAR_KIND on python versions < 3.12
+			default:
+				*state->error = "hash statement fallthrough";
+				break;
+		}
 	}
 
 	return hash;
@@ -203,6 +251,10 @@ static uint32_t pyobject_hash_rec_32(PyObject* py_object, pyobject_hash_state_t*
 			return 0;
 		}
 
+		// strings are the only items whose hash depends on the file
+		if (v.type == POINTLESS_VECTOR_VALUE_HASHABLE && ((p->features ^ state->features) & POINTLESS_FF_FEATURE_FASTHASH))
+			return pyobject_hash_pointless_vector_32((PyPointlessVector*)py_object, state);
+
 		return pointless_hash_reader_vector_32(p, &v, ((PyPointlessVector*)py_object)->slice_i, ((PyPointlessVector*)py_object)->slice_n);
 	}
 
@@ -241,10 +293,10 @@ static uint32_t pyobject_hash_rec_32(PyObject* py_object, pyobject_hash_state_t*
 	return 0;
 }
 
-uint32_t pyobject_hash_32(PyObject* py_object, uint32_t version, const char** error)
+uint32_t pyobject_hash_32(PyObject* py_object, uint32_t features, const char** error)
 {
 	pyobject_hash_state_t state;
-	state.version = version;
+	state.features = features;
 	state.depth = 0;
 	state.error = error;
 	return pyobject_hash_rec_32(py_object, &state);
@@ -252,19 +304,23 @@ uint32_t pyobject_hash_32(PyObject* py_object, uint32_t version, const char** er
 
 const char pointless_pyobject_hash_32_doc[] =
 "1\n"
-"pointless.pyobject_hash(object)\n"
+"pointless.pyobject_hash(object, version, features)\n"
 "\n"
 "Return a pointless-consistent hash of a Python object.\n"
 "\n"
-"  object: the object\n"
+"  object:   the object\n"
+"  version:  the file format version whose hash is used, by default that of serialize() without\n"
+"            any format keywords\n"
+"  features: feature bits of a version 3 file, none by default, ignored for older versions\n"
 ;
 PyObject* pointless_pyobject_hash_32(PyObject* self, PyObject* args)
 {
 	PyObject* object = 0;
 	const char* error = 0;
-	int version = POINTLESS_FILE_FORMAT_LATEST_VERSION_;
+	int version = POINTLESS_FF_VERSION_OFFSET_64_NEWHASH;
+	unsigned int features = 0;
 
-	if (!PyArg_ParseTuple(args, "O|i:pyobject_hash", &object, &version))
+	if (!PyArg_ParseTuple(args, "O|iI:pyobject_hash", &object, &version, &features))
 		return 0;
 
 	if (!(POINTLESS_FILE_FORMAT_OLDEST_VERSION_ <= version && version <= POINTLESS_FILE_FORMAT_LATEST_VERSION_)) {
@@ -272,7 +328,15 @@ PyObject* pointless_pyobject_hash_32(PyObject* self, PyObject* args)
 		return 0;
 	}
 
-	uint32_t hash = pyobject_hash_32(object, version, &error);
+	if ((features & ~POINTLESS_FF_FEATURE_ALL_) != 0) {
+		PyErr_Format(PyExc_ValueError, "unsupported features");
+		return 0;
+	}
+
+	if (version == POINTLESS_FF_VERSION_OFFSET_64_FEATURES)
+		version |= (features << 16);
+
+	uint32_t hash = pyobject_hash_32(object, pointless_ff_version_features((uint32_t)version), &error);
 
 	if (error) {
 		PyErr_Format(PyExc_ValueError, "PyObject hashing error: %s", error);
@@ -299,6 +299,23 @@ static PyObject* PyPointlessVectorRevIter_iternext(PyPointlessVectorIter* iter)
 	return 0;
 }
 
+static int PyPointlessVector_hash_differs(PyPointlessVector* a, PyPointlessVector* b)
+{
+	uint32_t h_a, h_b;
+
+	if (a->slice_i != 0 || a->slice_n != pointless_reader_vector_n_items(&a->pp->p, &a->v))
+		return 0;
+
+	if (b->slice_i != 0 || b->slice_n != pointless_reader_vector_n_items(&b->pp->p, &b->v))
+		return 0;
+
+	// files with different string hashes store different hashes for equal vectors
+	if (!pointless_hash_reader_compatible(&a->pp->p, &b->pp->p))
+		return 0;
+
+	return (pointless_hash_reader_stored_32(&a->pp->p, &a->v, &h_a) && pointless_hash_reader_stored_32(&b->pp->p, &b->v, &h_b) && h_a != h_b);
+}
+
 static PyObject* PyPointlessVector_richcompare(PyObject* a, PyObject* b, int op)
 {
 	if (!PyPointlessVector_Check(a) || !PyPointlessVector_Check(b)) {
@@ -318,6 +335,14 @@ static PyObject* PyPointlessVector_richcompare(PyObject* a, PyObject* b, int op)
 			Py_RETURN_TRUE;
 	}
 
+	// whole vectors with different stored hashes are not equal
+	if ((op == Py_EQ || op == Py_NE) && PyPointlessVector_hash_differs((PyPointlessVector*)a, (PyPointlessVector*)b)) {
+		if (op == Py_EQ)
+			Py_RETURN_FALSE;
+		else
+			Py_RETURN_TRUE;
+	}
+
 	// first item where they differ
 	for (i = 0; i < n_items; i++) {
 		PyObject* obj_a = PyPointlessVector_subscript_priv((PyPointlessVector*)a, i);
@@ -17,3 +17,15 @@ unsigned char bm_is_set_(void* bitmask, uint64_t bit_index)
 	unsigned char* bit = (unsigned char*)bitmask + (bit_index / 8);
 	return (*bit & (1 << (bit_index % 8)));
 }
+
+void bm_set_atomic_(void* bitmask, uint64_t bit_index)
+{
+	unsigned char* bit = (unsigned char*)bitmask + (bit_index / 8);
+	__sync_fetch_and_or(bit, (unsigned char)(1 << (bit_index % 8)));
+}
+
+unsigned char bm_is_set_atomic_(void* bitmask, uint64_t bit_index)
+{
+	unsigned char* bit = (unsigned char*)bitmask + (bit_index / 8);
+	return (__atomic_load_n(bit, __ATOMIC_RELAXED) & (1 << (bit_index % 8)));
+}
@@ -0,0 +1,117 @@
+#include <pointless/pointless_arena.h>
+
+// regular blocks double in size from the first to the last, allocations above a quarter of that get a block of their own
+#define POINTLESS_ARENA_FIRST_BLOCK_SIZE (4 * 1024)
+#define POINTLESS_ARENA_LAST_BLOCK_SIZE (1024 * 1024)
+
+#define POINTLESS_ARENA_ROUND(n) (((n) + (POINTLESS_ARENA_ALIGN - 1)) & ~(size_t)(POINTLESS_ARENA_ALIGN - 1))
+#define POINTLESS_ARENA_HEADER POINTLESS_ARENA_ROUND(sizeof(pointless_arena_block_t))
+#define POINTLESS_ARENA_DATA(b) ((char*)(b) + POINTLESS_ARENA_HEADER)
+
+void pointless_arena_init(pointless_arena_t* a)
+{
+	a->head = 0;
+	a->block_size = POINTLESS_ARENA_FIRST_BLOCK_SIZE;
+	a->last_block = 0;
+	a->last_n_used = 0;
+}
+
+void pointless_arena_destroy(pointless_arena_t* a)
+{
+	while (a->head) {
+		pointless_arena_block_t* next = a->head->next;
+		pointless_free(a->head);
+		a->head = next;
+	}
+
+	pointless_arena_init(a);
+}
+
+static pointless_arena_block_t* pointless_arena_block(pointless_arena_t* a, size_t n_bytes)
+{
+	intop_sizet_t n_total = intop_sizet_add(intop_sizet_init(POINTLESS_ARENA_HEADER), intop_sizet_init(n_bytes));
+
+	if (n_total.is_overflow)
+		return 0;
+
+	pointless_arena_block_t* b = (pointless_arena_block_t*)pointless_malloc(n_total.value);
+
+	if (b == 0)
+		return 0;
+
+	b->next = 0;
+	b->n_bytes = n_bytes;
+	b->n_used = 0;
+
+	return b;
+}
+
+void* pointless_arena_alloc(pointless_arena_t* a, size_t n_bytes)
+{
+	pointless_arena_block_t* b = a->head;
+
+	// rounding up would wrap around for sizes near SIZE_MAX
+	if (intop_sizet_add(intop_sizet_init(n_bytes), intop_sizet_init(POINTLESS_ARENA_ALIGN - 1)).is_overflow)
+		return 0;
+
+	n_bytes = POINTLESS_ARENA_ROUND(n_bytes);
+
+	if (b == 0 || b->n_bytes - b->n_used < n_bytes) {
+		// big buffers go behind the head, so the space left in it is not lost
+		if (n_bytes > POINTLESS_ARENA_LAST_BLOCK_SIZE / 4) {
+			b = pointless_arena_block(a, n_bytes);
+
+			if (b == 0)
+				return 0;
+
+			if (a->head) {
+				b->next = a->head->next;
+				a->head->next = b;
+			} else {
+				a->head = b;
+			}
+		} else {
+			while (a->block_size < n_bytes)
+				a->block_size *= 2;
+
+			b = pointless_arena_block(a, a->block_size);
+
+			if (b == 0)
+				return 0;
+
+			if (a->block_size < POINTLESS_ARENA_LAST_BLOCK_SIZE)
+				a->block_size *= 2;
+
+			b->next = a->head;
+			a->head = b;
+		}
+	}
+
+	void* p = POINTLESS_ARENA_DATA(b) + b->n_used;
+
+	a->last_block = b;
+	a->last_n_used = b->n_used;
+	b->n_used += n_bytes;
+
+	return p;
+}
+
+void pointless_arena_rollback(pointless_arena_t* a, void* p)
+{
+	pointless_arena_block_t* b = a->last_block;
+
+	assert(b != 0 && p == POINTLESS_ARENA_DATA(b) + a->last_n_used);
+
+	b->n_used = a->last_n_used;
+
+	// a big buffer behind the head is released right away
+	if (b->n_used == 0 && b != a->head) {
+		assert(a->head->next == b);
+		a->head->next = b->next;
+		pointless_free(b);
+	}
+
+	a->last_block = 0;
+
+	(void)p;
+}
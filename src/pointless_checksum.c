@@ -0,0 +1,150 @@
+#include <pointless/pointless_checksum.h>
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+#define XXH_ROTL64(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+// the buffer may not be 8-byte aligned, memcpy() compiles down to a single load
+static uint64_t xxh_read64(const uint8_t* p)
+{
+	uint64_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t xxh_read32(const uint8_t* p)
+{
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint64_t xxh_round(uint64_t acc, uint64_t input)
+{
+	acc += input * XXH_PRIME64_2;
+	acc = XXH_ROTL64(acc, 31);
+	acc *= XXH_PRIME64_1;
+	return acc;
+}
+
+static uint64_t xxh_merge_round(uint64_t acc, uint64_t val)
+{
+	val = xxh_round(0, val);
+	acc ^= val;
+	acc = acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+	return acc;
+}
+
+// four independent lanes, which the compiler can keep in flight at once
+static const uint8_t* xxh_consume(uint64_t* v, const uint8_t* p, const uint8_t* limit)
+{
+	uint64_t v1 = v[0], v2 = v[1], v3 = v[2], v4 = v[3];
+
+	while (p + 32 <= limit) {
+		v1 = xxh_round(v1, xxh_read64(p)); p += 8;
+		v2 = xxh_round(v2, xxh_read64(p)); p += 8;
+		v3 = xxh_round(v3, xxh_read64(p)); p += 8;
+		v4 = xxh_round(v4, xxh_read64(p)); p += 8;
+	}
+
+	v[0] = v1; v[1] = v2; v[2] = v3; v[3] = v4;
+
+	return p;
+}
+
+void pointless_checksum_64_init(pointless_checksum_state_t* state, uint64_t seed)
+{
+	state->v[0] = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+	state->v[1] = seed + XXH_PRIME64_2;
+	state->v[2] = seed;
+	state->v[3] = seed - XXH_PRIME64_1;
+	state->seed = seed;
+	state->n_total = 0;
+	state->n_buffer = 0;
+}
+
+void pointless_checksum_64_update(pointless_checksum_state_t* state, const void* buffer, uint64_t n_bytes)
+{
+	const uint8_t* p = (const uint8_t*)buffer;
+	const uint8_t* end = p + n_bytes;
+
+	state->n_total += n_bytes;
+
+	// not enough for a full stripe, just buffer it
+	if (state->n_buffer + n_bytes < 32) {
+		memcpy(state->buffer + state->n_buffer, p, n_bytes);
+		state->n_buffer += (uint32_t)n_bytes;
+		return;
+	}
+
+	// complete the buffered stripe
+	if (state->n_buffer > 0) {
+		uint32_t n = 32 - state->n_buffer;
+		memcpy(state->buffer + state->n_buffer, p, n);
+		xxh_consume(state->v, state->buffer, state->buffer + 32);
+		state->n_buffer = 0;
+		p += n;
+	}
+
+	p = xxh_consume(state->v, p, end);
+
+	memcpy(state->buffer, p, end - p);
+	state->n_buffer = (uint32_t)(end - p);
+}
+
+uint64_t pointless_checksum_64_digest(pointless_checksum_state_t* state)
+{
+	const uint8_t* p = state->buffer;
+	const uint8_t* end = p + state->n_buffer;
+	uint64_t h;
+
+	if (state->n_total >= 32) {
+		h = XXH_ROTL64(state->v[0], 1) + XXH_ROTL64(state->v[1], 7) + XXH_ROTL64(state->v[2], 12) + XXH_ROTL64(state->v[3], 18);
+		h = xxh_merge_round(h, state->v[0]);
+		h = xxh_merge_round(h, state->v[1]);
+		h = xxh_merge_round(h, state->v[2]);
+		h = xxh_merge_round(h, state->v[3]);
+	} else {
+		h = state->seed + XXH_PRIME64_5;
+	}
+
+	h += state->n_total;
+
+	while (p + 8 <= end) {
+		h ^= xxh_round(0, xxh_read64(p));
+		h = XXH_ROTL64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+		p += 8;
+	}
+
+	if (p + 4 <= end) {
+		h ^= (uint64_t)xxh_read32(p) * XXH_PRIME64_1;
+		h = XXH_ROTL64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+		p += 4;
+	}
+
+	while (p < end) {
+		h ^= (*p) * XXH_PRIME64_5;
+		h = XXH_ROTL64(h, 11) * XXH_PRIME64_1;
+		p += 1;
+	}
+
+	h ^= h >> 33;
+	h *= XXH_PRIME64_2;
+	h ^= h >> 29;
+	h *= XXH_PRIME64_3;
+	h ^= h >> 32;
+
+	return h;
+}
+
+uint64_t pointless_checksum_64(const void* buffer, uint64_t n_bytes, uint64_t seed)
+{
+	pointless_checksum_state_t state;
+	pointless_checksum_64_init(&state, seed);
+	pointless_checksum_64_update(&state, buffer, n_bytes);
+	return pointless_checksum_64_digest(&state);
+}
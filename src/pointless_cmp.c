@@ -6,7 +6,6 @@ static int32_t pointless_cmp_create_rec_priv(pointless_create_t* c, pointless_co
 
 #define POINTLESS_CMP_STRING(a, b)         while ((uint32_t)(*(a)) == (uint32_t)(*(b))) { if (*(a) == 0) return 0; (a)++; (b)++;} return SIMPLE_CMP(*(a), *(b));
 #define POINTLESS_CMP_STRING__N(a, b, n_b)     \
-	size_t n_ = 0;                             \
 	while (*(a) && n_ < n_b && *(a) == *(b)) { \
 		(a)++; (b)++; n_++;                    \
 	}                                          \
@@ -15,29 +14,168 @@ static int32_t pointless_cmp_create_rec_priv(pointless_create_t* c, pointless_co
 	if (n_ == (n_b))           return 1;       \
 	return SIMPLE_CMP(*(a), *(b));
 
-int32_t pointless_cmp_string_8_8(uint8_t* a, uint8_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_8_16(uint8_t* a, uint16_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_8_32(uint8_t* a, uint32_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_16_8(uint16_t* a, uint8_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_16_16(uint16_t* a, uint16_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_16_32(uint16_t* a, uint32_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_32_8(uint32_t* a, uint8_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_32_16(uint32_t* a, uint16_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-int32_t pointless_cmp_string_32_32(uint32_t* a, uint32_t* b)
-	{ POINTLESS_CMP_STRING(a, b); }
-
-int32_t pointless_cmp_string_8_8_n(uint8_t* a, uint8_t* b, size_t n_b)
-	{ POINTLESS_CMP_STRING__N(a, b, n_b); }
-int32_t pointless_cmp_string_32_8_n(uint32_t* a, uint8_t* b, size_t n_b)
-	{ POINTLESS_CMP_STRING__N(a, b, n_b); }
+// the reads past the terminating zero are deliberate, so address sanitizer builds must not instrument the kernels and their loads
+#if defined(__GNUC__)
+#define POINTLESS_CMP_NO_ASAN __attribute__((no_sanitize_address))
+#else
+#define POINTLESS_CMP_NO_ASAN
+#endif
+
+// vector kernels compare a block of code points at a time, the narrower side is widened to w bits while loading
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define POINTLESS_CMP_SIMD_BYTES 32
+#define POINTLESS_CMP_SIMD_ALL 0xFFFFFFFFU
+typedef __m256i pointless_cmp_simd_t;
+#define pointless_cmp_simd_load_8_8(p)   _mm256_loadu_si256((const __m256i*)(p))
+#define pointless_cmp_simd_load_8_16(p)  _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(p)))
+#define pointless_cmp_simd_load_8_32(p)  _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(p)))
+#define pointless_cmp_simd_load_16_16(p) _mm256_loadu_si256((const __m256i*)(p))
+#define pointless_cmp_simd_load_16_32(p) _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(p)))
+#define pointless_cmp_simd_load_32_32(p) _mm256_loadu_si256((const __m256i*)(p))
+#define pointless_cmp_simd_eq_8(a, b)    _mm256_cmpeq_epi8(a, b)
+#define pointless_cmp_simd_eq_16(a, b)   _mm256_cmpeq_epi16(a, b)
+#define pointless_cmp_simd_eq_32(a, b)   _mm256_cmpeq_epi32(a, b)
+#define pointless_cmp_simd_zero()        _mm256_setzero_si256()
+#define pointless_cmp_simd_mask(a)       ((uint32_t)_mm256_movemask_epi8(a))
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define POINTLESS_CMP_SIMD_BYTES 16
+#define POINTLESS_CMP_SIMD_ALL 0xFFFFU
+typedef __m128i pointless_cmp_simd_t;
+#define pointless_cmp_simd_load_8_8(p)   _mm_loadu_si128((const __m128i*)(p))
+#define pointless_cmp_simd_load_8_16(p)  _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(p)), _mm_setzero_si128())
+#define pointless_cmp_simd_load_8_32(p)  pointless_cmp_simd_load_8_32_(p)
+#define pointless_cmp_simd_load_16_16(p) _mm_loadu_si128((const __m128i*)(p))
+#define pointless_cmp_simd_load_16_32(p) _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)(p)), _mm_setzero_si128())
+#define pointless_cmp_simd_load_32_32(p) _mm_loadu_si128((const __m128i*)(p))
+#define pointless_cmp_simd_eq_8(a, b)    _mm_cmpeq_epi8(a, b)
+#define pointless_cmp_simd_eq_16(a, b)   _mm_cmpeq_epi16(a, b)
+#define pointless_cmp_simd_eq_32(a, b)   _mm_cmpeq_epi32(a, b)
+#define pointless_cmp_simd_zero()        _mm_setzero_si128()
+#define pointless_cmp_simd_mask(a)       ((uint32_t)_mm_movemask_epi8(a))
+
+POINTLESS_CMP_NO_ASAN static inline __m128i pointless_cmp_simd_load_8_32_(const void* p)
+{
+	int32_t i;
+	memcpy(&i, p, sizeof(i));
+	return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(i), _mm_setzero_si128()), _mm_setzero_si128());
+}
+#endif
+
+#ifdef POINTLESS_CMP_SIMD_BYTES
+
+// loads may read past the terminating zero, but never into the next page, so they can not fault
+#define POINTLESS_CMP_PAGE_SAFE(p, n) ((((uintptr_t)(p)) & 4095) <= 4096 - (n))
+
+// a block is skipped if all code points are equal and none of them terminates a
+#define POINTLESS_CMP_SIMD_MISMATCH(a, b, w_a, w_b, w)                                                   \
+	pointless_cmp_simd_t a_ = pointless_cmp_simd_load_##w_a##_##w(a);                                    \
+	pointless_cmp_simd_t b_ = pointless_cmp_simd_load_##w_b##_##w(b);                                    \
+	uint32_t m_ = ~pointless_cmp_simd_mask(pointless_cmp_simd_eq_##w(a_, b_));                           \
+	m_ = (m_ | pointless_cmp_simd_mask(pointless_cmp_simd_eq_##w(a_, pointless_cmp_simd_zero()))) & POINTLESS_CMP_SIMD_ALL;
+
+#define POINTLESS_CMP_STRING_SIMD(a, b, w_a, w_b, w)                                                    \
+	for (;;) {                                                                                           \
+		if (POINTLESS_CMP_PAGE_SAFE(a, POINTLESS_CMP_SIMD_BYTES * w_a / w) &&                            \
+			POINTLESS_CMP_PAGE_SAFE(b, POINTLESS_CMP_SIMD_BYTES * w_b / w)) {                            \
+			POINTLESS_CMP_SIMD_MISMATCH(a, b, w_a, w_b, w)                                               \
+			if (m_ == 0) {                                                                               \
+				(a) += POINTLESS_CMP_SIMD_BYTES * 8 / w;                                                 \
+				(b) += POINTLESS_CMP_SIMD_BYTES * 8 / w;                                                 \
+				continue;                                                                                \
+			}                                                                                            \
+			size_t i_ = (size_t)__builtin_ctz(m_) / (w / 8);                                             \
+			return SIMPLE_CMP((uint32_t)(a)[i_], (uint32_t)(b)[i_]);                                     \
+		}                                                                                                \
+		if ((uint32_t)(*(a)) != (uint32_t)(*(b))) return SIMPLE_CMP((uint32_t)(*(a)), (uint32_t)(*(b))); \
+		if (*(a) == 0) return 0;                                                                         \
+		(a)++; (b)++;                                                                                    \
+	}
+
+// b is not terminated, so blocks must stay within its n_b code points
+#define POINTLESS_CMP_STRING_SIMD_N(a, b, n_b, w_a, w_b, w)                                             \
+	size_t n_ = 0;                                                                                       \
+	while (n_ + POINTLESS_CMP_SIMD_BYTES * 8 / w <= (n_b) &&                                             \
+		POINTLESS_CMP_PAGE_SAFE(a, POINTLESS_CMP_SIMD_BYTES * w_a / w)) {                                \
+		POINTLESS_CMP_SIMD_MISMATCH(a, b, w_a, w_b, w)                                                   \
+		if (m_ != 0) {                                                                                   \
+			size_t i_ = (size_t)__builtin_ctz(m_) / (w / 8);                                             \
+			if ((a)[i_] == 0) return -1;                                                                 \
+			return SIMPLE_CMP((uint32_t)(a)[i_], (uint32_t)(b)[i_]);                                     \
+		}                                                                                                \
+		(a) += POINTLESS_CMP_SIMD_BYTES * 8 / w;                                                         \
+		(b) += POINTLESS_CMP_SIMD_BYTES * 8 / w;                                                         \
+		n_ += POINTLESS_CMP_SIMD_BYTES * 8 / w;                                                          \
+	}                                                                                                    \
+	POINTLESS_CMP_STRING__N(a, b, n_b)
+
+#else
+
+#define POINTLESS_CMP_STRING_SIMD(a, b, w_a, w_b, w) POINTLESS_CMP_STRING(a, b)
+#define POINTLESS_CMP_STRING_SIMD_N(a, b, n_b, w_a, w_b, w) size_t n_ = 0; POINTLESS_CMP_STRING__N(a, b, n_b)
+
+#endif
+
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_8_8(uint8_t* a, uint8_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 8, 8, 8); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_8_16(uint8_t* a, uint16_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 8, 16, 16); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_8_32(uint8_t* a, uint32_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 8, 32, 32); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_16_8(uint16_t* a, uint8_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 16, 8, 16); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_16_16(uint16_t* a, uint16_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 16, 16, 16); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_16_32(uint16_t* a, uint32_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 16, 32, 32); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_32_8(uint32_t* a, uint8_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 32, 8, 32); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_32_16(uint32_t* a, uint16_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 32, 16, 32); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_32_32(uint32_t* a, uint32_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 32, 32, 32); }
+
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_8_8_n(uint8_t* a, uint8_t* b, size_t n_b)
+	{ POINTLESS_CMP_STRING_SIMD_N(a, b, n_b, 8, 8, 8); }
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_32_8_n(uint32_t* a, uint8_t* b, size_t n_b)
+	{ POINTLESS_CMP_STRING_SIMD_N(a, b, n_b, 32, 8, 32); }
+
+// utf-8 against fixed width code points, the utf-8 side is decoded as we go
+#define POINTLESS_CMP_STRING_UTF8(a, b) \
+	uint32_t c_a;                                               \
+	while ((c_a = pointless_utf8_next(&(a))) == (uint32_t)(*(b))) { \
+		if (c_a == 0) return 0;                                 \
+		(b)++;                                                  \
+	}                                                           \
+	return SIMPLE_CMP(c_a, (uint32_t)(*(b)));
+
+int32_t pointless_cmp_string_utf8_8(uint8_t* a, uint8_t* b)
+	{ POINTLESS_CMP_STRING_UTF8(a, b); }
+int32_t pointless_cmp_string_utf8_16(uint8_t* a, uint16_t* b)
+	{ POINTLESS_CMP_STRING_UTF8(a, b); }
+int32_t pointless_cmp_string_utf8_32(uint8_t* a, uint32_t* b)
+	{ POINTLESS_CMP_STRING_UTF8(a, b); }
+
+// utf-8 byte order is code point order
+POINTLESS_CMP_NO_ASAN int32_t pointless_cmp_string_utf8_utf8(uint8_t* a, uint8_t* b)
+	{ POINTLESS_CMP_STRING_SIMD(a, b, 8, 8, 8); }
+
+int32_t pointless_cmp_string_utf8_8_n(uint8_t* a, uint8_t* b, size_t n_b)
+{
+	size_t n_ = 0;
+	uint32_t c_a = pointless_utf8_next(&a);
+
+	while (c_a && n_ < n_b && c_a == b[n_]) {
+		c_a = pointless_utf8_next(&a);
+		n_++;
+	}
+
+	if (c_a == 0 && n_ == n_b) return 0;
+	if (c_a == 0)              return -1;
+	if (n_ == n_b)             return 1;
+	return SIMPLE_CMP(c_a, (uint32_t)b[n_]);
+}
 
 typedef int32_t (*pointless_cmp_reader_cb)(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b, uint32_t depth, const char** error);
 typedef int32_t (*pointless_cmp_create_cb)(pointless_create_t* c, pointless_complete_create_value_t* a, pointless_complete_create_value_t* b, uint32_t depth, const char** error);
@@ -81,6 +219,31 @@ static int32_t pointless_cmp_reader_string_unicode(pointless_t* p_a, pointless_c
 		uint8_t* string_a = pointless_reader_string_value_ascii(p_a, &_a);
 		uint8_t* string_b = pointless_reader_string_value_ascii(p_b, &_b);
 		return pointless_cmp_string_8_8(string_a, string_b);
+	// 88
+	} else if (a->type == POINTLESS_UNICODE_UTF8 && b->type == POINTLESS_UNICODE_UTF8) {
+		uint8_t* utf8_a = pointless_reader_unicode_value_utf8(p_a, &_a);
+		uint8_t* utf8_b = pointless_reader_unicode_value_utf8(p_b, &_b);
+		return pointless_cmp_string_utf8_utf8(utf8_a, utf8_b);
+	// 8u
+	} else if (a->type == POINTLESS_UNICODE_UTF8 && b->type == POINTLESS_UNICODE_) {
+		uint8_t* utf8_a = pointless_reader_unicode_value_utf8(p_a, &_a);
+		uint32_t* unicode_b = pointless_reader_unicode_value_ucs4(p_b, &_b);
+		return pointless_cmp_string_utf8_32(utf8_a, unicode_b);
+	// u8
+	} else if (a->type == POINTLESS_UNICODE_ && b->type == POINTLESS_UNICODE_UTF8) {
+		uint32_t* unicode_a = pointless_reader_unicode_value_ucs4(p_a, &_a);
+		uint8_t* utf8_b = pointless_reader_unicode_value_utf8(p_b, &_b);
+		return -pointless_cmp_string_utf8_32(utf8_b, unicode_a);
+	// 8s
+	} else if (a->type == POINTLESS_UNICODE_UTF8 && b->type == POINTLESS_STRING_) {
+		uint8_t* utf8_a = pointless_reader_unicode_value_utf8(p_a, &_a);
+		uint8_t* string_b = pointless_reader_string_value_ascii(p_b, &_b);
+		return pointless_cmp_string_utf8_8(utf8_a, string_b);
+	// s8
+	} else if (a->type == POINTLESS_STRING_ && b->type == POINTLESS_UNICODE_UTF8) {
+		uint8_t* string_a = pointless_reader_string_value_ascii(p_a, &_a);
+		uint8_t* utf8_b = pointless_reader_unicode_value_utf8(p_b, &_b);
+		return -pointless_cmp_string_utf8_8(utf8_b, string_a);
 	}
 
 	assert(0);
@@ -92,30 +255,54 @@ static int32_t pointless_cmp_create_string_unicode(pointless_create_t* c, pointl
 	pointless_create_value_t _a = pointless_create_value_from_complete(a);
 	pointless_create_value_t _b = pointless_create_value_from_complete(b);
 
+	int32_t retval = 0;
+	void* buffer_a = 0;
+	void* buffer_b = 0;
+
+	// spilled buffers are read back for the comparison
+	if (c->spill) {
+		buffer_a = pointless_spill_get(c->spill, POINTLESS_SPILL_STRING_UNICODE, _a.data.data_u32, error);
+		buffer_b = buffer_a ? pointless_spill_get(c->spill, POINTLESS_SPILL_STRING_UNICODE, _b.data.data_u32, error) : 0;
+
+		if (buffer_b == 0) {
+			pointless_free(buffer_a);
+			return 0;
+		}
+	} else {
+		buffer_a = cv_get_string(&_a);
+		buffer_b = cv_get_string(&_b);
+	}
+
 	// uu
 	if (_a.header.type_29 == POINTLESS_UNICODE_ && _b.header.type_29 == POINTLESS_UNICODE_) {
-		uint32_t* unicode_a = (uint32_t*)cv_get_unicode(&_a) + 1;
-		uint32_t* unicode_b = (uint32_t*)cv_get_unicode(&_b) + 1;
-		return pointless_cmp_string_32_32(unicode_a, unicode_b);
+		uint32_t* unicode_a = (uint32_t*)buffer_a + 1;
+		uint32_t* unicode_b = (uint32_t*)buffer_b + 1;
+		retval = pointless_cmp_string_32_32(unicode_a, unicode_b);
 	// us
 	} else if (_a.header.type_29 == POINTLESS_UNICODE_ && _b.header.type_29 == POINTLESS_STRING_) {
-		uint32_t* unicode_a = (uint32_t*)cv_get_unicode(&_a) + 1;
-		uint8_t* string_b = (uint8_t*)((uint32_t*)cv_get_string(&_b) + 1);
-		return pointless_cmp_string_32_8(unicode_a, string_b);
+		uint32_t* unicode_a = (uint32_t*)buffer_a + 1;
+		uint8_t* string_b = (uint8_t*)((uint32_t*)buffer_b + 1);
+		retval = pointless_cmp_string_32_8(unicode_a, string_b);
 	// su
 	} else if (_a.header.type_29 == POINTLESS_STRING_ && _b.header.type_29 == POINTLESS_UNICODE_) {
-		uint8_t* string_a = (uint8_t*)((uint32_t*)cv_get_string(&_a) + 1);
-		uint32_t* unicode_b = (uint32_t*)cv_get_unicode(&_b) + 1;
-		return pointless_cmp_string_8_32(string_a, unicode_b);
+		uint8_t* string_a = (uint8_t*)((uint32_t*)buffer_a + 1);
+		uint32_t* unicode_b = (uint32_t*)buffer_b + 1;
+		retval = pointless_cmp_string_8_32(string_a, unicode_b);
 	// ss
 	} else if (_a.header.type_29 == POINTLESS_STRING_ && _b.header.type_29 == POINTLESS_STRING_) {
-		uint8_t* string_a = (uint8_t*)((uint32_t*)cv_get_string(&_a) + 1);
-		uint8_t* string_b = (uint8_t*)((uint32_t*)cv_get_string(&_b) + 1);
-		return pointless_cmp_string_8_8(string_a, string_b);
+		uint8_t* string_a = (uint8_t*)((uint32_t*)buffer_a + 1);
+		uint8_t* string_b = (uint8_t*)((uint32_t*)buffer_b + 1);
+		retval = pointless_cmp_string_8_8(string_a, string_b);
+	} else {
+		assert(0);
 	}
 
-	assert(0);
-	return 0;
+	if (c->spill) {
+		pointless_free(buffer_a);
+		pointless_free(buffer_b);
+	}
+
+	return retval;
 }
 
 // int/float is absolutely trivial
@@ -241,16 +428,29 @@ static int32_t pointless_cmp_create_bitvector(pointless_create_t* c, pointless_c
 	pointless_create_value_t _a = pointless_create_value_from_complete(a);
 	pointless_create_value_t _b = pointless_create_value_from_complete(b);
 
+	int32_t retval = 0;
 	void* buffer_a = 0;
 	void* buffer_b = 0;
 
 	if (a->header.type_29 == POINTLESS_BITVECTOR)
-		buffer_a = cv_get_bitvector(&_a);
+		buffer_a = c->spill ? pointless_spill_get(c->spill, POINTLESS_SPILL_BITVECTOR, _a.data.data_u32, error) : cv_get_bitvector(&_a);
 
 	if (b->header.type_29 == POINTLESS_BITVECTOR)
-		buffer_b = cv_get_bitvector(&_b);
+		buffer_b = c->spill ? pointless_spill_get(c->spill, POINTLESS_SPILL_BITVECTOR, _b.data.data_u32, error) : cv_get_bitvector(&_b);
+
+	if ((a->header.type_29 == POINTLESS_BITVECTOR && buffer_a == 0) || (b->header.type_29 == POINTLESS_BITVECTOR && buffer_b == 0))
+		goto cleanup;
+
+	retval = pointless_bitvector_cmp_buffer_buffer(a->header.type_29, &_a.data, buffer_a, b->header.type_29, &_b.data, buffer_b);
+
+cleanup:
+
+	if (c->spill) {
+		pointless_free(buffer_a);
+		pointless_free(buffer_b);
+	}
 
-	return pointless_bitvector_cmp_buffer_buffer(a->header.type_29, &_a.data, buffer_a, b->header.type_29, &_b.data, buffer_b);
+	return retval;
 }
 
 // vectors are complicated
@@ -373,8 +573,15 @@ static int32_t pointless_cmp_create_vector(pointless_create_t* c, pointless_comp
 	pointless_create_value_t _a = pointless_create_value_from_complete(a);
 	pointless_create_value_t _b = pointless_create_value_from_complete(b);
 
-	uint32_t n_items_a = a->header.is_outside_vector ? cv_get_outside_vector(&_a)->n_items : pointless_dynarray_n_items(&cv_get_priv_vector(&_a)->vector);
-	uint32_t n_items_b = b->header.is_outside_vector ? cv_get_outside_vector(&_b)->n_items : pointless_dynarray_n_items(&cv_get_priv_vector(&_b)->vector);
+	// empty vectors have no vector of their own
+	uint32_t n_items_a = 0, n_items_b = 0;
+
+	if (a->header.type_29 != POINTLESS_VECTOR_EMPTY)
+		n_items_a = a->header.is_outside_vector ? cv_get_outside_vector(&_a)->n_items : pointless_dynarray_n_items(&cv_get_priv_vector(&_a)->vector);
+
+	if (b->header.type_29 != POINTLESS_VECTOR_EMPTY)
+		n_items_b = b->header.is_outside_vector ? cv_get_outside_vector(&_b)->n_items : pointless_dynarray_n_items(&cv_get_priv_vector(&_b)->vector);
+
 	uint32_t i, n_items = (n_items_a < n_items_b ? n_items_a : n_items_b);
 	int32_t cc;
 
@@ -406,6 +613,7 @@ static pointless_cmp_reader_cb pointless_cmp_reader_func(uint32_t t)
 	switch (t) {
 		case POINTLESS_UNICODE_:
 		case POINTLESS_STRING_:
+		case POINTLESS_UNICODE_UTF8:
 			return pointless_cmp_reader_string_unicode;
 		case POINTLESS_I32:
 		case POINTLESS_U32:
@@ -523,7 +731,7 @@ static int32_t pointless_cmp_create_rec_priv(pointless_create_t* c, pointless_co
 
 	// find the comparison func for these two
 	pointless_cmp_create_cb cmp_a = pointless_cmp_create_func(v_a->header.type_29);
-	pointless_cmp_create_cb cmp_b = pointless_cmp_create_func(v_a->header.type_29);
+	pointless_cmp_create_cb cmp_b = pointless_cmp_create_func(v_b->header.type_29);
 
 	// different type groups, just cmp on type ID
 	if (cmp_a != cmp_b)
@@ -549,6 +757,35 @@ int32_t pointless_cmp_reader_acyclic(pointless_t* p_a, pointless_complete_value_
 	return pointless_cmp_reader_rec(p_a, a, p_b, b, 0, 0);
 }
 
+// true iff both values have stored hashes, of the same string hash, and they differ, in which case the values can not be equal
+static int pointless_eq_reader_hash_differs(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b)
+{
+	if (p_a == 0 || p_b == 0 || !pointless_hash_reader_compatible(p_a, p_b))
+		return 0;
+
+	pointless_value_t _a = pointless_value_from_complete(a);
+	pointless_value_t _b = pointless_value_from_complete(b);
+	uint32_t h_a, h_b;
+
+	return (pointless_hash_reader_stored_32(p_a, &_a, &h_a) && pointless_hash_reader_stored_32(p_b, &_b, &h_b) && h_a != h_b);
+}
+
+int32_t pointless_eq_reader(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b, const char** error)
+{
+	if (pointless_eq_reader_hash_differs(p_a, a, p_b, b))
+		return 0;
+
+	return (pointless_cmp_reader(p_a, a, p_b, b, error) == 0);
+}
+
+int32_t pointless_eq_reader_acyclic(pointless_t* p_a, pointless_complete_value_t* a, pointless_t* p_b, pointless_complete_value_t* b)
+{
+	if (pointless_eq_reader_hash_differs(p_a, a, p_b, b))
+		return 0;
+
+	return (pointless_cmp_reader_acyclic(p_a, a, p_b, b) == 0);
+}
+
 int32_t pointless_cmp_create(pointless_create_t* c, uint32_t a, uint32_t b, const char** error)
 {
 	pointless_create_value_t* v_a = &pointless_dynarray_ITEM_AT(pointless_create_value_t, &c->values, a);
@@ -1,6 +1,8 @@
 #include <pointless/pointless_create.h>
 
 typedef struct {
+	// if set, called once with the exact size of the output, before anything is written
+	int (*begin)(uint64_t n_bytes, void* user, const char** error);
 	int (*write)(void* data, size_t datalen, void* user, const char** error);
 	int (*align_4)(void* user, const char** error);
 	void* user;
@@ -28,6 +30,10 @@ static pointless_value_t pointless_create_to_read_value(pointless_create_t* c, u
 	if (cv_is_outside_vector(v))
 		data.data_u32 += n_priv_vectors;
 
+	// unicodes are kept as ucs-4 until they are written
+	if (type == POINTLESS_UNICODE_ && (c->features & POINTLESS_FF_FEATURE_UTF8))
+		type = POINTLESS_UNICODE_UTF8;
+
 	pointless_value_t r;
 	r.type = type;
 	r.data = data;
@@ -35,21 +41,204 @@ static pointless_value_t pointless_create_to_read_value(pointless_create_t* c, u
 	return r;
 }
 
-static int pointless_hash_table_create(pointless_create_t* c, uint32_t hash_table, const char** error)
+// one set or map: its buckets are filled in without touching any shared state, and are handed over to its serialize
+// vectors afterwards, interleaved and minimal perfect hash tables as a single vector of records
+typedef struct {
+	uint32_t hash_table;
+	uint32_t n_buckets;
+	uint32_t* hash_serialize;
+	uint32_t* keys_serialize;
+	uint32_t* values_serialize;
+	uint32_t* records;
+	uint32_t n_records;
+} pointless_hash_table_job_t;
+
+// one bucket of an interleaved or minimal perfect hash table: hash, key and value (maps only)
+static void pointless_hash_table_create_record(pointless_create_t* c, uint32_t* record, uint32_t hash, uint32_t key, uint32_t* value, uint32_t n_priv_vectors)
+{
+	pointless_value_t v;
+
+	record[0] = hash;
+	v = pointless_create_to_read_value(c, key, n_priv_vectors);
+	memcpy(&record[1], &v, sizeof(v));
+
+	if (value) {
+		v = pointless_create_to_read_value(c, *value, n_priv_vectors);
+		memcpy(&record[3], &v, sizeof(v));
+	}
+}
+
+static int pointless_hash_table_create_interleaved(pointless_create_t* c, pointless_hash_table_job_t* job, uint32_t n_priv_vectors, const char** error)
+{
+	uint32_t stride = (job->values_serialize ? POINTLESS_MAP_INTERLEAVED_STRIDE : POINTLESS_SET_INTERLEAVED_STRIDE);
+	uint32_t i, *records = (uint32_t*)pointless_malloc(sizeof(uint32_t) * stride * job->n_buckets);
+
+	if (records == 0) {
+		*error = "out of memory E";
+		return 0;
+	}
+
+	for (i = 0; i < job->n_buckets; i++)
+		pointless_hash_table_create_record(c, &records[i * stride], job->hash_serialize[i], job->keys_serialize[i], job->values_serialize ? &job->values_serialize[i] : 0, n_priv_vectors);
+
+	job->records = records;
+	job->n_records = stride * job->n_buckets;
+
+	return 1;
+}
+
+typedef struct {
+	uint32_t* hashes;
+	uint32_t* buckets;
+} pointless_mphf_sort_state_t;
+
+// orders buckets by hash, ties by bucket, so that the output does not depend on the sort
+static int pointless_mphf_sort_cmp(int a, int b, int* c, void* user)
+{
+	pointless_mphf_sort_state_t* state = (pointless_mphf_sort_state_t*)user;
+	uint32_t bucket_a = state->buckets[a];
+	uint32_t bucket_b = state->buckets[b];
+
+	*c = SIMPLE_CMP(state->hashes[bucket_a], state->hashes[bucket_b]);
+
+	if (*c == 0)
+		*c = SIMPLE_CMP(bucket_a, bucket_b);
+
+	return 1;
+}
+
+static void pointless_mphf_sort_swap(int a, int b, void* user)
+{
+	pointless_mphf_sort_state_t* state = (pointless_mphf_sort_state_t*)user;
+	uint32_t t = state->buckets[a];
+	state->buckets[a] = state->buckets[b];
+	state->buckets[b] = t;
+}
+
+static int pointless_hash_table_create_mphf(pointless_create_t* c, pointless_hash_table_job_t* job, uint32_t n_priv_vectors, const char** error)
 {
-	// return value
 	int retval = 0;
 
-	// output vectors
-	uint32_t* hash_serialize = 0;
-	uint32_t* keys_serialize = 0;
-	uint32_t* values_serialize = 0;
-	uint32_t* hash_vector = 0;
+	uint32_t n_buckets = job->n_buckets, *hash_serialize = job->hash_serialize, *keys_serialize = job->keys_serialize, *values_serialize = job->values_serialize;
+	uint32_t stride = (values_serialize ? POINTLESS_MAP_INTERLEAVED_STRIDE : POINTLESS_SET_INTERLEAVED_STRIDE);
+	uint32_t i, n_keys = 0, n_primary = 0, n_overflow = 0, n_pilots, n_words;
 
-	// serialized vector handles
-	uint32_t sh = 0, sk = 0, sv = 0;
+	uint32_t* buckets = 0;
+	uint32_t* order = 0;
+	uint32_t* primary_hashes = 0;
+	uint32_t* slots = 0;
+	uint32_t* records = 0;
+
+	for (i = 0; i < n_buckets; i++)
+		n_keys += (cv_value_type(keys_serialize[i]) != POINTLESS_EMPTY_SLOT);
+
+	buckets = (uint32_t*)pointless_malloc(sizeof(uint32_t) * (n_keys + 1));
+	order = (uint32_t*)pointless_malloc(sizeof(uint32_t) * (n_keys + 1));
+	primary_hashes = (uint32_t*)pointless_malloc(sizeof(uint32_t) * (n_keys + 1));
+	slots = (uint32_t*)pointless_malloc(sizeof(uint32_t) * (n_keys + 1));
+
+	if (buckets == 0 || order == 0 || primary_hashes == 0 || slots == 0) {
+		*error = "out of memory E";
+		goto cleanup;
+	}
+
+	// group the used buckets by hash
+	for (i = 0, n_keys = 0; i < n_buckets; i++) {
+		if (cv_value_type(keys_serialize[i]) != POINTLESS_EMPTY_SLOT)
+			buckets[n_keys++] = i;
+	}
+
+	pointless_mphf_sort_state_t sort_state;
+	sort_state.hashes = hash_serialize;
+	sort_state.buckets = buckets;
+
+	if (n_keys > INT_MAX || !bentley_sort_((int)n_keys, pointless_mphf_sort_cmp, pointless_mphf_sort_swap, (void*)&sort_state)) {
+		*error = "unable to sort hash table buckets";
+		goto cleanup;
+	}
 
-	uint32_t i, n_buckets, empty_slot_handle;
+	// the first of each hash goes through the perfect hash, the rest into the overflow, still sorted by hash
+	for (i = 0; i < n_keys; i++) {
+		if (i == 0 || hash_serialize[buckets[i]] != hash_serialize[buckets[i - 1]]) {
+			primary_hashes[n_primary] = hash_serialize[buckets[i]];
+			order[n_primary++] = buckets[i];
+		}
+	}
+
+	for (i = 0; i < n_keys; i++) {
+		if (i > 0 && hash_serialize[buckets[i]] == hash_serialize[buckets[i - 1]])
+			order[n_primary + n_overflow++] = buckets[i];
+	}
+
+	n_pilots = pointless_mphf_n_pilots(n_primary);
+	n_words = POINTLESS_MPHF_HEADER_WORDS + n_pilots + stride * n_keys;
+	records = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_words);
+
+	if (records == 0) {
+		*error = "out of memory F";
+		goto cleanup;
+	}
+
+	records[0] = n_primary;
+	records[1] = n_pilots;
+
+	if (!pointless_mphf_build(primary_hashes, n_primary, records + POINTLESS_MPHF_HEADER_WORDS, slots, error))
+		goto cleanup;
+
+	for (i = 0; i < n_keys; i++) {
+		uint32_t bucket = order[i];
+		uint32_t slot = (i < n_primary) ? slots[i] : i;
+		uint32_t* record = records + POINTLESS_MPHF_HEADER_WORDS + n_pilots + (size_t)slot * stride;
+		pointless_hash_table_create_record(c, record, hash_serialize[bucket], keys_serialize[bucket], values_serialize ? &values_serialize[bucket] : 0, n_priv_vectors);
+	}
+
+	job->records = records;
+	job->n_records = n_words;
+
+	// owned by the job now
+	records = 0;
+	retval = 1;
+
+cleanup:
+
+	pointless_free(buckets);
+	pointless_free(order);
+	pointless_free(primary_hashes);
+	pointless_free(slots);
+	pointless_free(records);
+
+	return retval;
+}
+
+static void pointless_hash_table_job_init(pointless_hash_table_job_t* job, uint32_t hash_table)
+{
+	job->hash_table = hash_table;
+	job->n_buckets = 0;
+	job->hash_serialize = 0;
+	job->keys_serialize = 0;
+	job->values_serialize = 0;
+	job->records = 0;
+	job->n_records = 0;
+}
+
+static void pointless_hash_table_job_free(pointless_hash_table_job_t* job)
+{
+	pointless_free(job->hash_serialize);
+	pointless_free(job->keys_serialize);
+	pointless_free(job->values_serialize);
+	pointless_free(job->records);
+	pointless_hash_table_job_init(job, job->hash_table);
+}
+
+// hashes the keys and populates the buckets, it only reads c->values, so any number of these can run at the same time
+static int pointless_hash_table_build(pointless_create_t* c, pointless_hash_table_job_t* job, uint32_t n_priv_vectors, uint32_t empty_slot_handle, const char** error)
+{
+	// return value
+	int retval = 0;
+
+	uint32_t hash_table = job->hash_table;
+	uint32_t* hash_vector = 0;
+	uint32_t i, n_buckets;
 
 	// WARNING: we are using a direct pointer to dynamic array, but we
 	//          make sure that it can't grow/shrink inside this function
@@ -74,42 +263,35 @@ static int pointless_hash_table_create(pointless_create_t* c, uint32_t hash_tabl
 
 	// number of buckets
 	n_buckets = pointless_hash_compute_n_buckets(n_keys);
+	job->n_buckets = n_buckets;
 
 	// allocate output vectors
-	hash_serialize = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_buckets);
-	keys_serialize = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_buckets);
+	job->hash_serialize = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_buckets);
+	job->keys_serialize = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_buckets);
 	hash_vector = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_keys);
 
-	if (hash_serialize == 0 || keys_serialize == 0 || hash_vector == 0) {
+	if (job->hash_serialize == 0 || job->keys_serialize == 0 || hash_vector == 0) {
 		*error = "out of memory B";
 		goto cleanup;
 	}
 
 	// ...and one for values if this is a map
 	if (cv_value_type(hash_table) == POINTLESS_MAP_VALUE_VALUE) {
-		values_serialize = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_buckets);
+		job->values_serialize = (uint32_t*)pointless_malloc(sizeof(uint32_t) * n_buckets);
 
-		if (values_serialize == 0) {
+		if (job->values_serialize == 0) {
 			*error = "out of memory C";
 			goto cleanup;
 		}
 	}
 
-	// create an "empty slot" value
-	empty_slot_handle = pointless_create_empty_slot(c);
-
-	if (empty_slot_handle == POINTLESS_CREATE_VALUE_FAIL) {
-		*error = "out of memory D";
-		goto cleanup;
-	}
-
 	// initialize all vectors
 	for (i = 0; i < n_buckets; i++) {
-		hash_serialize[i] = 0;
-		keys_serialize[i] = empty_slot_handle;
+		job->hash_serialize[i] = 0;
+		job->keys_serialize[i] = empty_slot_handle;
 
-		if (values_serialize)
-			values_serialize[i] = empty_slot_handle;
+		if (job->values_serialize)
+			job->values_serialize[i] = empty_slot_handle;
 	}
 
 	// compute all the key hashes
@@ -129,72 +311,412 @@ static int pointless_hash_table_create(pointless_create_t* c, uint32_t hash_tabl
 	}
 
 	// populate the arrays
-	if (!pointless_hash_table_populate(c, hash_vector, keys_vector_ptr, values_vector_ptr, n_keys, hash_serialize, keys_serialize, values_serialize, n_buckets, empty_slot_handle, error))
+	if (!pointless_hash_table_populate(c, hash_vector, keys_vector_ptr, values_vector_ptr, n_keys, job->hash_serialize, job->keys_serialize, job->values_serialize, n_buckets, empty_slot_handle, error))
 		goto cleanup;
 
 	// hash vector no longer needed
 	pointless_free(hash_vector);
 	hash_vector = 0;
 
-	// our serialize vector handles
-	switch (cv_value_type(hash_table)) {
+	// interleaved and minimal perfect hash tables go into a single vector, all keys and values have their final form by now
+	if (c_hash_table_layout() == POINTLESS_HASH_TABLE_LAYOUT_INTERLEAVED) {
+		if (!pointless_hash_table_create_interleaved(c, job, n_priv_vectors, error))
+			goto cleanup;
+	} else if (c_hash_table_layout() == POINTLESS_HASH_TABLE_LAYOUT_MPHF) {
+		if (!pointless_hash_table_create_mphf(c, job, n_priv_vectors, error))
+			goto cleanup;
+	}
+
+	// the buckets are part of the records now
+	if (job->records) {
+		pointless_free(job->hash_serialize);
+		pointless_free(job->keys_serialize);
+		pointless_free(job->values_serialize);
+		job->hash_serialize = 0;
+		job->keys_serialize = 0;
+		job->values_serialize = 0;
+	}
+
+	retval = 1;
+
+cleanup:
+
+	pointless_free(hash_vector);
+
+	if (retval == 0)
+		pointless_hash_table_job_free(job);
+
+	return retval;
+}
+
+// hands the buffers of a built job over to the serialize vectors of its set or map
+static int pointless_hash_table_transfer(pointless_create_t* c, pointless_hash_table_job_t* job, const char** error)
+{
+	// serialized vector handles
+	uint32_t sh = 0, sk = 0, sv = 0;
+
+	switch (cv_value_type(job->hash_table)) {
 		case POINTLESS_SET_VALUE:
-			sh = cv_set_at(hash_table)->serialize_hash;
-			sk = cv_set_at(hash_table)->serialize_keys;
+			sh = cv_set_at(job->hash_table)->serialize_hash;
+			sk = cv_set_at(job->hash_table)->serialize_keys;
 			break;
 		case POINTLESS_MAP_VALUE_VALUE:
-			sh = cv_map_at(hash_table)->serialize_hash;
-			sk = cv_map_at(hash_table)->serialize_keys;
-			sv = cv_map_at(hash_table)->serialize_values;
+			sh = cv_map_at(job->hash_table)->serialize_hash;
+			sk = cv_map_at(job->hash_table)->serialize_keys;
+			sv = cv_map_at(job->hash_table)->serialize_values;
 			break;
 		default:
 			assert(0);
 			*error = "pointless_hash_table_create(): internal error: what is this type?";
-			goto cleanup;
+			return 0;
+	}
+
+	// interleaved and minimal perfect hash tables
+	if (job->records) {
+		if (pointless_create_vector_u32_transfer(c, sh, job->records, job->n_records) == POINTLESS_CREATE_VALUE_FAIL) {
+			*error = "unable to transfer hash table records vector";
+			return 0;
+		}
+
+		// the vector has been transferred, so it being pointless_free()'d is somebody elses problem
+		job->records = 0;
+		return 1;
 	}
 
 	// transfer hash vector over
-	if (pointless_create_vector_u32_transfer(c, sh, hash_serialize, n_buckets) == POINTLESS_CREATE_VALUE_FAIL) {
+	if (pointless_create_vector_u32_transfer(c, sh, job->hash_serialize, job->n_buckets) == POINTLESS_CREATE_VALUE_FAIL) {
 		*error = "unable to transfer hash_serialize vector";
-		goto cleanup;
+		return 0;
 	}
 
-	// the vector has been transferred, so it being pointless_free()'d is somebody elses problem
-	hash_serialize = 0;
+	job->hash_serialize = 0;
 
 	// transfer key vector over
-	if (pointless_create_vector_value_transfer(c, sk, keys_serialize, n_buckets) == POINTLESS_CREATE_VALUE_FAIL) {
+	if (pointless_create_vector_value_transfer(c, sk, job->keys_serialize, job->n_buckets) == POINTLESS_CREATE_VALUE_FAIL) {
 		*error = "unable to transfer keys_serialize vector";
-		goto cleanup;
+		return 0;
 	}
 
-	// somebody elses problem now
-	keys_serialize = 0;
+	job->keys_serialize = 0;
 
 	// transfer value vector over
-	if (cv_value_type(hash_table) == POINTLESS_MAP_VALUE_VALUE) {
-		if (pointless_create_vector_value_transfer(c, sv, values_serialize, n_buckets) == POINTLESS_CREATE_VALUE_FAIL) {
+	if (job->values_serialize) {
+		if (pointless_create_vector_value_transfer(c, sv, job->values_serialize, job->n_buckets) == POINTLESS_CREATE_VALUE_FAIL) {
 			*error = "unable to transfer values_serialize_vector";
-			goto cleanup;
+			return 0;
 		}
 
-		// somebody elses problem
-		values_serialize = 0;
+		job->values_serialize = 0;
 	}
 
-	retval = 1;
+	return 1;
+}
 
-cleanup:
+static int pointless_hash_table_create(pointless_create_t* c, uint32_t hash_table, uint32_t n_priv_vectors, uint32_t empty_slot_handle, const char** error)
+{
+	pointless_hash_table_job_t job;
+	pointless_hash_table_job_init(&job, hash_table);
 
-	pointless_free(hash_serialize);
-	pointless_free(keys_serialize);
-	pointless_free(hash_vector);
-	pointless_free(values_serialize);
+	int retval = (pointless_hash_table_build(c, &job, n_priv_vectors, empty_slot_handle, error) && pointless_hash_table_transfer(c, &job, error));
+
+	pointless_hash_table_job_free(&job);
 
 	return retval;
 }
 
-static void pointless_create_begin_(pointless_create_t* c, uint32_t version)
+typedef struct {
+	pointless_create_t* c;
+	pointless_hash_table_job_t* jobs;
+	uint32_t n_priv_vectors;
+	uint32_t empty_slot_handle;
+} pointless_hash_table_parallel_t;
+
+static int32_t pointless_hash_table_parallel_cb(uint32_t i, void* user, const char** error)
+{
+	pointless_hash_table_parallel_t* state = (pointless_hash_table_parallel_t*)user;
+	return pointless_hash_table_build(state->c, &state->jobs[i], state->n_priv_vectors, state->empty_slot_handle, error);
+}
+
+// builds all the jobs on c->n_threads threads, then transfers them in order, so the output is the same as with one thread
+static int pointless_hash_table_create_parallel(pointless_create_t* c, pointless_hash_table_job_t* jobs, uint32_t n_jobs, uint32_t n_priv_vectors, uint32_t empty_slot_handle, const char** error)
+{
+	pointless_hash_table_parallel_t state;
+	state.c = c;
+	state.jobs = jobs;
+	state.n_priv_vectors = n_priv_vectors;
+	state.empty_slot_handle = empty_slot_handle;
+
+	if (!pointless_parallel_for(n_jobs, c->n_threads, pointless_hash_table_parallel_cb, &state, error))
+		return 0;
+
+	uint32_t i;
+
+	for (i = 0; i < n_jobs; i++) {
+		if (!pointless_hash_table_transfer(c, &jobs[i], error))
+			return 0;
+
+		pointless_hash_table_job_free(&jobs[i]);
+	}
+
+	return 1;
+}
+
+// stored hashes are written in chunks of this size
+#define POINTLESS_HASH_SLOTS_CHUNK 1024
+
+typedef struct {
+	uint32_t hashes[POINTLESS_HASH_SLOTS_CHUNK];
+	uint32_t n_hashes;
+} pointless_hash_slots_writer_t;
+
+static int pointless_hash_slots_flush(pointless_create_cb_t* cb, pointless_hash_slots_writer_t* w, const char** error)
+{
+	if (w->n_hashes > 0 && !(*cb->write)(w->hashes, w->n_hashes * sizeof(uint32_t), cb->user, error))
+		return 0;
+
+	w->n_hashes = 0;
+	return 1;
+}
+
+static int pointless_hash_slots_write(pointless_create_cb_t* cb, pointless_hash_slots_writer_t* w, uint32_t hash, const char** error)
+{
+	if (w->n_hashes == POINTLESS_HASH_SLOTS_CHUNK && !pointless_hash_slots_flush(cb, w, error))
+		return 0;
+
+	w->hashes[w->n_hashes++] = hash;
+	return 1;
+}
+
+#define POINTLESS_HASH_SLOTS_UNVISITED 0
+#define POINTLESS_HASH_SLOTS_VISITING 1
+#define POINTLESS_HASH_SLOTS_HASHABLE 2
+#define POINTLESS_HASH_SLOTS_UNHASHABLE 3
+
+typedef struct {
+	uint32_t hash;
+	uint32_t state;
+} pointless_hash_slots_memo_t;
+
+// one memo per private and outside vector, indexed like their vectors
+typedef struct {
+	pointless_hash_slots_memo_t* priv;
+	pointless_hash_slots_memo_t* outside;
+	pointless_dynarray_t stack;
+} pointless_hash_slots_state_t;
+
+static pointless_hash_slots_memo_t* pointless_hash_slots_memo(pointless_create_t* c, pointless_hash_slots_state_t* s, uint32_t i)
+{
+	return cv_is_outside_vector(i) ? &s->outside[cv_value_data_u32(i)] : &s->priv[cv_value_data_u32(i)];
+}
+
+// true iff the memo of i has to be computed before any vector containing it
+static int pointless_hash_slots_is_memo_vector(pointless_create_t* c, uint32_t i)
+{
+	return (pointless_is_vector_type(cv_value_type(i)) && cv_value_type(i) != POINTLESS_VECTOR_EMPTY);
+}
+
+// hashes a vector whose child vectors all have their memo, so each vector is hashed exactly once
+static void pointless_hash_slots_compute(pointless_create_t* c, pointless_hash_slots_state_t* s, uint32_t i, pointless_hash_slots_memo_t* m)
+{
+	uint32_t j, n_items, *items;
+	pointless_hash_slots_memo_t* child;
+	pointless_vector_hash_state_32_t state;
+
+	// value vectors, such as the key/value vectors of sets/maps, which hold empty slots, are not hashable
+	if (cv_value_type(i) == POINTLESS_VECTOR_VALUE) {
+		m->state = POINTLESS_HASH_SLOTS_UNHASHABLE;
+		return;
+	}
+
+	// primitive and compressed vectors have no child vectors
+	if (cv_value_type(i) != POINTLESS_VECTOR_VALUE_HASHABLE || cv_value_at(i)->header.is_compressed_vector) {
+		m->hash = pointless_hash_create_32(c, cv_value_at(i));
+		m->state = POINTLESS_HASH_SLOTS_HASHABLE;
+		return;
+	}
+
+	if (cv_is_outside_vector(i)) {
+		items = (uint32_t*)cv_outside_vector_at(i)->items;
+		n_items = cv_outside_vector_at(i)->n_items;
+	} else {
+		items = (uint32_t*)cv_priv_vector_at(i)->vector._data;
+		n_items = pointless_dynarray_n_items(&cv_priv_vector_at(i)->vector);
+	}
+
+	// same sequence as pointless_hash_create_32(), with the child vector hashes taken from their memo
+	pointless_vector_hash_init_32(&state, n_items);
+
+	for (j = 0; j < n_items; j++) {
+		if (!pointless_is_hashable(cv_value_type(items[j]))) {
+			m->state = POINTLESS_HASH_SLOTS_UNHASHABLE;
+			return;
+		}
+
+		if (pointless_hash_slots_is_memo_vector(c, items[j])) {
+			child = pointless_hash_slots_memo(c, s, items[j]);
+
+			if (child->state != POINTLESS_HASH_SLOTS_HASHABLE) {
+				m->state = POINTLESS_HASH_SLOTS_UNHASHABLE;
+				return;
+			}
+
+			pointless_vector_hash_next_32(&state, child->hash);
+		} else {
+			pointless_vector_hash_next_32(&state, pointless_hash_create_32(c, cv_value_at(items[j])));
+		}
+	}
+
+	m->hash = pointless_vector_hash_end_32(&state);
+	m->state = POINTLESS_HASH_SLOTS_HASHABLE;
+}
+
+// computes the memo of a set/map key and all the vectors within it, children before parents
+static int pointless_hash_slots_visit(pointless_create_t* c, pointless_hash_slots_state_t* s, uint32_t key, const char** error)
+{
+	uint32_t i, j, n_items, *items;
+	pointless_hash_slots_memo_t* m;
+
+	if (!pointless_hash_slots_is_memo_vector(c, key) || pointless_hash_slots_memo(c, s, key)->state != POINTLESS_HASH_SLOTS_UNVISITED)
+		return 1;
+
+	pointless_dynarray_clear(&s->stack);
+
+	if (!pointless_dynarray_push(&s->stack, &key)) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	while (pointless_dynarray_n_items(&s->stack) > 0) {
+		i = pointless_dynarray_ITEM_AT(uint32_t, &s->stack, pointless_dynarray_n_items(&s->stack) - 1);
+		m = pointless_hash_slots_memo(c, s, i);
+
+		// a vector may be pushed more than once, if it is shared
+		if (m->state == POINTLESS_HASH_SLOTS_HASHABLE || m->state == POINTLESS_HASH_SLOTS_UNHASHABLE) {
+			pointless_dynarray_pop(&s->stack);
+			continue;
+		}
+
+		// all children are done
+		if (m->state == POINTLESS_HASH_SLOTS_VISITING) {
+			pointless_hash_slots_compute(c, s, i, m);
+			pointless_dynarray_pop(&s->stack);
+			continue;
+		}
+
+		m->state = POINTLESS_HASH_SLOTS_VISITING;
+
+		if (cv_value_type(i) != POINTLESS_VECTOR_VALUE_HASHABLE || cv_value_at(i)->header.is_compressed_vector)
+			continue;
+
+		if (cv_is_outside_vector(i)) {
+			items = (uint32_t*)cv_outside_vector_at(i)->items;
+			n_items = cv_outside_vector_at(i)->n_items;
+		} else {
+			items = (uint32_t*)cv_priv_vector_at(i)->vector._data;
+			n_items = pointless_dynarray_n_items(&cv_priv_vector_at(i)->vector);
+		}
+
+		// a hashable vector is never in a cycle, were it one, its visiting child would make it unhashable
+		for (j = 0; j < n_items; j++) {
+			if (!pointless_is_hashable(cv_value_type(items[j])) || !pointless_hash_slots_is_memo_vector(c, items[j]))
+				continue;
+
+			if (pointless_hash_slots_memo(c, s, items[j])->state != POINTLESS_HASH_SLOTS_UNVISITED)
+				continue;
+
+			if (!pointless_dynarray_push(&s->stack, &items[j])) {
+				*error = "out of memory";
+				return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+static int pointless_hash_slots_visit_keys(pointless_create_t* c, pointless_hash_slots_state_t* s, pointless_dynarray_t* keys, const char** error)
+{
+	size_t i, n_keys = pointless_dynarray_n_items(keys);
+
+	for (i = 0; i < n_keys; i++) {
+		if (!pointless_hash_slots_visit(c, s, pointless_dynarray_ITEM_AT(uint32_t, keys, i), error))
+			return 0;
+	}
+
+	return 1;
+}
+
+// only vectors reachable from a set/map key get a stored hash, all other vectors get 0
+static uint32_t pointless_hash_slots_vector(pointless_create_t* c, pointless_hash_slots_state_t* s, uint32_t i)
+{
+	pointless_hash_slots_memo_t* m = pointless_hash_slots_memo(c, s, i);
+	return (m->state == POINTLESS_HASH_SLOTS_HASHABLE) ? m->hash : 0;
+}
+
+static int pointless_serialize_hash_slots_(pointless_create_cb_t* cb, pointless_create_t* c, pointless_hash_slots_state_t* s, uint32_t n_values, const char** error)
+{
+	pointless_hash_slots_writer_t w;
+	uint32_t i;
+
+	for (i = 0; i < pointless_dynarray_n_items(&c->set_values); i++) {
+		if (!pointless_hash_slots_visit_keys(c, s, &pointless_dynarray_ITEM_AT(pointless_create_set_t, &c->set_values, i).keys, error))
+			return 0;
+	}
+
+	for (i = 0; i < pointless_dynarray_n_items(&c->map_values); i++) {
+		if (!pointless_hash_slots_visit_keys(c, s, &pointless_dynarray_ITEM_AT(pointless_create_map_t, &c->map_values, i).keys, error))
+			return 0;
+	}
+
+	w.n_hashes = 0;
+
+	for (i = 0; i < n_values; i++) {
+		if (cv_value_type(i) == POINTLESS_UNICODE_ || cv_value_type(i) == POINTLESS_STRING_) {
+			if (!pointless_hash_slots_write(cb, &w, pointless_hash_create_32(c, cv_value_at(i)), error))
+				return 0;
+		}
+	}
+
+	for (i = 0; i < n_values; i++) {
+		if (pointless_hash_slots_is_memo_vector(c, i) && !cv_is_outside_vector(i)) {
+			if (!pointless_hash_slots_write(cb, &w, pointless_hash_slots_vector(c, s, i), error))
+				return 0;
+		}
+	}
+
+	for (i = 0; i < n_values; i++) {
+		if (pointless_hash_slots_is_memo_vector(c, i) && cv_is_outside_vector(i)) {
+			if (!pointless_hash_slots_write(cb, &w, pointless_hash_slots_vector(c, s, i), error))
+				return 0;
+		}
+	}
+
+	return pointless_hash_slots_flush(cb, &w, error);
+}
+
+// writes the hashes of all strings/unicodes and vectors, in the same order as their offset vectors
+static int pointless_serialize_hash_slots(pointless_create_cb_t* cb, pointless_create_t* c, uint32_t n_values, const char** error)
+{
+	pointless_hash_slots_state_t s;
+	int retval = 0;
+
+	s.priv = (pointless_hash_slots_memo_t*)pointless_calloc(pointless_dynarray_n_items(&c->priv_vector_values) + 1, sizeof(pointless_hash_slots_memo_t));
+	s.outside = (pointless_hash_slots_memo_t*)pointless_calloc(pointless_dynarray_n_items(&c->outside_vector_values) + 1, sizeof(pointless_hash_slots_memo_t));
+	pointless_dynarray_init(&s.stack, sizeof(uint32_t));
+
+	if (s.priv == 0 || s.outside == 0)
+		*error = "out of memory";
+	else
+		retval = pointless_serialize_hash_slots_(cb, c, &s, n_values, error);
+
+	pointless_free(s.priv);
+	pointless_free(s.outside);
+	pointless_dynarray_destroy(&s.stack);
+
+	return retval;
+}
+
+static void pointless_create_begin_(pointless_create_t* c, uint32_t version, uint32_t hash_table_layout)
 {
 	c->root = UINT32_MAX;
 
@@ -208,23 +730,131 @@ static void pointless_create_begin_(pointless_create_t* c, uint32_t version)
 	pointless_dynarray_init(&c->string_unicode_values, sizeof(void*));
 	pointless_dynarray_init(&c->bitvector_values, sizeof(void*));
 
-	c->string_unicode_map_judy = 0;
-	c->bitvector_map_judy = 0;
+	pointless_arena_init(&c->arena);
 
-	c->string_unicode_map_judy_count = 0;
-	c->bitvector_map_judy_count = 0;
+	pointless_bytes_table_init(&c->string_unicode_map);
+	pointless_bytes_table_init(&c->bitvector_map);
+
+	c->string_unicode_count = 0;
+	c->bitvector_count = 0;
 
 	c->version = version;
+	c->features = pointless_ff_version_features(version);
+	c->hash_table_layout = hash_table_layout;
+
+	c->may_have_cycles = 0;
+	c->is_acyclic = 0;
+	c->n_threads = 1;
+	c->spill = 0;
+	c->backing = 0;
 }
 
 void pointless_create_begin_32(pointless_create_t* c)
 {
-	pointless_create_begin_(c, POINTLESS_FF_VERSION_OFFSET_32_NEWHASH);
+	pointless_create_begin_(c, POINTLESS_FF_VERSION_OFFSET_32_NEWHASH, POINTLESS_HASH_TABLE_LAYOUT_SPLIT);
 }
 
 void pointless_create_begin_64(pointless_create_t* c)
 {
-	pointless_create_begin_(c, POINTLESS_FF_VERSION_OFFSET_64_NEWHASH);
+	pointless_create_begin_(c, POINTLESS_FF_VERSION_OFFSET_64_NEWHASH, POINTLESS_HASH_TABLE_LAYOUT_SPLIT);
+}
+
+int pointless_create_begin_64_features(pointless_create_t* c, uint32_t features, const char** error)
+{
+	uint32_t hash_table_layout = POINTLESS_HASH_TABLE_LAYOUT_SPLIT;
+
+	if ((features & ~POINTLESS_FF_FEATURE_ALL_) != 0) {
+		*error = "unknown file format feature";
+	} else if ((features & POINTLESS_FF_FEATURE_INTERLEAVED) && (features & POINTLESS_FF_FEATURE_MPHF)) {
+		*error = "the interleaved and minimal perfect hash layouts can not be combined";
+	} else {
+		if (features & POINTLESS_FF_FEATURE_INTERLEAVED)
+			hash_table_layout = POINTLESS_HASH_TABLE_LAYOUT_INTERLEAVED;
+
+		if (features & POINTLESS_FF_FEATURE_MPHF)
+			hash_table_layout = POINTLESS_HASH_TABLE_LAYOUT_MPHF;
+
+		pointless_create_begin_(c, POINTLESS_FF_VERSION_OFFSET_64_FEATURES | (features << 16), hash_table_layout);
+		return 1;
+	}
+
+	pointless_create_begin_64(c);
+	return 0;
+}
+
+void pointless_create_begin_acyclic(pointless_create_t* c)
+{
+	c->is_acyclic = 1;
+}
+
+// gives c->backing to every array and table which exists so far, sets, maps and vectors get it when they are created
+static void pointless_create_set_backing(pointless_create_t* c)
+{
+	uint32_t kind;
+
+	pointless_dynarray_set_backing(&c->values, c->backing);
+	pointless_dynarray_set_backing(&c->priv_vector_values, c->backing);
+	pointless_dynarray_set_backing(&c->outside_vector_values, c->backing);
+	pointless_dynarray_set_backing(&c->set_values, c->backing);
+	pointless_dynarray_set_backing(&c->map_values, c->backing);
+	pointless_dynarray_set_backing(&c->string_unicode_values, c->backing);
+	pointless_dynarray_set_backing(&c->bitvector_values, c->backing);
+	pointless_dynarray_set_backing(&c->string_unicode_map.entries, c->backing);
+	pointless_dynarray_set_backing(&c->bitvector_map.entries, c->backing);
+
+	for (kind = 0; c->spill && kind < POINTLESS_SPILL_N_KINDS; kind++) {
+		pointless_dynarray_set_backing(&c->spill->entries[kind], c->backing);
+		pointless_dynarray_set_backing(&c->spill->maps[kind].entries, c->backing);
+	}
+}
+
+void pointless_create_begin_parallel(pointless_create_t* c, uint32_t n_threads)
+{
+	c->n_threads = n_threads;
+}
+
+int pointless_create_begin_spill(pointless_create_t* c, const char* dir, const char** error)
+{
+	assert(c->spill == 0 && pointless_dynarray_n_items(&c->values) == 0);
+
+	c->spill = (pointless_spill_t*)pointless_malloc(sizeof(pointless_spill_t));
+
+	if (c->spill == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	if (!pointless_spill_init(c->spill, dir, error)) {
+		pointless_free(c->spill);
+		c->spill = 0;
+		return 0;
+	}
+
+	pointless_create_set_backing(c);
+
+	return 1;
+}
+
+int pointless_create_begin_file_backing(pointless_create_t* c, const char* dir, size_t threshold, const char** error)
+{
+	assert(c->backing == 0 && pointless_dynarray_n_items(&c->values) == 0);
+
+	// the directory name is kept with the backing, so the caller need not keep it around
+	size_t n_dir = dir ? strlen(dir) + 1 : 0;
+
+	c->backing = (pointless_dynarray_backing_t*)pointless_malloc(sizeof(pointless_dynarray_backing_t) + n_dir);
+
+	if (c->backing == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	c->backing->dir = dir ? memcpy(c->backing + 1, dir, n_dir) : 0;
+	c->backing->threshold = threshold;
+
+	pointless_create_set_backing(c);
+
+	return 1;
 }
 
 static void pointless_create_value_free(pointless_create_t* c, uint32_t i)
@@ -247,15 +877,7 @@ static void pointless_create_value_free(pointless_create_t* c, uint32_t i)
 			if (cv_is_outside_vector(i) == 0)
 				pointless_dynarray_destroy(&cv_priv_vector_at(i)->vector);
 			break;
-		case POINTLESS_BITVECTOR:
-			pointless_free(cv_bitvector_at(i));
-			break;
-		case POINTLESS_UNICODE_:
-			pointless_free(cv_unicode_at(i));
-			break;
-		case POINTLESS_STRING_:
-			pointless_free(cv_string_at(i));
-			break;
+		// string/unicode and bitvector buffers are in the arena
 		case POINTLESS_SET_VALUE:
 			pointless_dynarray_destroy(&cv_set_at(i)->keys);
 			break;
@@ -283,11 +905,64 @@ void pointless_create_end(pointless_create_t* c)
 	pointless_dynarray_destroy(&c->string_unicode_values);
 	pointless_dynarray_destroy(&c->bitvector_values);
 
-	JudyHSFreeArray(&c->string_unicode_map_judy, 0);
-	JudyHSFreeArray(&c->bitvector_map_judy, 0);
+	pointless_arena_destroy(&c->arena);
+
+	pointless_bytes_table_destroy(&c->string_unicode_map);
+	pointless_bytes_table_destroy(&c->bitvector_map);
+
+	if (c->spill) {
+		pointless_spill_destroy(c->spill);
+		pointless_free(c->spill);
+		c->spill = 0;
+	}
+
+	pointless_free(c->backing);
+	c->backing = 0;
+}
+
+static uint32_t pointless_create_spill_kind(uint32_t type)
+{
+	return (type == POINTLESS_BITVECTOR) ? POINTLESS_SPILL_BITVECTOR : POINTLESS_SPILL_STRING_UNICODE;
+}
+
+// size of a string/unicode or uncompressed bitvector on the heap, before alignment
+static uint64_t pointless_create_buffer_heap_size(pointless_create_t* c, uint32_t type, void* buffer)
+{
+	uint32_t* s = (uint32_t*)buffer;
+
+	switch (type) {
+		case POINTLESS_UNICODE_:
+			if (c->features & POINTLESS_FF_FEATURE_UTF8)
+				return sizeof(uint32_t) + (pointless_ucs4_utf8_len(s + 1) + 1) * sizeof(uint8_t);
+
+			return sizeof(uint32_t) + (s[0] + 1) * sizeof(pointless_unicode_char_t);
+		case POINTLESS_STRING_:
+			return sizeof(uint32_t) + (s[0] + 1) * sizeof(uint8_t);
+	}
+
+	assert(type == POINTLESS_BITVECTOR);
+	return sizeof(uint32_t) + ICEIL(s[0], 8);
+}
+
+static uint64_t pointless_create_value_heap_size(pointless_create_t* c, uint32_t i)
+{
+	uint32_t type = cv_value_type(i);
+
+	if (c->spill)
+		return pointless_spill_entry_at(c->spill, pointless_create_spill_kind(type), cv_value_data_u32(i))->n_heap;
 
-	c->string_unicode_map_judy = 0;
-	c->bitvector_map_judy = 0;
+	return pointless_create_buffer_heap_size(c, type, (type == POINTLESS_BITVECTOR) ? cv_bitvector_at(i) : cv_string_at(i));
+}
+
+// create-time buffer of a string/unicode or uncompressed bitvector, read back from the spill file if there is one
+static void* pointless_create_value_buffer(pointless_create_t* c, pointless_spill_reader_t* r, uint32_t i, const char** error)
+{
+	uint32_t type = cv_value_type(i);
+
+	if (c->spill)
+		return pointless_spill_reader_get(r, pointless_create_spill_kind(type), cv_value_data_u32(i), error);
+
+	return (type == POINTLESS_BITVECTOR) ? cv_bitvector_at(i) : cv_string_at(i);
 }
 
 static int pointless_serialize_string(pointless_create_cb_t* cb, void* string_buffer, const char** error)
@@ -326,6 +1001,37 @@ static int pointless_serialize_unicode(pointless_create_cb_t* cb, void* unicode_
 	return 1;
 }
 
+static int pointless_serialize_unicode_utf8(pointless_create_cb_t* cb, void* unicode_buffer, const char** error)
+{
+	uint32_t* len = (uint32_t*)unicode_buffer;
+	uint8_t* utf8 = pointless_ucs4_to_utf8((pointless_unicode_char_t*)(len + 1));
+	uint32_t utf8_len;
+	int retval = 0;
+
+	if (utf8 == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	utf8_len = (uint32_t)pointless_ascii_len(utf8);
+
+	if (!(*cb->write)(&utf8_len, sizeof(utf8_len), cb->user, error))
+		goto cleanup;
+
+	if (!(*cb->write)(utf8, (utf8_len + 1) * sizeof(uint8_t), cb->user, error))
+		goto cleanup;
+
+	if (!(*cb->align_4)(cb->user, error))
+		goto cleanup;
+
+	retval = 1;
+
+cleanup:
+
+	pointless_free(utf8);
+	return retval;
+}
+
 static int pointless_serialize_vector_outside(pointless_create_t* c, uint32_t vector, pointless_create_cb_t* cb, const char** error)
 {
 	assert(cv_is_outside_vector(vector) == 1);
@@ -543,12 +1249,19 @@ static int pointless_serialize_set(pointless_create_cb_t* cb, pointless_create_t
 
 	pointless_set_header_t header;
 	header.n_items = pointless_dynarray_n_items(&cv_set_at(s)->keys);
-	header.padding = 0;
 	header.hash_vector = pointless_create_to_read_value(c, hash_vector_handle, n_priv_vectors);
-	header.key_vector = pointless_create_to_read_value(c, keys_vector_handle, n_priv_vectors);
+
+	header.layout = c_hash_table_layout();
+
+	if (c_is_split()) {
+		header.key_vector = pointless_create_to_read_value(c, keys_vector_handle, n_priv_vectors);
+	} else {
+		header.key_vector.type = POINTLESS_VECTOR_EMPTY;
+		header.key_vector.data.data_u32 = 0;
+	}
 
 	assert(header.hash_vector.type == POINTLESS_VECTOR_U32);
-	assert(header.key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
+	assert(header.key_vector.type == (c_is_split() ? POINTLESS_VECTOR_VALUE_HASHABLE : POINTLESS_VECTOR_EMPTY));
 
 	if (!(cb->write)(&header, sizeof(header), cb->user, error))
 		return 0;
@@ -569,14 +1282,23 @@ static int pointless_serialize_map(pointless_create_cb_t* cb, pointless_create_t
 
 	pointless_map_header_t header;
 	header.n_items = pointless_dynarray_n_items(&cv_map_at(m)->keys);
-	header.padding = 0;
 	header.hash_vector = pointless_create_to_read_value(c, hash_vector_handle, n_priv_vectors);
-	header.key_vector = pointless_create_to_read_value(c, keys_vector_handle, n_priv_vectors);
-	header.value_vector = pointless_create_to_read_value(c, values_vector_handle, n_priv_vectors);
+
+	header.layout = c_hash_table_layout();
+
+	if (c_is_split()) {
+		header.key_vector = pointless_create_to_read_value(c, keys_vector_handle, n_priv_vectors);
+		header.value_vector = pointless_create_to_read_value(c, values_vector_handle, n_priv_vectors);
+
+		assert(header.key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
+		assert(header.value_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE || header.value_vector.type == POINTLESS_VECTOR_VALUE);
+	} else {
+		header.key_vector.type = POINTLESS_VECTOR_EMPTY;
+		header.key_vector.data.data_u32 = 0;
+		header.value_vector = header.key_vector;
+	}
 
 	assert(header.hash_vector.type == POINTLESS_VECTOR_U32);
-	assert(header.key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
-	assert(header.value_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE || header.value_vector.type == POINTLESS_VECTOR_VALUE);
 	assert(pointless_is_vector_type(header.value_vector.type));
 
 	if (!(cb->write)(&header, sizeof(header), cb->user, error))
@@ -679,223 +1401,170 @@ static uint32_t pointless_create_vector_compression(pointless_create_t* c, uint3
 	// we must have hit something here already
 	assert(0);
 	return 0;
-}
-
-static int pointless_create_output_and_end_(pointless_create_t* c, pointless_create_cb_t* cb, const char** error)
-{
-	// return value
-	int retval = 1;
-
-	switch (c->version) {
-		case POINTLESS_FF_VERSION_OFFSET_32_OLDHASH:
-		case POINTLESS_FF_VERSION_OFFSET_32_NEWHASH:
-			*error = "unsupported version";
-			return 0;
-		case POINTLESS_FF_VERSION_OFFSET_64_NEWHASH:
-			break;
-		default:
-			*error = "unsupported version";
-			return 0;
-	}
-
-	uint32_t debug_n_maps, debug_n_sets, debug_n_bitvectors, debug_n_outside_vectors, debug_n_priv_vectors, debug_n_string_unicode;
-	uint32_t n_priv_vectors, n_outside_vectors, n_sets, n_maps;
-	uint32_t i, n_values;
-
-	uint64_t current_offset_64;
-
-	pointless_dynarray_t temp;
-
-	// bitmask for each container, used in cycle-detection
-	void* cycle_marker = 0;
-
-	// since we're removing some vectors from c->priv_vector_values, references to it change, so we need
-	// a new c->priv_vector_values
-	pointless_dynarray_t new_priv_vector_values;
-	pointless_dynarray_init(&new_priv_vector_values, sizeof(pointless_create_vector_priv_t));
-
-	// we must have a root
-	if (c->root == UINT32_MAX) {
-		*error = "root has not been set";
-		goto error_cleanup;
-	}
-
-	// NOTE: value vector will grow, but the first 'n_values' items are the ones we want to serialize
-	n_values = pointless_dynarray_n_items(&c->values);
-
-	// count number of non-empty vectors, sets and maps, and perform work for empty vectors
-	// we are not allowed to do this for vectors used to hold set/map keys and hashes, so we
-	// ignore those
-	n_priv_vectors = 0, n_outside_vectors = 0, n_sets = 0, n_maps = 0;
-
-	for (i = 0; i < n_values; i++) {
-		switch (cv_value_type(i)) {
-			case POINTLESS_VECTOR_I8:
-			case POINTLESS_VECTOR_U8:
-			case POINTLESS_VECTOR_I16:
-			case POINTLESS_VECTOR_U16:
-			case POINTLESS_VECTOR_I32:
-			case POINTLESS_VECTOR_U32:
-			case POINTLESS_VECTOR_I64:
-			case POINTLESS_VECTOR_U64:
-			case POINTLESS_VECTOR_FLOAT:
-			case POINTLESS_VECTOR_VALUE:
-				// we only do this for private vector
-				if (cv_is_outside_vector(i)) {
-					n_outside_vectors += 1;
-					break;
-				}
-				// set/map vectors can not be emptied
-				if (pointless_dynarray_n_items(&cv_priv_vector_at(i)->vector) == 0 && cv_is_set_map_vector(i) == 0) {
-					cv_value_at(i)->header.type_29 = POINTLESS_VECTOR_EMPTY;
-					cv_value_at(i)->data.data_u32 = 0;
-				} else {
-					if (!pointless_dynarray_push(&new_priv_vector_values, cv_priv_vector_at(i))) {
-						*error = "out of memory I";
-						goto error_cleanup;
-					}
-
-					cv_value_at(i)->data.data_u32 = n_priv_vectors++;
-				}
-
-				break;
-			case POINTLESS_SET_VALUE:
-				cv_value_at(i)->data.data_u32 = n_sets++;
-				break;
-			case POINTLESS_MAP_VALUE_VALUE:
-				cv_value_at(i)->data.data_u32 = n_maps++;
-				break;
-			case POINTLESS_VECTOR_VALUE_HASHABLE:
-				assert(0);
-				break;
-		}
-	}
+}
 
-	// now, c->priv_vector_values should become new_priv_vector_values, but we must not forget to
-	// cleanup c->priv_vector_values, so we just swap them, and c->priv_vector_values will be
-	// cleaned up as new_priv_vector_values, later on
-	temp = new_priv_vector_values;
-	new_priv_vector_values = c->priv_vector_values;
-	c->priv_vector_values = temp;
+// output wrapper for POINTLESS_FF_FEATURE_CHECKSUM, checksums the header, each offset
+// vector and each heap block as they are written, and appends the trailer at the end
+typedef struct {
+	pointless_create_cb_t* out;
+	uint64_t pos;
+	uint64_t section_end[6];
+	uint32_t section;
+	pointless_checksum_state_t state;
+	pointless_checksum_trailer_t trailer;
+	pointless_dynarray_t heap_block_checksums;
+} pointless_checksum_writer_t;
+
+static void checksum_writer_init(pointless_checksum_writer_t* w, pointless_create_cb_t* out, pointless_header_t* header)
+{
+	uint32_t n_offsets[5] = {header->n_string_unicode, header->n_vector, header->n_bitvector, header->n_set, header->n_map};
+	uint32_t i;
 
+	w->out = out;
+	w->pos = 0;
+	w->section = 0;
+	w->section_end[0] = sizeof(pointless_header_t);
 
-	// check which vectors are hashable
-	cycle_marker = pointless_cycle_marker_create(c, error);
+	for (i = 0; i < 5; i++)
+		w->section_end[i + 1] = w->section_end[i] + (uint64_t)n_offsets[i] * sizeof(uint64_t);
 
-	if (cycle_marker == 0) {
-		goto error_cleanup;
+	memset(&w->trailer, 0, sizeof(w->trailer));
+	w->trailer.heap_block_size = POINTLESS_CHECKSUM_HEAP_BLOCK_SIZE;
+
+	pointless_checksum_64_init(&w->state, 0);
+}
+
+// close the header/offset vector sections ending at the current position, empty ones included
+static void checksum_writer_close_sections(pointless_checksum_writer_t* w)
+{
+	while (w->section < 6 && w->pos == w->section_end[w->section]) {
+		if (w->section == 0)
+			w->trailer.header_checksum = pointless_checksum_64_digest(&w->state);
+		else
+			w->trailer.offsets_checksum[w->section - 1] = pointless_checksum_64_digest(&w->state);
+
+		pointless_checksum_64_init(&w->state, 0);
+		w->section += 1;
 	}
+}
 
-	// ...and mark the ones which are
-	for (i = 0; i < n_values; i++) {
-		//printf("value type %i is %i\n", (int)i, (int)cv_value_type(i));
-		if (cv_value_type(i) == POINTLESS_VECTOR_VALUE && !cv_is_outside_vector(i)) {
-			if (!bm_is_set_(cycle_marker, i)) {
-				cv_value_at(i)->header.type_29 = POINTLESS_VECTOR_VALUE_HASHABLE;
-				//printf("hashable %i\n", (int)i);
-			}
-		}
+static int checksum_writer_close_block(pointless_checksum_writer_t* w, const char** error)
+{
+	uint64_t checksum = pointless_checksum_64_digest(&w->state);
+
+	if (!pointless_dynarray_push(&w->heap_block_checksums, &checksum)) {
+		*error = "out of memory";
+		return 0;
 	}
 
-	// check vectors for compressability
-	for (i = 0; i < n_values; i++) {
-		// we can not compress outside vector
-		switch (cv_value_type(i)) {
-			case POINTLESS_VECTOR_VALUE:
-			case POINTLESS_VECTOR_VALUE_HASHABLE:
-				// we're not allowed to compress outside or set/map vectors
-				if (cv_is_outside_vector(i) == 0 && cv_is_set_map_vector(i) == 0) {
-					cv_value_at(i)->header.type_29 = pointless_create_vector_compression(c, i);
+	pointless_checksum_64_init(&w->state, 0);
+	return 1;
+}
 
-					if (cv_value_at(i)->header.type_29 != POINTLESS_VECTOR_VALUE && cv_value_at(i)->header.type_29 != POINTLESS_VECTOR_VALUE_HASHABLE) {
-						//printf("compressed %i to %i\n", (int)i, (int)cv_value_at(i)->header.type_29);
-						cv_value_at(i)->header.is_compressed_vector = 1;
-					}
-				}
+static int checksum_writer_write(void* data, size_t datalen, void* user, const char** error)
+{
+	pointless_checksum_writer_t* w = (pointless_checksum_writer_t*)user;
+	uint8_t* p = (uint8_t*)data;
+	size_t left = datalen;
 
-				break;
+	while (left > 0) {
+		uint64_t end;
+
+		if (w->section < 6) {
+			end = w->section_end[w->section];
+		} else {
+			uint64_t heap_pos = w->pos - w->section_end[5];
+			end = w->pos + (POINTLESS_CHECKSUM_HEAP_BLOCK_SIZE - heap_pos % POINTLESS_CHECKSUM_HEAP_BLOCK_SIZE);
 		}
+
+		size_t n = (size_t)SIMPLE_MIN((uint64_t)left, end - w->pos);
+
+		pointless_checksum_64_update(&w->state, p, n);
+		w->pos += n;
+		p += n;
+		left -= n;
+
+		if (w->section < 6)
+			checksum_writer_close_sections(w);
+		else if (w->pos == end && !checksum_writer_close_block(w, error))
+			return 0;
 	}
 
+	return (*w->out->write)(data, datalen, w->out->user, error);
+}
 
-	// right, now populate the hash, key and value vectors for sets and maps
-	for (i = 0; i < n_values; i++) {
-		if (cv_value_type(i) == POINTLESS_SET_VALUE) {
-			// serialize vectors must have been initialized
-			assert(cv_set_at(i)->serialize_hash != POINTLESS_CREATE_VALUE_FAIL);
-			assert(cv_set_at(i)->serialize_keys != POINTLESS_CREATE_VALUE_FAIL);
+static int checksum_writer_align_4(void* user, const char** error)
+{
+	pointless_checksum_writer_t* w = (pointless_checksum_writer_t*)user;
+	uint32_t v = 0;
 
-			// they must be legal values
-			assert(cv_set_at(i)->serialize_hash < pointless_dynarray_n_items(&c->values));
-			assert(cv_set_at(i)->serialize_keys < pointless_dynarray_n_items(&c->values));
+	return checksum_writer_write(&v, (size_t)(align_next_4_64(w->pos) - w->pos), user, error);
+}
 
-			// the must be of the expected type
-			assert(cv_value_type(cv_set_at(i)->serialize_hash) == POINTLESS_VECTOR_U32);
-			assert(cv_value_type(cv_set_at(i)->serialize_keys) == POINTLESS_VECTOR_VALUE_HASHABLE);
+static int checksum_writer_finish(pointless_checksum_writer_t* w, const char** error)
+{
+	// we always have a header, and the offset vectors are written before any heap data
+	checksum_writer_close_sections(w);
+	assert(w->section == 6);
 
-			// ..and they must be empty
-			assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_set_at(i)->serialize_hash)->vector) == 0);
-			assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_set_at(i)->serialize_keys)->vector) == 0);
+	w->trailer.heap_len = w->pos - w->section_end[5];
 
-			// now we can populate these
-			if (!pointless_hash_table_create(c, i, error))
-				goto error_cleanup;
-		}
-	}
+	if (w->trailer.heap_len % POINTLESS_CHECKSUM_HEAP_BLOCK_SIZE != 0 && !checksum_writer_close_block(w, error))
+		return 0;
 
-	// there is at least one more memory optimization available: it is possible to generate the serialize vectors
-	// for sets/maps on the fly, when their respective vectors are serialized. i'm not sure on how to implement
-	// this exactly, but if the need arose, this is fairly easy, methinks.
+	w->trailer.n_heap_blocks = pointless_dynarray_n_items(&w->heap_block_checksums);
+	assert(w->trailer.n_heap_blocks == ICEIL(w->trailer.heap_len, POINTLESS_CHECKSUM_HEAP_BLOCK_SIZE));
 
-	for (i = 0; i < n_values; i++) {
-		if (cv_value_type(i) == POINTLESS_MAP_VALUE_VALUE) {
-			// serialize vectors must have been initalized
-			assert(cv_map_at(i)->serialize_hash != POINTLESS_CREATE_VALUE_FAIL);
-			assert(cv_map_at(i)->serialize_keys != POINTLESS_CREATE_VALUE_FAIL);
-			assert(cv_map_at(i)->serialize_values != POINTLESS_CREATE_VALUE_FAIL);
+	// trailer starts 8-byte aligned
+	uint64_t padding = 0;
+	size_t n_padding = (size_t)((8 - w->pos % 8) % 8);
 
-			// they must be legal values
-			assert(cv_map_at(i)->serialize_hash < pointless_dynarray_n_items(&c->values));
-			assert(cv_map_at(i)->serialize_keys < pointless_dynarray_n_items(&c->values));
-			assert(cv_map_at(i)->serialize_values < pointless_dynarray_n_items(&c->values));
+	if (!(*w->out->write)(&padding, n_padding, w->out->user, error))
+		return 0;
 
-			// they must be of the expected type
-			assert(cv_value_type(cv_map_at(i)->serialize_hash) == POINTLESS_VECTOR_U32);
-			assert(cv_value_type(cv_map_at(i)->serialize_keys) == POINTLESS_VECTOR_VALUE_HASHABLE);
-			assert(cv_value_type(cv_map_at(i)->serialize_values) == POINTLESS_VECTOR_VALUE || cv_value_type(cv_map_at(i)->serialize_values) == POINTLESS_VECTOR_VALUE_HASHABLE);
+	size_t n_checksums = (size_t)w->trailer.n_heap_blocks * sizeof(uint64_t);
+	pointless_checksum_state_t state;
+	pointless_checksum_64_init(&state, 0);
+	pointless_checksum_64_update(&state, w->heap_block_checksums._data, n_checksums);
+	pointless_checksum_64_update(&state, &w->trailer, offsetof(pointless_checksum_trailer_t, trailer_checksum));
+	w->trailer.trailer_checksum = pointless_checksum_64_digest(&state);
 
-			// ..and they must be empty
-			assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_map_at(i)->serialize_hash)->vector) == 0);
-			assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_map_at(i)->serialize_keys)->vector) == 0);
-			assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_map_at(i)->serialize_values)->vector) == 0);
+	if (!(*w->out->write)(w->heap_block_checksums._data, n_checksums, w->out->user, error))
+		return 0;
 
-			// now we can populate these
-			if (!pointless_hash_table_create(c, i, error))
-				goto error_cleanup;
-		}
-	}
+	return (*w->out->write)(&w->trailer, sizeof(w->trailer), w->out->user, error);
+}
 
-	// header
-	pointless_header_t header;
-	header.root = pointless_create_to_read_value(c, c->root, n_priv_vectors);
-	header.n_string_unicode = c->string_unicode_map_judy_count;
-	header.n_vector = n_priv_vectors + n_outside_vectors;
-	header.n_bitvector = c->bitvector_map_judy_count;
-	header.n_set = n_sets;
-	header.n_map = n_maps;
-	header.version = c->version;
+// size of the output with the given header and heap size
+static uint64_t pointless_create_output_size(pointless_create_t* c, pointless_header_t* header, uint64_t heap_size)
+{
+	uint64_t n_offsets = (uint64_t)header->n_string_unicode + header->n_vector + header->n_bitvector + header->n_set + header->n_map;
+	uint64_t n_bytes = sizeof(pointless_header_t) + n_offsets * sizeof(uint64_t) + heap_size;
 
-	// write it out
-	if (!(*cb->write)(&header, sizeof(header), cb->user, error))
-		goto error_cleanup;
+	// the trailer starts 8-byte aligned, after the checksum of each heap block
+	if (c->features & POINTLESS_FF_FEATURE_CHECKSUM)
+		n_bytes = ICEIL(n_bytes, 8) * 8 + ICEIL(heap_size, POINTLESS_CHECKSUM_HEAP_BLOCK_SIZE) * sizeof(uint64_t) + sizeof(pointless_checksum_trailer_t);
+
+	return n_bytes;
+}
+
+// writes the offset vectors, or only walks them if cb is 0, and returns the size of the heap they point into
+static int pointless_create_output_offsets(pointless_create_t* c, pointless_create_cb_t* cb, pointless_header_t* header, uint32_t n_values, uint32_t n_priv_vectors, uint32_t n_outside_vectors, uint64_t* heap_size, const char** error)
+{
+	uint32_t debug_n_maps, debug_n_sets, debug_n_bitvectors, debug_n_outside_vectors, debug_n_priv_vectors, debug_n_string_unicode;
+	uint32_t i;
+	uint64_t current_offset_64;
 
-	// current offset value, refs are relative to heap base
+	// current offset value, refs are relative to heap base, which starts with the stored hashes, if any
 	current_offset_64 = 0;
 
+	if (c->features & POINTLESS_FF_FEATURE_HASH_SLOTS)
+		current_offset_64 = ((uint64_t)header->n_string_unicode + (uint64_t)header->n_vector) * sizeof(uint32_t);
+
 	// write out offset vectors, first unicodes
 	debug_n_string_unicode = 0;
 
-	#define PC_WRITE_OFFSET() if (!(*cb->write)(&current_offset_64, sizeof(current_offset_64), cb->user, error)) {goto error_cleanup;}
+	#define PC_WRITE_OFFSET() if (cb && !(*cb->write)(&current_offset_64, sizeof(current_offset_64), cb->user, error)) {return 0;}
 	#define PC_INCREMENT_OFFSET(f) {current_offset_64 += (f);}
 	#define PC_ALIGN_OFFSET() {current_offset_64 = align_next_4_64(current_offset_64);}
 
@@ -904,7 +1573,7 @@ static int pointless_create_output_and_end_(pointless_create_t* c, pointless_cre
 			assert(cv_value_data_u32(i) == debug_n_string_unicode);
 
 			PC_WRITE_OFFSET();
-			PC_INCREMENT_OFFSET(sizeof(uint32_t) + (*((uint32_t*)cv_unicode_at(i)) + 1) * sizeof(pointless_unicode_char_t));
+			PC_INCREMENT_OFFSET(pointless_create_value_heap_size(c, i));
 			PC_ALIGN_OFFSET();
 			debug_n_string_unicode += 1;
 		}
@@ -913,13 +1582,13 @@ static int pointless_create_output_and_end_(pointless_create_t* c, pointless_cre
 			assert(cv_value_data_u32(i) == debug_n_string_unicode);
 
 			PC_WRITE_OFFSET();
-			PC_INCREMENT_OFFSET(sizeof(uint32_t) + (*((uint32_t*)cv_string_at(i)) + 1) * sizeof(uint8_t));
+			PC_INCREMENT_OFFSET(pointless_create_value_heap_size(c, i));
 			PC_ALIGN_OFFSET();
 			debug_n_string_unicode += 1;
 		}
 	}
 
-	assert(debug_n_string_unicode == c->string_unicode_map_judy_count);
+	assert(debug_n_string_unicode == c->string_unicode_count);
 
 	// then private vectors
 	debug_n_priv_vectors = 0;
@@ -1023,75 +1692,381 @@ static int pointless_create_output_and_end_(pointless_create_t* c, pointless_cre
 			case POINTLESS_VECTOR_U64:
 				vector_heap_size = sizeof(uint32_t) + n_items * sizeof(uint64_t);
 				break;
-			case POINTLESS_VECTOR_FLOAT:
-				vector_heap_size = sizeof(uint32_t) + n_items * sizeof(float);
+			case POINTLESS_VECTOR_FLOAT:
+				vector_heap_size = sizeof(uint32_t) + n_items * sizeof(float);
+				break;
+			default:
+				assert(0);
+				break;
+		}
+
+		PC_WRITE_OFFSET();
+		PC_INCREMENT_OFFSET(vector_heap_size);
+		PC_ALIGN_OFFSET();
+		debug_n_outside_vectors += 1;
+	}
+
+	assert(debug_n_outside_vectors == n_outside_vectors);
+
+	// then uncompressed bitvectors
+	debug_n_bitvectors = 0;
+
+	for (i = 0; i < n_values; i++) {
+		if (cv_value_type(i) == POINTLESS_BITVECTOR) {
+			assert(cv_value_data_u32(i) == debug_n_bitvectors);
+
+			PC_WRITE_OFFSET();
+			PC_INCREMENT_OFFSET(pointless_create_value_heap_size(c, i));
+			PC_ALIGN_OFFSET();
+			debug_n_bitvectors += 1;
+		}
+	}
+
+	assert(debug_n_bitvectors == c->bitvector_count);
+
+	// then sets
+	debug_n_sets = 0;
+
+	for (i = 0; i < n_values; i++) {
+		if (cv_value_type(i) == POINTLESS_SET_VALUE) {
+			assert(cv_value_data_u32(i) == debug_n_sets);
+
+			PC_WRITE_OFFSET();
+			PC_INCREMENT_OFFSET(sizeof(pointless_set_header_t));
+			PC_ALIGN_OFFSET();
+			debug_n_sets += 1;
+		}
+	}
+
+	// then maps
+	debug_n_maps = 0;
+
+	for (i = 0; i < n_values; i++) {
+		if (cv_value_type(i) == POINTLESS_MAP_VALUE_VALUE) {
+			assert(cv_value_data_u32(i) == debug_n_maps);
+
+			PC_WRITE_OFFSET();
+			PC_INCREMENT_OFFSET(sizeof(pointless_map_header_t));
+			PC_ALIGN_OFFSET();
+			debug_n_maps += 1;
+		}
+	}
+
+	#undef PC_WRITE_OFFSET
+	#undef PC_INCREMENT_OFFSET
+	#undef PC_ALIGN_OFFSET
+
+	*heap_size = current_offset_64;
+	return 1;
+}
+
+static int pointless_create_output_and_end_(pointless_create_t* c, pointless_create_cb_t* cb, const char** error)
+{
+	// return value
+	int retval = 1;
+
+	switch (POINTLESS_FF_VERSION_NUMBER(c->version)) {
+		case POINTLESS_FF_VERSION_OFFSET_32_OLDHASH:
+		case POINTLESS_FF_VERSION_OFFSET_32_NEWHASH:
+			*error = "unsupported version";
+			return 0;
+		case POINTLESS_FF_VERSION_OFFSET_64_NEWHASH:
+		case POINTLESS_FF_VERSION_OFFSET_64_FEATURES:
+			break;
+		default:
+			*error = "unsupported version";
+			return 0;
+	}
+
+	uint32_t n_priv_vectors, n_outside_vectors, n_sets, n_maps;
+	uint32_t i, n_values;
+
+	uint64_t heap_size;
+
+	pointless_dynarray_t temp;
+
+	// bitmask for each container, used in cycle-detection
+	void* cycle_marker = 0;
+
+	// the "empty slot" value of all hash tables, and their jobs if they are built in parallel
+	uint32_t empty_slot_handle = POINTLESS_CREATE_VALUE_FAIL;
+	pointless_hash_table_job_t* jobs = 0;
+	uint32_t n_jobs = 0;
+
+	// since we're removing some vectors from c->priv_vector_values, references to it change, so we need
+	// a new c->priv_vector_values
+	pointless_dynarray_t new_priv_vector_values;
+	pointless_dynarray_init(&new_priv_vector_values, sizeof(pointless_create_vector_priv_t));
+	pointless_dynarray_set_backing(&new_priv_vector_values, c->backing);
+
+	// only used for files with section checksums
+	pointless_checksum_writer_t checksum_writer;
+	pointless_create_cb_t checksum_cb;
+	pointless_dynarray_init(&checksum_writer.heap_block_checksums, sizeof(uint64_t));
+
+	// spilled string/unicode and bitvector buffers are read back in file order while the heap is written
+	pointless_spill_reader_t spill_reader;
+	pointless_spill_reader_init(&spill_reader, c->spill);
+	void* buffer = 0;
+
+	// we must have a root
+	if (c->root == UINT32_MAX) {
+		*error = "root has not been set";
+		goto error_cleanup;
+	}
+
+	// NOTE: value vector will grow, but the first 'n_values' items are the ones we want to serialize
+	n_values = pointless_dynarray_n_items(&c->values);
+
+	// count number of non-empty vectors, sets and maps, and perform work for empty vectors
+	// we are not allowed to do this for vectors used to hold set/map keys and hashes, so we
+	// ignore those
+	n_priv_vectors = 0, n_outside_vectors = 0, n_sets = 0, n_maps = 0;
+
+	for (i = 0; i < n_values; i++) {
+		switch (cv_value_type(i)) {
+			case POINTLESS_VECTOR_I8:
+			case POINTLESS_VECTOR_U8:
+			case POINTLESS_VECTOR_I16:
+			case POINTLESS_VECTOR_U16:
+			case POINTLESS_VECTOR_I32:
+			case POINTLESS_VECTOR_U32:
+			case POINTLESS_VECTOR_I64:
+			case POINTLESS_VECTOR_U64:
+			case POINTLESS_VECTOR_FLOAT:
+			case POINTLESS_VECTOR_VALUE:
+				// we only do this for private vector
+				if (cv_is_outside_vector(i)) {
+					n_outside_vectors += 1;
+					break;
+				}
+				// set/map vectors can not be emptied
+				if (pointless_dynarray_n_items(&cv_priv_vector_at(i)->vector) == 0 && cv_is_set_map_vector(i) == 0) {
+					cv_value_at(i)->header.type_29 = POINTLESS_VECTOR_EMPTY;
+					cv_value_at(i)->data.data_u32 = 0;
+				} else {
+					if (!pointless_dynarray_push(&new_priv_vector_values, cv_priv_vector_at(i))) {
+						*error = "out of memory I";
+						goto error_cleanup;
+					}
+
+					cv_value_at(i)->data.data_u32 = n_priv_vectors++;
+				}
+
+				break;
+			case POINTLESS_SET_VALUE:
+				cv_value_at(i)->data.data_u32 = n_sets++;
+				break;
+			case POINTLESS_MAP_VALUE_VALUE:
+				cv_value_at(i)->data.data_u32 = n_maps++;
 				break;
-			default:
+			case POINTLESS_VECTOR_VALUE_HASHABLE:
 				assert(0);
 				break;
 		}
-
-		PC_WRITE_OFFSET();
-		PC_INCREMENT_OFFSET(vector_heap_size);
-		PC_ALIGN_OFFSET();
-		debug_n_outside_vectors += 1;
 	}
 
-	assert(debug_n_outside_vectors == n_outside_vectors);
+	// now, c->priv_vector_values should become new_priv_vector_values, but we must not forget to
+	// cleanup c->priv_vector_values, so we just swap them, and c->priv_vector_values will be
+	// cleaned up as new_priv_vector_values, later on
+	temp = new_priv_vector_values;
+	new_priv_vector_values = c->priv_vector_values;
+	c->priv_vector_values = temp;
 
-	// then uncompressed bitvectors
-	debug_n_bitvectors = 0;
 
+	// check which vectors are hashable, without cycles, they all are
+	if (c->may_have_cycles && !c->is_acyclic) {
+		cycle_marker = pointless_cycle_marker_create(c, error);
+
+		if (cycle_marker == 0) {
+			goto error_cleanup;
+		}
+	}
+
+	// ...and mark the ones which are
 	for (i = 0; i < n_values; i++) {
-		if (cv_value_type(i) == POINTLESS_BITVECTOR) {
-			assert(cv_value_data_u32(i) == debug_n_bitvectors);
+		//printf("value type %i is %i\n", (int)i, (int)cv_value_type(i));
+		if (cv_value_type(i) == POINTLESS_VECTOR_VALUE && !cv_is_outside_vector(i)) {
+			if (cycle_marker == 0 || !bm_is_set_(cycle_marker, i)) {
+				cv_value_at(i)->header.type_29 = POINTLESS_VECTOR_VALUE_HASHABLE;
+				//printf("hashable %i\n", (int)i);
+			}
+		}
+	}
 
-			PC_WRITE_OFFSET();
-			PC_INCREMENT_OFFSET(sizeof(uint32_t) + ICEIL(*((uint32_t*)cv_bitvector_at(i)), 8));
-			PC_ALIGN_OFFSET();
-			debug_n_bitvectors += 1;
+	// check vectors for compressability
+	for (i = 0; i < n_values; i++) {
+		// we can not compress outside vector
+		switch (cv_value_type(i)) {
+			case POINTLESS_VECTOR_VALUE:
+			case POINTLESS_VECTOR_VALUE_HASHABLE:
+				// we're not allowed to compress outside or set/map vectors
+				if (cv_is_outside_vector(i) == 0 && cv_is_set_map_vector(i) == 0) {
+					cv_value_at(i)->header.type_29 = pointless_create_vector_compression(c, i);
+
+					if (cv_value_at(i)->header.type_29 != POINTLESS_VECTOR_VALUE && cv_value_at(i)->header.type_29 != POINTLESS_VECTOR_VALUE_HASHABLE) {
+						//printf("compressed %i to %i\n", (int)i, (int)cv_value_at(i)->header.type_29);
+						cv_value_at(i)->header.is_compressed_vector = 1;
+					}
+				}
+
+				break;
 		}
 	}
 
-	assert(debug_n_bitvectors == c->bitvector_map_judy_count);
 
-	// then sets
-	debug_n_sets = 0;
+	// the empty slot value is created up front, so that building a hash table never grows c->values
+	if (n_sets + n_maps > 0) {
+		empty_slot_handle = pointless_create_empty_slot(c);
+
+		if (empty_slot_handle == POINTLESS_CREATE_VALUE_FAIL) {
+			*error = "out of memory D";
+			goto error_cleanup;
+		}
+	}
+
+	// with more than one thread, the tables are collected here and built by a worker pool after the loops below
+	if (c->n_threads > 1 && n_sets + n_maps > 0) {
+		jobs = (pointless_hash_table_job_t*)pointless_malloc(sizeof(pointless_hash_table_job_t) * ((size_t)n_sets + (size_t)n_maps));
+
+		if (jobs == 0) {
+			*error = "out of memory";
+			goto error_cleanup;
+		}
+	}
 
+	// right, now populate the hash, key and value vectors for sets and maps
 	for (i = 0; i < n_values; i++) {
 		if (cv_value_type(i) == POINTLESS_SET_VALUE) {
-			assert(cv_value_data_u32(i) == debug_n_sets);
+			// serialize vectors must have been initialized
+			assert(cv_set_at(i)->serialize_hash != POINTLESS_CREATE_VALUE_FAIL);
+			assert(cv_set_at(i)->serialize_keys != POINTLESS_CREATE_VALUE_FAIL || !c_is_split());
 
-			PC_WRITE_OFFSET();
-			PC_INCREMENT_OFFSET(sizeof(pointless_set_header_t));
-			PC_ALIGN_OFFSET();
-			debug_n_sets += 1;
+			// they must be legal values
+			assert(cv_set_at(i)->serialize_hash < pointless_dynarray_n_items(&c->values));
+
+			// the must be of the expected type
+			assert(cv_value_type(cv_set_at(i)->serialize_hash) == POINTLESS_VECTOR_U32);
+
+			// ..and they must be empty
+			assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_set_at(i)->serialize_hash)->vector) == 0);
+
+			// same for the key vector, unless the table is interleaved or a minimal perfect hash
+			if (c_is_split()) {
+				assert(cv_set_at(i)->serialize_keys < pointless_dynarray_n_items(&c->values));
+				assert(cv_value_type(cv_set_at(i)->serialize_keys) == POINTLESS_VECTOR_VALUE_HASHABLE);
+				assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_set_at(i)->serialize_keys)->vector) == 0);
+			}
+
+			// now we can populate these
+			if (jobs)
+				pointless_hash_table_job_init(&jobs[n_jobs++], i);
+			else if (!pointless_hash_table_create(c, i, n_priv_vectors, empty_slot_handle, error))
+				goto error_cleanup;
 		}
 	}
 
-	// then maps
-	debug_n_maps = 0;
+	// there is at least one more memory optimization available: it is possible to generate the serialize vectors
+	// for sets/maps on the fly, when their respective vectors are serialized. i'm not sure on how to implement
+	// this exactly, but if the need arose, this is fairly easy, methinks.
 
 	for (i = 0; i < n_values; i++) {
 		if (cv_value_type(i) == POINTLESS_MAP_VALUE_VALUE) {
-			assert(cv_value_data_u32(i) == debug_n_maps);
+			// serialize vectors must have been initalized
+			assert(cv_map_at(i)->serialize_hash != POINTLESS_CREATE_VALUE_FAIL);
+			assert(cv_map_at(i)->serialize_keys != POINTLESS_CREATE_VALUE_FAIL || !c_is_split());
+			assert(cv_map_at(i)->serialize_values != POINTLESS_CREATE_VALUE_FAIL || !c_is_split());
 
-			PC_WRITE_OFFSET();
-			PC_INCREMENT_OFFSET(sizeof(pointless_map_header_t));
-			PC_ALIGN_OFFSET();
-			debug_n_maps += 1;
+			// they must be legal values
+			assert(cv_map_at(i)->serialize_hash < pointless_dynarray_n_items(&c->values));
+
+			// they must be of the expected type
+			assert(cv_value_type(cv_map_at(i)->serialize_hash) == POINTLESS_VECTOR_U32);
+
+			// ..and they must be empty
+			assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_map_at(i)->serialize_hash)->vector) == 0);
+
+			// same for the key/value vectors, unless the table is interleaved or a minimal perfect hash
+			if (c_is_split()) {
+				assert(cv_map_at(i)->serialize_keys < pointless_dynarray_n_items(&c->values));
+				assert(cv_map_at(i)->serialize_values < pointless_dynarray_n_items(&c->values));
+				assert(cv_value_type(cv_map_at(i)->serialize_keys) == POINTLESS_VECTOR_VALUE_HASHABLE);
+				assert(cv_value_type(cv_map_at(i)->serialize_values) == POINTLESS_VECTOR_VALUE || cv_value_type(cv_map_at(i)->serialize_values) == POINTLESS_VECTOR_VALUE_HASHABLE);
+				assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_map_at(i)->serialize_keys)->vector) == 0);
+				assert(pointless_dynarray_n_items(&cv_priv_vector_at(cv_map_at(i)->serialize_values)->vector) == 0);
+			}
+
+			// now we can populate these
+			if (jobs)
+				pointless_hash_table_job_init(&jobs[n_jobs++], i);
+			else if (!pointless_hash_table_create(c, i, n_priv_vectors, empty_slot_handle, error))
+				goto error_cleanup;
 		}
 	}
 
-	// write out heap, unicodes first
+	if (jobs && !pointless_hash_table_create_parallel(c, jobs, n_jobs, n_priv_vectors, empty_slot_handle, error))
+		goto error_cleanup;
+
+	// header
+	pointless_header_t header;
+	header.root = pointless_create_to_read_value(c, c->root, n_priv_vectors);
+	header.n_string_unicode = c->string_unicode_count;
+	header.n_vector = n_priv_vectors + n_outside_vectors;
+	header.n_bitvector = c->bitvector_count;
+	header.n_set = n_sets;
+	header.n_map = n_maps;
+	header.version = c->version;
+
+	// the heap size follows from the offset vectors, so the size of the output is known before any of it is written
+	if (cb->begin) {
+		if (!pointless_create_output_offsets(c, 0, &header, n_values, n_priv_vectors, n_outside_vectors, &heap_size, error))
+			goto error_cleanup;
+
+		if (!(*cb->begin)(pointless_create_output_size(c, &header, heap_size), cb->user, error))
+			goto error_cleanup;
+	}
+
+	// from here on, all output goes through the checksum writer
+	if (c->features & POINTLESS_FF_FEATURE_CHECKSUM) {
+		checksum_writer_init(&checksum_writer, cb, &header);
+		checksum_cb.begin = 0;
+		checksum_cb.write = checksum_writer_write;
+		checksum_cb.align_4 = checksum_writer_align_4;
+		checksum_cb.user = (void*)&checksum_writer;
+		cb = &checksum_cb;
+	}
+
+	// write it out
+	if (!(*cb->write)(&header, sizeof(header), cb->user, error))
+		goto error_cleanup;
+
+	// offset vectors
+	if (!pointless_create_output_offsets(c, cb, &header, n_values, n_priv_vectors, n_outside_vectors, &heap_size, error))
+		goto error_cleanup;
+
+	// write out heap, stored hashes first
+	if ((c->features & POINTLESS_FF_FEATURE_HASH_SLOTS) && !pointless_serialize_hash_slots(cb, c, n_values, error))
+		goto error_cleanup;
+
+	// then unicodes
 	for (i = 0; i < n_values; i++) {
 		if (cv_value_type(i) == POINTLESS_UNICODE_) {
-			if (!pointless_serialize_unicode(cb, cv_unicode_at(i), error))
+			if ((buffer = pointless_create_value_buffer(c, &spill_reader, i, error)) == 0)
+				goto error_cleanup;
+
+			if (c->features & POINTLESS_FF_FEATURE_UTF8) {
+				if (!pointless_serialize_unicode_utf8(cb, buffer, error))
+					goto error_cleanup;
+			} else if (!pointless_serialize_unicode(cb, buffer, error)) {
 				goto error_cleanup;
+			}
 		}
 
 		if (cv_value_type(i) == POINTLESS_STRING_) {
-			if (!pointless_serialize_string(cb, cv_string_at(i), error))
+			if ((buffer = pointless_create_value_buffer(c, &spill_reader, i, error)) == 0)
+				goto error_cleanup;
+
+			if (!pointless_serialize_string(cb, buffer, error))
 				goto error_cleanup;
 		}
 	}
@@ -1148,7 +2123,10 @@ static int pointless_create_output_and_end_(pointless_create_t* c, pointless_cre
 	// bitvectors
 	for (i = 0; i < n_values; i++) {
 		if (cv_value_type(i) == POINTLESS_BITVECTOR) {
-			if (!pointless_serialize_bitvector(cb, cv_bitvector_at(i), error))
+			if ((buffer = pointless_create_value_buffer(c, &spill_reader, i, error)) == 0)
+				goto error_cleanup;
+
+			if (!pointless_serialize_bitvector(cb, buffer, error))
 				goto error_cleanup;
 		}
 	}
@@ -1169,6 +2147,9 @@ static int pointless_create_output_and_end_(pointless_create_t* c, pointless_cre
 		}
 	}
 
+	if ((c->features & POINTLESS_FF_FEATURE_CHECKSUM) && !checksum_writer_finish(&checksum_writer, error))
+		goto error_cleanup;
+
 	retval = 1;
 	goto success_cleanup;
 
@@ -1178,8 +2159,15 @@ error_cleanup:
 
 success_cleanup:
 
+	pointless_dynarray_destroy(&checksum_writer.heap_block_checksums);
 	pointless_dynarray_destroy(&new_priv_vector_values);
 	pointless_free(cycle_marker);
+	pointless_spill_reader_destroy(&spill_reader);
+
+	for (i = 0; jobs && i < n_jobs; i++)
+		pointless_hash_table_job_free(&jobs[i]);
+
+	pointless_free(jobs);
 
 	pointless_create_end(c);
 
@@ -1262,6 +2250,7 @@ int pointless_create_output_and_end_f(pointless_create_t* c, const char* fname,
 	}
 
 	pointless_create_cb_t cb;
+	cb.begin = 0;
 	cb.write = file_write;
 	cb.align_4 = file_align_4;
 	cb.user = (void*)f;
@@ -1343,58 +2332,103 @@ cleanup:
 	return 0;
 }
 
-static int dynarray_write(void* buf, size_t buflen, void* user, const char** error)
+// output into a single buffer of the exact size
+typedef struct {
+	pointless_create_alloc_cb alloc;
+	void* alloc_user;
+	uint8_t* buf;
+	size_t n_buf;
+	size_t pos;
+} pointless_buffer_writer_t;
+
+static int buffer_begin(uint64_t n_bytes, void* user, const char** error)
 {
-	unsigned char* cbuf = (unsigned char*)buf;
-	pointless_dynarray_t* a = (pointless_dynarray_t*)user;
+	pointless_buffer_writer_t* w = (pointless_buffer_writer_t*)user;
 
-	//printf("writing %i bytes to buffer\n", (int)buflen);
+	if (n_bytes > SIZE_MAX) {
+		*error = "output too large for a buffer";
+		return 0;
+	}
 
-	if (!pointless_dynarray_push_bulk(a, cbuf, buflen)) {
+	w->buf = (uint8_t*)(*w->alloc)((size_t)n_bytes, w->alloc_user);
+
+	if (w->buf == 0) {
 		*error = "out of memory";
 		return 0;
 	}
 
+	w->n_buf = (size_t)n_bytes;
 	return 1;
 }
 
-static int dynarray_align_4(void* user, const char** error)
+static int buffer_write(void* buf, size_t buflen, void* user, const char** error)
 {
-	pointless_dynarray_t* a = (pointless_dynarray_t*)user;
-	uint8_t zero = 0;
-	size_t i, n = pointless_dynarray_n_items(a);
-	size_t n_next = align_next_4_size_t(n);
+	pointless_buffer_writer_t* w = (pointless_buffer_writer_t*)user;
 
-	for (i = n; i < n_next; i++) {
-		//printf(" ...aligning X\n");
-		if (!pointless_dynarray_push(a, &zero)) {
-			*error = "out of memory";
-			return 0;
-		}
+	if (buflen > w->n_buf - w->pos) {
+		*error = "output larger than its computed size";
+		return 0;
 	}
 
+	if (buflen > 0)
+		memcpy(w->buf + w->pos, buf, buflen);
+
+	w->pos += buflen;
 	return 1;
 }
 
-int pointless_create_output_and_end_b(pointless_create_t* c, void** buf, size_t* buflen, const char** error)
+static int buffer_align_4(void* user, const char** error)
+{
+	pointless_buffer_writer_t* w = (pointless_buffer_writer_t*)user;
+	uint32_t zero = 0;
+
+	return buffer_write(&zero, align_next_4_size_t(w->pos) - w->pos, user, error);
+}
+
+int pointless_create_output_and_end_a(pointless_create_t* c, pointless_create_alloc_cb alloc, void* user, void** buf, size_t* buflen, const char** error)
 {
-	pointless_dynarray_t a;
-	pointless_dynarray_init(&a, 1);
+	pointless_buffer_writer_t w;
+	w.alloc = alloc;
+	w.alloc_user = user;
+	w.buf = 0;
+	w.n_buf = 0;
+	w.pos = 0;
 
 	pointless_create_cb_t cb;
-	cb.write = dynarray_write;
-	cb.align_4 = dynarray_align_4;
-	cb.user = (void*)&a;
+	cb.begin = buffer_begin;
+	cb.write = buffer_write;
+	cb.align_4 = buffer_align_4;
+	cb.user = (void*)&w;
+
+	if (!pointless_create_output_and_end_(c, &cb, error))
+		return 0;
 
-	if (!pointless_create_output_and_end_(c, &cb, error)) {
-		pointless_dynarray_destroy(&a);
+	if (w.pos != w.n_buf) {
+		*error = "output smaller than its computed size";
 		return 0;
 	}
 
-	*buf = pointless_dynarray_buffer(&a);
-	*buflen = pointless_dynarray_n_items(&a);
+	*buf = w.buf;
+	*buflen = w.n_buf;
 
-	pointless_create_end(c);
+	return 1;
+}
+
+static void* pointless_create_malloc_cb(size_t n_bytes, void* user)
+{
+	void** buf = (void**)user;
+	*buf = pointless_malloc(n_bytes);
+	return *buf;
+}
+
+int pointless_create_output_and_end_b(pointless_create_t* c, void** buf, size_t* buflen, const char** error)
+{
+	void* allocated = 0;
+
+	if (!pointless_create_output_and_end_a(c, pointless_create_malloc_cb, &allocated, buf, buflen, error)) {
+		pointless_free(allocated);
+		return 0;
+	}
 
 	return 1;
 }
@@ -1530,6 +2564,43 @@ uint32_t pointless_create_null(pointless_create_t* c)
 }
 
 
+// string/unicode and bitvector buffers which go to the spill file only pass through the arena
+static uint32_t pointless_create_spill_value(pointless_create_t* c, pointless_create_value_t* value, uint32_t* count, void* buffer, size_t buffer_len, int dedup)
+{
+	uint32_t kind = pointless_create_spill_kind(value->header.type_29);
+	uint32_t handle = POINTLESS_OPEN_TABLE_MISSING;
+
+	if (dedup && !pointless_spill_find(c->spill, kind, buffer, buffer_len, &handle))
+		goto cleanup;
+
+	if (handle != POINTLESS_OPEN_TABLE_MISSING) {
+		pointless_arena_rollback(&c->arena, buffer);
+		return handle;
+	}
+
+	value->data.data_u32 = *count;
+
+	if (!pointless_dynarray_push(&c->values, value))
+		goto cleanup;
+
+	handle = (uint32_t)(pointless_dynarray_n_items(&c->values) - 1);
+
+	if (!pointless_spill_append(c->spill, kind, buffer, buffer_len, pointless_create_buffer_heap_size(c, value->header.type_29, buffer), pointless_hash_create_buffer_32(c, value, buffer), handle, dedup)) {
+		pointless_dynarray_pop(&c->values);
+		goto cleanup;
+	}
+
+	*count += 1;
+
+	pointless_arena_rollback(&c->arena, buffer);
+	return handle;
+
+cleanup:
+
+	pointless_arena_rollback(&c->arena, buffer);
+	return POINTLESS_CREATE_VALUE_FAIL;
+}
+
 // big-values
 uint32_t pointless_create_unicode_ucs4(pointless_create_t* c, uint32_t* v)
 {
@@ -1537,30 +2608,42 @@ uint32_t pointless_create_unicode_ucs4(pointless_create_t* c, uint32_t* v)
 	int pop_value = 0;
 	int pop_unicode = 0;
 
-	Pvoid_t PValue;
-	Pvoid_t prev_ref;
+	uint32_t prev_ref;
 
 	pointless_unicode_char_t* vv;
 
+	// utf-8 can not hold code points above 0x10FFFF
+	if ((c->features & POINTLESS_FF_FEATURE_UTF8) && !pointless_is_ucs4_utf8(v))
+		return POINTLESS_CREATE_VALUE_FAIL;
+
 	// create buffer to hold [uint32 + v]
 	size_t unicode_len = pointless_ucs4_len(v);
 	size_t buffer_len = sizeof(uint32_t) + sizeof(pointless_unicode_char_t) * (unicode_len + 1);
-	void* unicode_buffer = pointless_malloc(buffer_len);
+	void* unicode_buffer = pointless_arena_alloc(&c->arena, buffer_len);
 
 	if (unicode_buffer == 0)
-		goto cleanup;
+		return POINTLESS_CREATE_VALUE_FAIL;
 
 	// setup buffer data
 	*((uint32_t*)unicode_buffer) = (uint32_t)unicode_len;
 	vv = (pointless_unicode_char_t*)((uint32_t*)unicode_buffer + 1);
 	pointless_ucs4_cpy(vv, v);
 
+	if (c->spill) {
+		pointless_create_value_t value;
+		value.header.type_29 = POINTLESS_UNICODE_;
+		value.header.is_outside_vector = 0;
+		value.header.is_compressed_vector = 0;
+		value.header.is_set_map_vector = 0;
+		return pointless_create_spill_value(c, &value, &c->string_unicode_count, unicode_buffer, buffer_len, 1);
+	}
+
 	// see if it already exists
-	prev_ref = (Pvoid_t)JudyHSGet(c->string_unicode_map_judy, unicode_buffer, buffer_len);
+	prev_ref = pointless_bytes_table_get(&c->string_unicode_map, unicode_buffer, buffer_len);
 
-	if (prev_ref) {
-		pointless_free(unicode_buffer);
-		return (uint32_t)(*((Word_t*)prev_ref));
+	if (prev_ref != POINTLESS_OPEN_TABLE_MISSING) {
+		pointless_arena_rollback(&c->arena, unicode_buffer);
+		return prev_ref;
 	}
 
 	// create an appropriate value
@@ -1569,7 +2652,7 @@ uint32_t pointless_create_unicode_ucs4(pointless_create_t* c, uint32_t* v)
 	value.header.is_outside_vector = 0;
 	value.header.is_compressed_vector = 0;
 	value.header.is_set_map_vector = 0;
-	value.data.data_u32 = c->string_unicode_map_judy_count;
+	value.data.data_u32 = c->string_unicode_count;
 
 	// add to value vector
 	if (!pointless_dynarray_push(&c->values, &value))
@@ -1583,23 +2666,19 @@ uint32_t pointless_create_unicode_ucs4(pointless_create_t* c, uint32_t* v)
 	pop_unicode = 1;
 
 	// add to mapping
-	PValue = (Pvoid_t)JudyHSIns(&c->string_unicode_map_judy, unicode_buffer, buffer_len, 0);
-
-	if (PValue == 0)
+	if (!pointless_bytes_table_set(&c->string_unicode_map, unicode_buffer, buffer_len, (uint32_t)(pointless_dynarray_n_items(&c->values) - 1)))
 		goto cleanup;
 
-	*((Word_t*)PValue) = (Word_t)(pointless_dynarray_n_items(&c->values) - 1);
-
-	c->string_unicode_map_judy_count += 1;
+	c->string_unicode_count += 1;
 
-	assert(c->string_unicode_map_judy_count == pointless_dynarray_n_items(&c->string_unicode_values));
+	assert(c->string_unicode_count == pointless_dynarray_n_items(&c->string_unicode_values));
 
 	// we're done
 	return (pointless_dynarray_n_items(&c->values) - 1);
 
 cleanup:
 
-	pointless_free(unicode_buffer);
+	pointless_arena_rollback(&c->arena, unicode_buffer);
 
 	if (pop_value)
 		pointless_dynarray_pop(&c->values);
@@ -1617,30 +2696,38 @@ uint32_t pointless_create_string_ascii(pointless_create_t* c, uint8_t* v)
 	int pop_value = 0;
 	int pop_string = 0;
 
-	Pvoid_t PValue = 0;
-	Pvoid_t prev_ref = 0;
+	uint32_t prev_ref;
 
 	uint8_t* vv;
 
 	// create buffer to hold [uint32 + v]
 	size_t string_len = pointless_ascii_len(v);
 	size_t buffer_len = sizeof(uint32_t) + sizeof(uint8_t) * (string_len + 1);
-	void* string_buffer = pointless_malloc(buffer_len);
+	void* string_buffer = pointless_arena_alloc(&c->arena, buffer_len);
 
 	if (string_buffer == 0)
-		goto cleanup;
+		return POINTLESS_CREATE_VALUE_FAIL;
 
 	// setup buffer data
 	*((uint32_t*)string_buffer) = (uint32_t)string_len;
 	vv = (uint8_t*)((uint32_t*)string_buffer + 1);
 	pointless_ascii_cpy(vv, v);
 
+	if (c->spill) {
+		pointless_create_value_t value;
+		value.header.type_29 = POINTLESS_STRING_;
+		value.header.is_outside_vector = 0;
+		value.header.is_compressed_vector = 0;
+		value.header.is_set_map_vector = 0;
+		return pointless_create_spill_value(c, &value, &c->string_unicode_count, string_buffer, buffer_len, 1);
+	}
+
 	// see if it already exists
-	prev_ref = JudyHSGet(c->string_unicode_map_judy, string_buffer, buffer_len);
+	prev_ref = pointless_bytes_table_get(&c->string_unicode_map, string_buffer, buffer_len);
 
-	if (prev_ref) {
-		pointless_free(string_buffer);
-		return (uint32_t)(*((Word_t*)prev_ref));
+	if (prev_ref != POINTLESS_OPEN_TABLE_MISSING) {
+		pointless_arena_rollback(&c->arena, string_buffer);
+		return prev_ref;
 	}
 
 	// create an appropriate value
@@ -1649,7 +2736,7 @@ uint32_t pointless_create_string_ascii(pointless_create_t* c, uint8_t* v)
 	value.header.is_outside_vector = 0;
 	value.header.is_compressed_vector = 0;
 	value.header.is_set_map_vector = 0;
-	value.data.data_u32 = c->string_unicode_map_judy_count;
+	value.data.data_u32 = c->string_unicode_count;
 
 	// add to value vector
 	if (!pointless_dynarray_push(&c->values, &value))
@@ -1663,22 +2750,18 @@ uint32_t pointless_create_string_ascii(pointless_create_t* c, uint8_t* v)
 	pop_string = 1;
 
 	// add to mapping
-	PValue = JudyHSIns(&c->string_unicode_map_judy, string_buffer, buffer_len, PJE0);
-
-	if (PValue == 0)
+	if (!pointless_bytes_table_set(&c->string_unicode_map, string_buffer, buffer_len, (uint32_t)(pointless_dynarray_n_items(&c->values) - 1)))
 		goto cleanup;
 
-	*((Word_t*)PValue) = (Word_t)(pointless_dynarray_n_items(&c->values) - 1);
+	c->string_unicode_count += 1;
 
-	c->string_unicode_map_judy_count += 1;
-
-	assert(c->string_unicode_map_judy_count == pointless_dynarray_n_items(&c->string_unicode_values));
+	assert(c->string_unicode_count == pointless_dynarray_n_items(&c->string_unicode_values));
 	// we're done
 	return (pointless_dynarray_n_items(&c->values) - 1);
 
 cleanup:
 
-	pointless_free(string_buffer);
+	pointless_arena_rollback(&c->arena, string_buffer);
 
 	if (pop_value)
 		pointless_dynarray_pop(&c->values);
@@ -1906,26 +2989,29 @@ static uint32_t pointless_create_bitvector_(pointless_create_t* c, void* v, uint
 
 	// create buffer to hold [uint32 + v]
 	size_t buffer_len = sizeof(uint32_t) + ICEIL(n_bits, 8);
-	buffer = pointless_malloc(buffer_len);
+	buffer = pointless_arena_alloc(&c->arena, buffer_len);
 
 	if (buffer == 0)
-		goto cleanup;
+		return POINTLESS_CREATE_VALUE_FAIL;
 
 	*((uint32_t*)buffer) = n_bits;
 	memcpy((uint32_t*)buffer + 1, v, ICEIL(n_bits, 8));
 
+	if (c->spill)
+		return pointless_create_spill_value(c, &value, &c->bitvector_count, buffer, buffer_len, normalize);
+
 	// try to find if we already have it
 	if (normalize) {
-		Pvoid_t prev_ref = (Pvoid_t)JudyHSGet(c->bitvector_map_judy, buffer, buffer_len);
+		uint32_t prev_ref = pointless_bytes_table_get(&c->bitvector_map, buffer, buffer_len);
 
-		if (prev_ref) {
-			pointless_free(buffer);
-			return (uint32_t)(*((Word_t*)prev_ref));
+		if (prev_ref != POINTLESS_OPEN_TABLE_MISSING) {
+			pointless_arena_rollback(&c->arena, buffer);
+			return prev_ref;
 		}
 	}
 
 	// it doesn't, create a new value
-	value.data.data_u32 = c->bitvector_map_judy_count;
+	value.data.data_u32 = c->bitvector_count;
 
 	// add to vector list
 	if (!pointless_dynarray_push(&c->values, &value))
@@ -1940,21 +3026,17 @@ static uint32_t pointless_create_bitvector_(pointless_create_t* c, void* v, uint
 
 	// add to mapping
 	if (normalize) {
-		Pvoid_t PValue = (Pvoid_t)JudyHSIns(&c->bitvector_map_judy, buffer, buffer_len, 0);
-
-		if (PValue == 0)
+		if (!pointless_bytes_table_set(&c->bitvector_map, buffer, buffer_len, (uint32_t)(pointless_dynarray_n_items(&c->values) - 1)))
 			goto cleanup;
-
-		*((Word_t*)PValue) = (Word_t)(pointless_dynarray_n_items(&c->values) - 1);
 	}
 
-	c->bitvector_map_judy_count += 1;
+	c->bitvector_count += 1;
 
 	// we're done
 	return (pointless_dynarray_n_items(&c->values) - 1);
 
 cleanup:
-	pointless_free(buffer);
+	pointless_arena_rollback(&c->arena, buffer);
 
 	if (pop_value)
 		pointless_dynarray_pop(&c->values);
@@ -1990,6 +3072,7 @@ static uint32_t pointless_create_vector_priv(pointless_create_t* c, uint32_t vec
 	pointless_create_vector_priv_t vector;
 
 	pointless_dynarray_init(&vector.vector, item_size);
+	pointless_dynarray_set_backing(&vector.vector, c->backing);
 
 	if (!pointless_dynarray_push(&c->values, &value))
 		goto cleanup;
@@ -2059,6 +3142,25 @@ uint32_t pointless_create_vector_float(pointless_create_t* c)
 	return pointless_create_vector_priv(c, POINTLESS_VECTOR_FLOAT, sizeof(float));
 }
 
+// a cycle needs an edge to a container which is not newer than its parent, children created after their parent can not close one
+static void pointless_create_track_child(pointless_create_t* c, uint32_t container, uint32_t child)
+{
+	if (child > container || c->may_have_cycles)
+		return;
+
+	switch (cv_value_type(child)) {
+		case POINTLESS_VECTOR_VALUE:
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+			if (!cv_is_outside_vector(child))
+				c->may_have_cycles = 1;
+			break;
+		case POINTLESS_SET_VALUE:
+		case POINTLESS_MAP_VALUE_VALUE:
+			c->may_have_cycles = 1;
+			break;
+	}
+}
+
 static uint32_t pointless_create_vector_append_priv(pointless_create_t* c, uint32_t vector, uint32_t vector_type, void* v)
 {
 	assert(vector < pointless_dynarray_n_items(&c->values));
@@ -2082,6 +3184,8 @@ uint32_t pointless_create_vector_value_append(pointless_create_t* c, uint32_t ve
 	if (v >= pointless_dynarray_n_items(&c->values))
 		return POINTLESS_CREATE_VALUE_FAIL;
 
+	pointless_create_track_child(c, vector, v);
+
 	return pointless_create_vector_append_priv(c, vector, POINTLESS_VECTOR_VALUE, &v);
 }
 
@@ -2134,6 +3238,8 @@ void pointless_create_vector_value_set(pointless_create_t* c, uint32_t vector, u
 {
 	pointless_create_vector_priv_t* vp = cv_priv_vector_at(vector);
 	pointless_dynarray_ITEM_AT(uint32_t, &vp->vector, i) = v;
+
+	pointless_create_track_child(c, vector, v);
 }
 
 static uint32_t pointless_create_vector_transfer_priv(pointless_create_t* c, uint32_t vector, void* value, uint32_t n_items)
@@ -2164,6 +3270,9 @@ uint32_t pointless_create_vector_value_transfer(pointless_create_t* c, uint32_t
 			return POINTLESS_CREATE_VALUE_FAIL;
 	}
 
+	for (i = 0; i < n; i++)
+		pointless_create_track_child(c, vector, v[i]);
+
 	return pointless_create_vector_transfer_priv(c, vector, v, n);
 }
 
@@ -2276,19 +3385,25 @@ uint32_t pointless_create_set(pointless_create_t* c)
 	// create the set value
 	pointless_create_set_t set;
 	pointless_dynarray_init(&set.keys, sizeof(uint32_t));
+	pointless_dynarray_set_backing(&set.keys, c->backing);
 	set.serialize_hash = pointless_create_vector_u32(c);
-	set.serialize_keys = pointless_create_vector_value(c);
+	set.serialize_keys = POINTLESS_CREATE_VALUE_FAIL;
 
 	// NOTE: possible array leak here on failure
 	if (set.serialize_hash == POINTLESS_CREATE_VALUE_FAIL)
 		goto cleanup;
 
-	if (set.serialize_keys == POINTLESS_CREATE_VALUE_FAIL)
-		goto cleanup;
-
-	// override the set/map vector flag
 	cv_value_at(set.serialize_hash)->header.is_set_map_vector = 1;
-	cv_value_at(set.serialize_keys)->header.is_set_map_vector = 1;
+
+	// interleaved and minimal perfect hash tables keep their keys in the hash vector
+	if (c_is_split()) {
+		set.serialize_keys = pointless_create_vector_value(c);
+
+		if (set.serialize_keys == POINTLESS_CREATE_VALUE_FAIL)
+			goto cleanup;
+
+		cv_value_at(set.serialize_keys)->header.is_set_map_vector = 1;
+	}
 
 	// add to value vector (note: we leak a single vector)
 	if (!pointless_dynarray_push(&c->values, &value))
@@ -2316,6 +3431,8 @@ uint32_t pointless_create_set_add(pointless_create_t* c, uint32_t s, uint32_t k)
 	if (!pointless_dynarray_push(&cv_set_at(s)->keys, &k))
 		return POINTLESS_CREATE_VALUE_FAIL;
 
+	pointless_create_track_child(c, s, k);
+
 	return s;
 }
 
@@ -2336,26 +3453,34 @@ uint32_t pointless_create_map(pointless_create_t* c)
 	pointless_create_map_t map;
 	pointless_dynarray_init(&map.keys, sizeof(uint32_t));
 	pointless_dynarray_init(&map.values, sizeof(uint32_t));
+	pointless_dynarray_set_backing(&map.keys, c->backing);
+	pointless_dynarray_set_backing(&map.values, c->backing);
 
 	// allocate the final hash/key/value vectors
 	map.serialize_hash = pointless_create_vector_u32(c);
-	map.serialize_keys = pointless_create_vector_value(c);
-	map.serialize_values = pointless_create_vector_value(c);
+	map.serialize_keys = POINTLESS_CREATE_VALUE_FAIL;
+	map.serialize_values = POINTLESS_CREATE_VALUE_FAIL;
 
 	// NOTE: possible array leak here on failure
 	if (map.serialize_hash == POINTLESS_CREATE_VALUE_FAIL)
 		goto cleanup;
 
-	if (map.serialize_keys == POINTLESS_CREATE_VALUE_FAIL)
-		goto cleanup;
+	cv_value_at(map.serialize_hash)->header.is_set_map_vector = 1;
 
-	if (map.serialize_values == POINTLESS_CREATE_VALUE_FAIL)
-		goto cleanup;
+	// interleaved and minimal perfect hash tables keep their keys and values in the hash vector
+	if (c_is_split()) {
+		map.serialize_keys = pointless_create_vector_value(c);
+		map.serialize_values = pointless_create_vector_value(c);
 
-	// override the set/map vector flag
-	cv_value_at(map.serialize_hash)->header.is_set_map_vector = 1;
-	cv_value_at(map.serialize_keys)->header.is_set_map_vector = 1;
-	cv_value_at(map.serialize_values)->header.is_set_map_vector = 1;
+		if (map.serialize_keys == POINTLESS_CREATE_VALUE_FAIL)
+			goto cleanup;
+
+		if (map.serialize_values == POINTLESS_CREATE_VALUE_FAIL)
+			goto cleanup;
+
+		cv_value_at(map.serialize_keys)->header.is_set_map_vector = 1;
+		cv_value_at(map.serialize_values)->header.is_set_map_vector = 1;
+	}
 
 	// add to value vector (note: we leak a single vector)
 	if (!pointless_dynarray_push(&c->values, &value))
@@ -2391,5 +3516,8 @@ uint32_t pointless_create_map_add(pointless_create_t* c, uint32_t m, uint32_t k,
 		return POINTLESS_CREATE_VALUE_FAIL;
 	}
 
+	pointless_create_track_child(c, m, k);
+	pointless_create_track_child(c, m, v);
+
 	return m;
 }
@@ -45,272 +45,181 @@ def strongly_connected_components_recursive(G):
 	return scc
 */
 
+/*
+The recursion above is unrolled onto an explicit stack of frames, so the depth of the graph is only bounded by memory.
+
+The state is reduced to what the algorithm actually reads:
+	count is the depth of v in the search tree, and visited[v] is only compared against root[v] while v is on the frame stack, so it lives in the frame
+	a node is in visited iff root[v] has been set, and root[w] is never read for a w in component, so component is a bitmap
+
+Nodes are marked as they are popped from the component stack. The node at the root of a component is not, which files written
+so far depend on through POINTLESS_VECTOR_VALUE_HASHABLE, so the marking must stay as it is.
+*/
+
+// root[v] for nodes not in visited
+#define POINTLESS_CYCLE_MARKER_NOT_VISITED UINT32_MAX
+
+typedef struct {
+	uint64_t v;
+	uint32_t v_id;
+	uint32_t count;
+	uint32_t i;
+	uint32_t n_children;
+} pointless_cycle_marker_frame_t;
+
 typedef struct {
 	cycle_marker_info_t* cb_info;
 	const char* error;
 	void* cycle_marker;
 
-	Pvoid_t visited_judy;
-	Pvoid_t component_judy;
-	Pvoid_t root_judy;
+	uint32_t n_nodes;
+	uint32_t* root;
+	void* component;
 
+	pointless_dynarray_t frames;
 	pointless_dynarray_t stack;
 } pointless_cycle_marker_state_t;
 
-static void pointless_cycle_marker_visit(pointless_cycle_marker_state_t* state, uint64_t v, Word_t count, uint32_t depth);
-
-//static void print_depth(uint32_t depth)
-//{
-//	uint32_t i;
-//	for (i = 0; i < depth; i++)
-//		printf("   ");
-//}
-
-static void process_child(pointless_cycle_marker_state_t* state, uint32_t v_id, uint64_t w, Word_t count, uint32_t depth)
-{
-	if (!(*state->cb_info->fn_is_container)(state->cb_info->user, w))
-		return;
-
-	// if w not in visited: visit(w, count)
-	uint32_t w_id = (*state->cb_info->fn_container_id)(state->cb_info->user, w);
-	//print_depth(depth); printf("process_child(w = %u, count = %llu)\n", (unsigned int)w_id, (unsigned long long)count);
-
-	Word_t* PValue = (Word_t*)(Pvoid_t)JudyLGet(state->visited_judy, (Word_t)w_id, 0);
-
-	if (PValue == 0) {
-		//print_depth(depth); printf(" w is not in visited, so visit(w = %u, count = %llu)\n", (unsigned int)w_id, (unsigned long long)count);
-
-		pointless_cycle_marker_visit(state, w, count, depth + 1);
-
-		if (state->error)
-			return;
-	} else {
-		//print_depth(depth); printf(" w is in visited\n");
-	}
-
-	// if w not in component:
-	PValue = (Word_t*)(Pvoid_t)JudyLGet(state->component_judy, (Word_t)w_id, 0);
-
-	if (PValue == 0) {
-		//print_depth(depth); printf(" w is not in component\n");
-
-		// root[v]
-		Word_t* root_v = (Word_t*)(Pvoid_t)JudyLGet(state->root_judy, (Word_t)v_id, 0);
-		// root[w]
-		Word_t* root_w = (Word_t*)(Pvoid_t)JudyLGet(state->root_judy, (Word_t)w_id, 0);
-
-		if (root_v == 0 || root_w == 0) {
-			state->error = "internal error, root[v]/root[w] missing";
-			return;
-		}
-
-		// root[v] = min(root[v], root[w])
-		if (*root_w < *root_v) {
-			//print_depth(depth); printf("root[v] = min(%u, %u)\n", *(unsigned int*)root_v, *(unsigned int*)root_w);
-			PValue = (Word_t*)(Pvoid_t)JudyLIns(&state->root_judy, (Word_t)v_id, 0);
-
-			if (PValue == 0) {
-				state->error = "out of memory";
-				return;
-			}
-
-			*PValue = *root_w;
-		}
-	} else {
-		//print_depth(depth); printf(" w is in component\n");
-	}
-}
-
-static void _unpack_map_and_vector(uint64_t v, uint32_t* owner, uint32_t* value)
-{
-	*owner = (uint32_t)(v >> 32);
-	*value = (uint32_t)(v & UINT32_MAX);
-}
-
-//static char buffer[1000];
-//static char* depth_buffer(uint32_t depth)
-//{
-//	uint32_t i;
-//	for (i = 0; i < depth * 3; i++)
-//		buffer[i] = ' ';
-//	buffer[i] = 0;
-//	return buffer;
-//}
-
-static void pointless_cycle_marker_visit(pointless_cycle_marker_state_t* state, uint64_t v, Word_t count, uint32_t depth)
+static void pointless_cycle_marker_visit(pointless_cycle_marker_state_t* state, uint64_t v, uint32_t count)
 {
 	assert((*state->cb_info->fn_is_container)(state->cb_info->user, v));
 
-	if (depth >= POINTLESS_MAX_DEPTH) {
-		state->error = "maximum recursion depth reached";
-		return;
-	}
-
-	if (count >= (Word_t)((*state->cb_info->fn_n_nodes)(state->cb_info->user))) {
-		//printf("B depth %u, count %u\n", depth, (unsigned int)count);
+	if (count >= state->n_nodes) {
 		state->error = "internal error: pre-order count exceeds number of containers";
 		return;
 	}
 
-	// if w not in visited: visit(w, count)
-	uint32_t v_id = (*state->cb_info->fn_container_id)(state->cb_info->user, v);
-	//print_depth(depth); printf("pointless_cycle_marker_visit(v = %u, count = %llu):\n", (unsigned int)v_id, (unsigned long long)count);
-
-	// root[v] = count
-	Word_t* PValue = (Word_t*)(Pvoid_t)JudyLIns(&state->root_judy, (Word_t)v_id, 0);
+	pointless_cycle_marker_frame_t frame;
+	frame.v = v;
+	frame.v_id = (*state->cb_info->fn_container_id)(state->cb_info->user, v);
+	frame.count = count;
+	frame.i = 0;
+	frame.n_children = (*state->cb_info->fn_n_children)(state->cb_info->user, v);
 
-	if (PValue == 0) {
-		state->error = "out of memory";
+	if (frame.v_id >= state->n_nodes) {
+		state->error = "internal error: container id exceeds number of containers";
 		return;
 	}
 
-	*PValue = count;
-	//print_depth(depth); printf(" root[%u] = %llu\n", v_id, (unsigned long long)count);
+	// root[v] = count, visited[v] = count, stack.append(v)
+	state->root[frame.v_id] = count;
 
-	// visited[v] = count
-	PValue = (Word_t*)(Pvoid_t)JudyLIns(&state->visited_judy, (Word_t)v_id, 0);
-
-	if (PValue == 0) {
+	if (!pointless_dynarray_push(&state->frames, &frame) || !pointless_dynarray_push(&state->stack, &frame.v_id))
 		state->error = "out of memory";
-		return;
-	}
-
-	*((Word_t*)PValue) = count;
-	//print_depth(depth); printf(" visited[%u] = %llu\n", v_id, (unsigned long long)count);
+}
 
-	//print_depth(depth); printf(" count = %llu + 1\n", (unsigned long long)count);
+// if w not in component: root[v] = min(root[v], root[w])
+static void pointless_cycle_marker_update_root(pointless_cycle_marker_state_t* state, uint32_t v_id, uint32_t w_id)
+{
+	if (!bm_is_set_(state->component, w_id) && state->root[w_id] < state->root[v_id])
+		state->root[v_id] = state->root[w_id];
+}
 
-	// stack.append(v)
-	//print_depth(depth); printf(" stack.append(v = %u)\n", (unsigned int)v_id);
-	if (!pointless_dynarray_push(&state->stack, &v_id)) {
-		state->error = "out of memory";
+static void pointless_cycle_marker_finish(pointless_cycle_marker_state_t* state, pointless_cycle_marker_frame_t* frame)
+{
+	// if root[v] == visited[v]
+	if (state->root[frame->v_id] != frame->count)
 		return;
-	}
 
-	uint32_t i, n_children = (*state->cb_info->fn_n_children)(state->cb_info->user, v);
-	uint32_t owner, value;
-	_unpack_map_and_vector(v, &owner, &value);
-	//printf("%s%u/%u n-children: %u\n", depth_buffer(depth), owner, value, n_children);
-
-	for (i = 0; i < n_children; i++) {
-		uint64_t child = (*state->cb_info->fn_child_at)(state->cb_info->user, v, i);
-		_unpack_map_and_vector(child, &owner, &value);
-		//printf(" %schild %u/%u\n", depth_buffer(depth), owner, value);
-
-		// this algorithm does not support single-node cycles, so check for them manuall
-		if ((*state->cb_info->fn_is_container)(state->cb_info->user, child)) {
-			uint32_t parent_container_id = (*state->cb_info->fn_container_id)(state->cb_info->user, v);
-			uint32_t child_container_id  =(*state->cb_info->fn_container_id)(state->cb_info->user, child);
-
-			//printf("%s  and it is a container\n", depth_buffer(depth));
-			//printf("%s  parent/child-ids: %i/%i\n", depth_buffer(depth), (int)parent_container_id, (int)child_container_id);
-
-			if (parent_container_id == child_container_id) {
-				//printf("zero cycle %u\n", (unsigned int)parent_container_id);
-				bm_set_(state->cycle_marker, parent_container_id);
-				continue;
-			}
-		}
+	// component[v] = root[v]
+	bm_set_(state->component, frame->v_id);
 
-		process_child(state, v_id, child, count + 1, depth + 1);
+	// while stack[-1] != v: w = stack.pop(), component[w] = root[v]
+	while (1) {
+		assert(pointless_dynarray_n_items(&state->stack) > 0);
+		uint32_t w_id = pointless_dynarray_ITEM_AT(uint32_t, &state->stack, pointless_dynarray_n_items(&state->stack) - 1);
 
-		if (state->error)
-			return;
-	}
+		if (w_id == frame->v_id)
+			break;
 
-	// if root[v] == visited[v]
-	Word_t* root_v = (Word_t*)(Pvoid_t)JudyLGet(state->root_judy, (Word_t)v_id, 0);
-	Word_t* visited_v = (Word_t*)(Pvoid_t)JudyLGet(state->visited_judy, (Word_t)v_id, 0);
+		pointless_dynarray_pop(&state->stack);
 
-	if (root_v == 0 || visited_v == 0) {
-		state->error = "internal error: root[v]/visited[v] missing";
-		return;
+		bm_set_(state->cycle_marker, w_id);
+		bm_set_(state->component, w_id);
 	}
 
-	//print_depth(depth); printf(" if root[%u] (%u) == visited[%u] (%u)\n", (unsigned int)v_id, (unsigned int)(*root_v), (unsigned int)v_id, (unsigned int)(*visited_v));
-
-	if (*root_v == *visited_v) {
-		// component[v] = root[v]
-		Word_t* PValue = (Word_t*)(Pvoid_t)JudyLIns(&state->component_judy, (Word_t)v_id, 0);
-
-		if (PValue == 0) {
-			state->error = "out of memory";
-			return;
-		}
+	// stack.remove(v) <=> stack.pop()
+	pointless_dynarray_pop(&state->stack);
+}
 
-		*PValue = *root_v;
+static void pointless_cycle_marker_search(pointless_cycle_marker_state_t* state, uint64_t source)
+{
+	pointless_cycle_marker_visit(state, source, 0);
 
-		//print_depth(depth); printf("  component[%u] = root[%u] (%u)\n", (unsigned int)v_id, (unsigned int)v_id, (unsigned int)(*root_v));
-		//print_depth(depth); printf("  while stack[-1] != %u\n", (unsigned int)v_id);
+	while (state->error == 0 && pointless_dynarray_n_items(&state->frames) > 0) {
+		// the frame pointer is only valid until the next push
+		size_t n_frames = pointless_dynarray_n_items(&state->frames);
+		pointless_cycle_marker_frame_t* frame = &pointless_dynarray_ITEM_AT(pointless_cycle_marker_frame_t, &state->frames, n_frames - 1);
 
-		// while stack[-1] != v:
-		while (1) {
-			assert(pointless_dynarray_n_items(&state->stack) > 0);
-			uint32_t last = pointless_dynarray_ITEM_AT(uint32_t, &state->stack, pointless_dynarray_n_items(&state->stack) - 1);
+		// all children visited, return to the parent
+		if (frame->i == frame->n_children) {
+			uint32_t w_id = frame->v_id;
 
-			if (last == v_id)
-				break;
+			pointless_cycle_marker_finish(state, frame);
+			pointless_dynarray_pop(&state->frames);
 
-			// w = stack.pop()
-			uint32_t w_id = last;
-			pointless_dynarray_pop(&state->stack);
-			//print_depth(depth); printf("   w = stack.pop() (%u)\n", (unsigned int)w_id);
+			if (n_frames > 1)
+				pointless_cycle_marker_update_root(state, pointless_dynarray_ITEM_AT(pointless_cycle_marker_frame_t, &state->frames, n_frames - 2).v_id, w_id);
 
-			//printf("B marking %u\n", w_id);
-			bm_set_(state->cycle_marker, w_id);
+			continue;
+		}
 
-			// component[w] = root[v]
-			Word_t* PValue = (Word_t*)(Pvoid_t)JudyLIns(&state->component_judy, (Word_t)w_id, 0);
+		uint64_t child = (*state->cb_info->fn_child_at)(state->cb_info->user, frame->v, frame->i);
+		frame->i += 1;
 
-			if (PValue == 0) {
-				state->error = "out of memory";
-				return;
-			}
+		if (!(*state->cb_info->fn_is_container)(state->cb_info->user, child))
+			continue;
 
-			*PValue = *root_v;
+		uint32_t w_id = (*state->cb_info->fn_container_id)(state->cb_info->user, child);
 
-			//print_depth(depth); printf("   component[%u] = root[%u] (%u)\n", (unsigned int)w_id, (unsigned int)v_id, *(unsigned int*)root_v);
+		// this algorithm does not support single-node cycles, so check for them manually
+		if (w_id == frame->v_id) {
+			bm_set_(state->cycle_marker, w_id);
+			continue;
 		}
 
-		//print_depth(depth); printf("  len(stack) == %u\n", (unsigned int)pointless_dynarray_n_items(&state->stack));
-		//print_depth(depth); printf("  stack.pop()\n");
+		if (w_id >= state->n_nodes) {
+			state->error = "internal error: container id exceeds number of containers";
+			return;
+		}
 
-		// stack.remove(v) <=> stack.pop()
-		pointless_dynarray_pop(&state->stack);
+		// if w not in visited: visit(w, count), the root update happens when w returns
+		if (state->root[w_id] == POINTLESS_CYCLE_MARKER_NOT_VISITED)
+			pointless_cycle_marker_visit(state, child, frame->count + 1);
+		else
+			pointless_cycle_marker_update_root(state, frame->v_id, w_id);
 	}
 }
 
 void* pointless_cycle_marker(cycle_marker_info_t* info, const char** error)
 {
-	uint32_t n_nodes = (*info->fn_n_nodes)(info->user);
 	uint64_t root;
 
 	pointless_cycle_marker_state_t state;
 	state.cb_info = info;
 	state.error = 0;
-	state.cycle_marker = pointless_calloc(ICEIL(n_nodes, 8), 1);
-	state.visited_judy = 0;
-	state.component_judy = 0;
-	state.root_judy = 0;
+	state.n_nodes = (*info->fn_n_nodes)(info->user);
+	state.cycle_marker = pointless_calloc(ICEIL(state.n_nodes, 8), 1);
+	state.root = (uint32_t*)pointless_malloc(sizeof(uint32_t) * ((size_t)state.n_nodes + 1));
+	state.component = pointless_calloc(ICEIL(state.n_nodes, 8), 1);
+	pointless_dynarray_init(&state.frames, sizeof(pointless_cycle_marker_frame_t));
 	pointless_dynarray_init(&state.stack, sizeof(uint32_t));
 
-	if (state.cycle_marker == 0) {
+	if (state.cycle_marker == 0 || state.root == 0 || state.component == 0) {
 		state.error = "out of memory";
 		goto error_cleanup;
 	}
 
+	memset(state.root, 0xFF, sizeof(uint32_t) * state.n_nodes);
+
 	root = (*info->fn_get_root)(state.cb_info->user);
 
 	if ((*info->fn_is_container)(state.cb_info->user, root))
-		pointless_cycle_marker_visit(&state, root, 0, 0);
+		pointless_cycle_marker_search(&state, root);
 
 	if (state.error)
 		goto error_cleanup;
 
-	for (uint32_t i = 0; i < n_nodes; i++) {
-		//printf("cycle %i: %i\n", (int)i, bm_is_set_(state.cycle_marker, i) ? 1 : 0);
-	}
-
 	goto cleanup;
 
 error_cleanup:
@@ -324,15 +233,10 @@ error_cleanup:
 
 cleanup:
 
-	JudyLFreeArray(&state.visited_judy, 0);
-	state.visited_judy = 0;
-
-	JudyLFreeArray(&state.component_judy, 0);
-	state.component_judy = 0;
-
-	JudyLFreeArray(&state.root_judy, 0);
-	state.root_judy = 0;
+	pointless_free(state.root);
+	pointless_free(state.component);
 
+	pointless_dynarray_destroy(&state.frames);
 	pointless_dynarray_destroy(&state.stack);
 
 	return state.cycle_marker;
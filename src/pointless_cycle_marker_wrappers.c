@@ -52,9 +52,9 @@ static uint32_t _reader_pointless_n_children(void* user_, uint64_t v_)
 		case POINTLESS_VECTOR_VALUE_HASHABLE:
 			return pointless_reader_vector_n_items(user->p, v);
 		case POINTLESS_SET_VALUE:
-			return 2;
+			return pointless_set_n_children(user->p, v);
 		case POINTLESS_MAP_VALUE_VALUE:
-			return 3;
+			return pointless_map_n_children(user->p, v);
 	}
 
 	//printf("wat! %i\n", __LINE__);
@@ -74,25 +74,9 @@ static uint64_t _reader_pointless_child_at(void* user_, uint64_t v_, uint32_t i)
 			children = pointless_reader_vector_value(user->p, v);
 			return (uint64_t)(children + i);
 		case POINTLESS_SET_VALUE:
-			assert(0 <= i && i <= 1);
-
-			if (i == 0)
-				return (uint64_t)pointless_set_hash_vector(user->p, v);
-			else
-				return (uint64_t)pointless_set_key_vector(user->p, v);
-
-			break;
+			return (uint64_t)pointless_set_child_at(user->p, v, i);
 		case POINTLESS_MAP_VALUE_VALUE:
-			assert(0 <= i && i <= 2);
-
-			if (i == 0)
-				return (uint64_t)pointless_map_hash_vector(user->p, v);
-			else if (i == 1)
-				return (uint64_t)pointless_map_key_vector(user->p, v);
-			else
-				return (uint64_t)pointless_map_value_vector(user->p, v);
-
-			break;
+			return (uint64_t)pointless_map_child_at(user->p, v, i);
 	}
 
 	//printf("wat! %i\n", __LINE__);
@@ -175,12 +159,17 @@ static uint32_t _create_pointless_n_children(void* user_, uint64_t v_)
 	uint32_t owner, value;
 	_unpack_map_and_vector(v_, &owner, &value);
 
+	// interleaved and minimal perfect hash tables have the hash vector, and then their keys and values as direct children
 	switch (cv_value_type(value)) {
 		case POINTLESS_SET_VALUE:
 			//printf("A n-children(%i): 2\n", (int)value);
+			if (!c_is_split())
+				return 1 + pointless_dynarray_n_items(&cv_set_at(value)->keys);
 			return 2;
 		case POINTLESS_MAP_VALUE_VALUE:
 			//printf("B n-children(%i): 3\n", (int)value);
+			if (!c_is_split())
+				return 1 + 2 * pointless_dynarray_n_items(&cv_map_at(value)->keys);
 			return 3;
 	}
 
@@ -215,12 +204,20 @@ static uint64_t _create_pointless_child_at(void* user_, uint64_t v_, uint32_t i)
 	switch (cv_value_type(value)) {
 		case POINTLESS_SET_VALUE:
 			assert(owner == UINT32_MAX);
-			assert(i == 0 || i == 1);
 			if (i == 0)
 				return _pack_owner_and_value(value, cv_set_at(value)->serialize_hash);
+			else if (!c_is_split())
+				return _pack_owner_and_value(UINT32_MAX, pointless_dynarray_ITEM_AT(uint32_t, &cv_set_at(value)->keys, i - 1));
 			else
 				return _pack_owner_and_value(value, cv_set_at(value)->serialize_keys);
 		case POINTLESS_MAP_VALUE_VALUE:
+			if (i > 0 && !c_is_split()) {
+				if ((i - 1) % 2 == 0)
+					return _pack_owner_and_value(UINT32_MAX, pointless_dynarray_ITEM_AT(uint32_t, &cv_map_at(value)->keys, (i - 1) / 2));
+				else
+					return _pack_owner_and_value(UINT32_MAX, pointless_dynarray_ITEM_AT(uint32_t, &cv_map_at(value)->values, (i - 1) / 2));
+			}
+
 			assert(i == 0 || i == 1 || i == 2);
 			if (i == 0)
 				return _pack_owner_and_value(value, cv_map_at(value)->serialize_hash);
@@ -170,6 +170,24 @@ static void pointless_print_unicode(pointless_debug_state_t* state, pointless_va
 	fprintf(state->out, "\"");
 }
 
+static void pointless_print_unicode_utf8(pointless_debug_state_t* state, pointless_value_t* v)
+{
+	assert(v->type == POINTLESS_UNICODE_UTF8);
+	uint8_t* s = pointless_reader_unicode_value_utf8(state->p, v);
+	uint32_t c;
+
+	fprintf(state->out, "\"");
+
+	while ((c = pointless_utf8_next(&s)) != 0) {
+		if (c < 128)
+			fprintf(state->out, "%c", (char)c);
+		else
+			fprintf(state->out, "?");
+	}
+
+	fprintf(state->out, "\"");
+}
+
 static void pointless_print_string(pointless_debug_state_t* state, pointless_value_t* v)
 {
 	assert(v->type == POINTLESS_STRING_);
@@ -423,6 +441,9 @@ static void pointless_print_value(pointless_debug_state_t* state, pointless_valu
 		case POINTLESS_STRING_:
 			pointless_print_string(state, v);
 			break;
+		case POINTLESS_UNICODE_UTF8:
+			pointless_print_unicode_utf8(state, v);
+			break;
 		case POINTLESS_VECTOR_VALUE:
 		case POINTLESS_VECTOR_VALUE_HASHABLE:
 			assert(v->data.data_u32 < state->p->header->n_vector);
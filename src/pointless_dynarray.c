@@ -1,11 +1,19 @@
 #include <pointless/pointless_dynarray.h>
 
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
 void pointless_dynarray_init(pointless_dynarray_t* a, size_t item_size)
 {
 	a->_data = 0;
 	a->n_items = 0;
 	a->n_alloc = 0;
 	a->item_size = item_size;
+	a->backing = 0;
+	a->is_mapped = 0;
+	a->fd = -1;
 }
 
 size_t pointless_dynarray_n_items(pointless_dynarray_t* a)
@@ -35,27 +43,117 @@ static intop_sizet_t next_size(size_t n_alloc)
 	return intop_sizet_add(intop_sizet_add(intop_sizet_init(a), intop_sizet_init(b)), intop_sizet_init(c));
 }
 
-static int pointless_dynarray_grow(pointless_dynarray_t* a)
+int pointless_dynarray_temp_file(const char* dir)
+{
+	if (dir == 0)
+		dir = getenv("TMPDIR");
+
+	if (dir == 0 || *dir == 0)
+		dir = "/tmp";
+
+	char* fname = (char*)pointless_malloc(strlen(dir) + 32);
+
+	if (fname == 0)
+		return -1;
+
+	sprintf(fname, "%s/pointless-XXXXXX", dir);
+
+	int fd = mkstemp(fname);
+
+	// nobody else needs the name, the file goes away with the descriptor
+	if (fd != -1)
+		unlink(fname);
+
+	pointless_free(fname);
+
+	return fd;
+}
+
+// maps the file at its new size before the old mapping or heap buffer is let go, so a failure leaves the array as it was
+static int pointless_dynarray_remap(pointless_dynarray_t* a, size_t n_bytes)
+{
+	int fd = a->fd;
+	void* data = MAP_FAILED;
+
+	if (!a->is_mapped && (fd = pointless_dynarray_temp_file(a->backing->dir)) == -1)
+		return 0;
+
+	if (ftruncate(fd, (off_t)n_bytes) == 0)
+		data = mmap(0, n_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	if (data == MAP_FAILED) {
+		if (!a->is_mapped)
+			close(fd);
+
+		return 0;
+	}
+
+	if (!a->is_mapped) {
+		memcpy(data, a->_data, a->n_items * a->item_size);
+		pointless_free(a->_data);
+	} else {
+		munmap(a->_data, a->n_alloc * a->item_size);
+	}
+
+	a->_data = data;
+	a->is_mapped = 1;
+	a->fd = fd;
+
+	return 1;
+}
+
+static int pointless_dynarray_realloc(pointless_dynarray_t* a, intop_sizet_t next_n_alloc)
 {
-	// get next allocation size, in terms of items and bytes, with overflow check
-	intop_sizet_t next_n_alloc = next_size(a->n_alloc);
 	intop_sizet_t next_n_bytes = intop_sizet_mult(next_n_alloc, intop_sizet_init(a->item_size));
 
 	if (next_n_bytes.is_overflow)
 		return 0;
 
-	// we're good
-	void* next_data = pointless_realloc(a->_data, next_n_bytes.value);
+	if (a->is_mapped || (a->backing && next_n_bytes.value > a->backing->threshold)) {
+		if (!pointless_dynarray_remap(a, next_n_bytes.value))
+			return 0;
+	} else {
+		void* next_data = pointless_realloc(a->_data, next_n_bytes.value);
 
-	if (next_data == 0)
-		return 0;
+		if (next_data == 0)
+			return 0;
+
+		a->_data = next_data;
+	}
 
-	a->_data = next_data;
 	a->n_alloc = next_n_alloc.value;
 
 	return 1;
 }
 
+static int pointless_dynarray_grow(pointless_dynarray_t* a)
+{
+	// get next allocation size, in terms of items, with overflow check, mapped arrays double since remapping costs more
+	intop_sizet_t next_n_alloc = next_size(a->n_alloc);
+
+	if (a->is_mapped)
+		next_n_alloc = intop_sizet_mult(intop_sizet_init(a->n_alloc), intop_sizet_init(2));
+
+	return pointless_dynarray_realloc(a, next_n_alloc);
+}
+
+int pointless_dynarray_resize(pointless_dynarray_t* a, size_t n_items)
+{
+	if (n_items > a->n_alloc && !pointless_dynarray_realloc(a, intop_sizet_init(n_items)))
+		return 0;
+
+	if (n_items > a->n_items)
+		memset((char*)a->_data + a->item_size * a->n_items, 0, a->item_size * (n_items - a->n_items));
+
+	a->n_items = n_items;
+	return 1;
+}
+
+void pointless_dynarray_set_backing(pointless_dynarray_t* a, const pointless_dynarray_backing_t* backing)
+{
+	a->backing = backing;
+}
+
 int pointless_dynarray_push(pointless_dynarray_t* a, void* i)
 {
 	return pointless_dynarray_push_bulk(a, i, 1);
@@ -76,15 +174,22 @@ int pointless_dynarray_push_bulk(pointless_dynarray_t* a, void* i, size_t n_item
 void pointless_dynarray_clear(pointless_dynarray_t* a)
 {
 	pointless_dynarray_destroy(a);
-	pointless_dynarray_init(a, a->item_size);
 }
 
 void pointless_dynarray_destroy(pointless_dynarray_t* a)
 {
-	pointless_free(a->_data);
+	if (a->is_mapped) {
+		munmap(a->_data, a->n_alloc * a->item_size);
+		close(a->fd);
+	} else {
+		pointless_free(a->_data);
+	}
+
 	a->_data = 0;
 	a->n_items = 0;
 	a->n_alloc = 0;
+	a->is_mapped = 0;
+	a->fd = -1;
 }
 
 void* pointless_dynarray_item_at(pointless_dynarray_t* a, size_t i)
@@ -138,7 +243,7 @@ void pointless_dynarray_give_data(pointless_dynarray_t* a, void* data, size_t n_
 {
 	assert(a->n_items == 0);
 
-	pointless_free(a->_data);
+	pointless_dynarray_destroy(a);
 
 	a->_data = data;
 	a->n_items = n_items;
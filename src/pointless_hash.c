@@ -1,4 +1,5 @@
 #include <math.h>
+#include <string.h>
 
 #include <pointless/pointless_defs.h>
 #include <pointless/pointless_value.h>
@@ -28,34 +29,279 @@ uint32_t pointless_hash_unicode_ucs4_v1_32(uint32_t* s)
 	PYTHON_STRING_HASH_32(s, uint32_t)
 }
 
+// the same hash over the first n code points, for the string hash dispatch below
+static uint32_t pointless_hash_unicode_ucs2_v1_32_(uint16_t* s, size_t n)
+{
+	PYTHON_STRING_HASH_32_(s, n, uint16_t)
+}
+
+static uint32_t pointless_hash_unicode_ucs4_v1_32_(uint32_t* s, size_t n)
+{
+	PYTHON_STRING_HASH_32_(s, n, uint32_t)
+}
+
+// the same hash over the code points of the utf-8 sequence s[0:n_bytes]
+static uint32_t pointless_hash_unicode_utf8_v1_32(uint8_t* s, size_t n_bytes)
+{
+	uint8_t* p = s;
+	uint8_t* p_end = s + n_bytes;
+	uint32_t x = 0;
+	size_t len = 0;
+
+	// seeded with the first code point, decoded from a copy of s
+	if (p < p_end)
+		x = pointless_utf8_next(&s) << 7;
+
+	while (p < p_end) {
+		x = (1000003 * x) ^ pointless_utf8_next(&p);
+		len++;
+	}
+
+	return x ^ len;
+}
+
+// v2 string hash, in the style of wyhash: 16 bytes per round, folded with a 64x64->128 bit multiply
+#define POINTLESS_HASH_V2_SEED 0xa0761d6478bd642fULL
+#define POINTLESS_HASH_V2_P1   0xe7037ed1a0b428dbULL
+#define POINTLESS_HASH_V2_P2   0x8ebc6af09c88c6e3ULL
+
+// bytes of converted code points per round trip through the stack buffer, a multiple of 16
+#define POINTLESS_HASH_V2_CHUNK 64
+
+static uint64_t pointless_hash_v2_mum(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+	__uint128_t r = (__uint128_t)a * b;
+	return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+	uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+	uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+	uint64_t lo = t + (rm1 << 32);
+	uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+	return lo ^ hi;
+#endif
+}
+
+static uint64_t pointless_hash_v2_read(const uint8_t* s)
+{
+	uint64_t v;
+	memcpy(&v, s, sizeof(v));
+	return v;
+}
+
+static uint64_t pointless_hash_v2_blocks(uint64_t seed, const uint8_t* s, size_t n_blocks)
+{
+	size_t i;
+
+	for (i = 0; i < n_blocks; i++, s += 16)
+		seed = pointless_hash_v2_mum(pointless_hash_v2_read(s) ^ POINTLESS_HASH_V2_P1, pointless_hash_v2_read(s + 8) ^ seed);
+
+	return seed;
+}
+
+// mixes in the last n_tail < 16 bytes, and the total length
+static uint32_t pointless_hash_v2_end(uint64_t seed, const uint8_t* s, size_t n_tail, size_t n_bytes)
+{
+	uint8_t tail[16] = {0};
+	memcpy(tail, s, n_tail);
+
+	uint64_t h = pointless_hash_v2_mum(pointless_hash_v2_read(tail) ^ POINTLESS_HASH_V2_P1, pointless_hash_v2_read(tail + 8) ^ seed);
+	h = pointless_hash_v2_mum(h ^ POINTLESS_HASH_V2_P2, (uint64_t)n_bytes ^ POINTLESS_HASH_V2_P1);
+
+	return (uint32_t)(h ^ (h >> 32));
+}
+
+static uint32_t pointless_hash_v2_bytes(const uint8_t* s, size_t n_bytes)
+{
+	uint64_t seed = pointless_hash_v2_blocks(POINTLESS_HASH_V2_SEED, s, n_bytes / 16);
+	return pointless_hash_v2_end(seed, s + (n_bytes & ~(size_t)15), n_bytes % 16, n_bytes);
+}
+
+// hashes the code points s[0:n] as a T_OUT array, converted through a stack buffer
+#define POINTLESS_HASH_V2_CONVERTED(s, n, T_IN, T_OUT) { \
+	T_OUT buffer[POINTLESS_HASH_V2_CHUNK / sizeof(T_OUT)]; \
+	T_IN* p = (s); \
+	size_t i, m, n_left = (n); \
+	uint64_t seed = POINTLESS_HASH_V2_SEED; \
+	while (n_left > POINTLESS_HASH_V2_CHUNK / sizeof(T_OUT)) { \
+		for (i = 0; i < POINTLESS_HASH_V2_CHUNK / sizeof(T_OUT); i++) \
+			buffer[i] = (T_OUT)p[i]; \
+		seed = pointless_hash_v2_blocks(seed, (uint8_t*)buffer, POINTLESS_HASH_V2_CHUNK / 16); \
+		p += POINTLESS_HASH_V2_CHUNK / sizeof(T_OUT); \
+		n_left -= POINTLESS_HASH_V2_CHUNK / sizeof(T_OUT); \
+	} \
+	for (i = 0; i < n_left; i++) \
+		buffer[i] = (T_OUT)p[i]; \
+	m = n_left * sizeof(T_OUT); \
+	seed = pointless_hash_v2_blocks(seed, (uint8_t*)buffer, m / 16); \
+	return pointless_hash_v2_end(seed, (uint8_t*)buffer + (m & ~(size_t)15), m % 16, (n) * sizeof(T_OUT)); \
+}
+
+// the same code points must hash the same in any width: sequences where all of them fit in 8 bits
+// are hashed as bytes, all others as native 32-bit words
+#define POINTLESS_HASH_V2_FITS_8(s, n, T) { T* p = (s); T m = 0; size_t i; for (i = 0; i < (n); i++) m |= p[i]; return (m < 256); }
+
+static int pointless_hash_v2_ucs2_fits_8(uint16_t* s, size_t n)
+	POINTLESS_HASH_V2_FITS_8(s, n, uint16_t)
+static int pointless_hash_v2_ucs4_fits_8(uint32_t* s, size_t n)
+	POINTLESS_HASH_V2_FITS_8(s, n, uint32_t)
+static uint32_t pointless_hash_v2_ucs2_as_8(uint16_t* s, size_t n)
+	POINTLESS_HASH_V2_CONVERTED(s, n, uint16_t, uint8_t)
+static uint32_t pointless_hash_v2_ucs4_as_8(uint32_t* s, size_t n)
+	POINTLESS_HASH_V2_CONVERTED(s, n, uint32_t, uint8_t)
+static uint32_t pointless_hash_v2_ucs2_as_32(uint16_t* s, size_t n)
+	POINTLESS_HASH_V2_CONVERTED(s, n, uint16_t, uint32_t)
+
+uint32_t pointless_hash_string_v2_32(uint8_t* s, size_t n)
+{
+	return pointless_hash_v2_bytes(s, n);
+}
+
+uint32_t pointless_hash_unicode_ucs2_v2_32(uint16_t* s, size_t n)
+{
+	if (pointless_hash_v2_ucs2_fits_8(s, n))
+		return pointless_hash_v2_ucs2_as_8(s, n);
+
+	return pointless_hash_v2_ucs2_as_32(s, n);
+}
+
+uint32_t pointless_hash_unicode_ucs4_v2_32(uint32_t* s, size_t n)
+{
+	if (pointless_hash_v2_ucs4_fits_8(s, n))
+		return pointless_hash_v2_ucs4_as_8(s, n);
+
+	return pointless_hash_v2_bytes((uint8_t*)s, n * sizeof(uint32_t));
+}
+
+// decodes the code points of s[0:n_bytes] into a T_OUT array, hashed through a stack buffer as above
+#define POINTLESS_HASH_V2_UTF8(s, n_bytes, T_OUT) { \
+	T_OUT buffer[POINTLESS_HASH_V2_CHUNK / sizeof(T_OUT)]; \
+	uint8_t* p = (s); \
+	uint8_t* p_end = p + (n_bytes); \
+	size_t m = 0, n = 0; \
+	uint64_t seed = POINTLESS_HASH_V2_SEED; \
+	while (p < p_end) { \
+		if (m == POINTLESS_HASH_V2_CHUNK / sizeof(T_OUT)) { \
+			seed = pointless_hash_v2_blocks(seed, (uint8_t*)buffer, POINTLESS_HASH_V2_CHUNK / 16); \
+			m = 0; \
+		} \
+		buffer[m++] = (T_OUT)pointless_utf8_next(&p); \
+		n += 1; \
+	} \
+	m *= sizeof(T_OUT); \
+	seed = pointless_hash_v2_blocks(seed, (uint8_t*)buffer, m / 16); \
+	return pointless_hash_v2_end(seed, (uint8_t*)buffer + (m & ~(size_t)15), m % 16, n * sizeof(T_OUT)); \
+}
+
+static uint32_t pointless_hash_v2_utf8_as_8(uint8_t* s, size_t n_bytes)
+	POINTLESS_HASH_V2_UTF8(s, n_bytes, uint8_t)
+static uint32_t pointless_hash_v2_utf8_as_32(uint8_t* s, size_t n_bytes)
+	POINTLESS_HASH_V2_UTF8(s, n_bytes, uint32_t)
+
+uint32_t pointless_hash_unicode_utf8_v2_32(uint8_t* s, size_t n_bytes)
+{
+	// code points which all fit in 8 bits are hashed as bytes, as in the other widths
+	if (pointless_is_utf8_ucs1(s, n_bytes))
+		return pointless_hash_v2_utf8_as_8(s, n_bytes);
+
+	return pointless_hash_v2_utf8_as_32(s, n_bytes);
+}
+
+uint32_t pointless_hash_unicode_utf8_32(uint32_t features, uint8_t* s, size_t n_bytes)
+{
+	if (features & POINTLESS_FF_FEATURE_FASTHASH)
+		return pointless_hash_unicode_utf8_v2_32(s, n_bytes);
+
+	return pointless_hash_unicode_utf8_v1_32(s, n_bytes);
+}
+
+uint32_t pointless_ff_version_features(uint32_t version)
+{
+	if (POINTLESS_FF_VERSION_NUMBER(version) == POINTLESS_FF_VERSION_OFFSET_64_FEATURES)
+		return POINTLESS_FF_VERSION_FEATURES(version);
+
+	return 0;
+}
+
+uint32_t pointless_hash_string_32(uint32_t features, uint8_t* s, size_t n)
+{
+	if (features & POINTLESS_FF_FEATURE_FASTHASH)
+		return pointless_hash_string_v2_32(s, n);
+
+	return pointless_hash_string_v1_32_(s, n);
+}
+
+uint32_t pointless_hash_unicode_ucs2_32(uint32_t features, uint16_t* s, size_t n)
+{
+	if (features & POINTLESS_FF_FEATURE_FASTHASH)
+		return pointless_hash_unicode_ucs2_v2_32(s, n);
+
+	return pointless_hash_unicode_ucs2_v1_32_(s, n);
+}
+
+uint32_t pointless_hash_unicode_ucs4_32(uint32_t features, uint32_t* s, size_t n)
+{
+	if (features & POINTLESS_FF_FEATURE_FASTHASH)
+		return pointless_hash_unicode_ucs4_v2_32(s, n);
+
+	return pointless_hash_unicode_ucs4_v1_32_(s, n);
+}
+
 #define HASH_UNICODE_SEED 1000000001L
 
 typedef uint32_t (*pointless_hash_reader_32_cb)(pointless_t* p, pointless_value_t* v);
 typedef uint32_t (*pointless_hash_create_32_cb)(pointless_create_t* c, pointless_create_value_t* v);
 
-// unicode is easy
+// unicode is easy, strings and unicodes are stored after their length
 static uint32_t pointless_hash_reader_unicode_32(pointless_t* p, pointless_value_t* v)
 {
 	uint32_t* s = pointless_reader_unicode_value_ucs4(p, v);
-	return pointless_hash_unicode_ucs4_v1_32(s);
+	return pointless_hash_unicode_ucs4_32(p->features, s, pointless_reader_unicode_len(p, v));
 }
 
 static uint32_t pointless_hash_create_unicode_32(pointless_create_t* c, pointless_create_value_t* v)
 {
-	uint32_t* s = ((uint32_t*)cv_get_unicode(v) + 1);
-	return pointless_hash_unicode_ucs4_v1_32(s);
+	if (c->spill)
+		return pointless_spill_entry_at(c->spill, POINTLESS_SPILL_STRING_UNICODE, v->data.data_u32)->hash;
+
+	return pointless_hash_create_buffer_32(c, v, cv_get_unicode(v));
+}
+
+// utf-8 unicodes hash as their code points, the same as the ucs-4 unicode they were created from
+static uint32_t pointless_hash_reader_unicode_utf8_32(pointless_t* p, pointless_value_t* v)
+{
+	uint8_t* s = pointless_reader_unicode_value_utf8(p, v);
+	return pointless_hash_unicode_utf8_32(p->features, s, pointless_reader_unicode_utf8_len(p, v));
 }
 
 static uint32_t pointless_hash_reader_string_32(pointless_t* p, pointless_value_t* v)
 {
 	uint8_t* s = pointless_reader_string_value_ascii(p, v);
-	return pointless_hash_string_v1_32(s);
+	return pointless_hash_string_32(p->features, s, pointless_reader_string_len(p, v));
 }
 
 static uint32_t pointless_hash_create_string_32(pointless_create_t* c, pointless_create_value_t* v)
 {
-	uint8_t* s = (uint8_t*)((uint32_t*)cv_get_string(v) + 1);
-	return pointless_hash_string_v1_32(s);
+	if (c->spill)
+		return pointless_spill_entry_at(c->spill, POINTLESS_SPILL_STRING_UNICODE, v->data.data_u32)->hash;
+
+	return pointless_hash_create_buffer_32(c, v, cv_get_string(v));
+}
+
+// spilled values are hashed once, from the buffer they are created from
+uint32_t pointless_hash_create_buffer_32(pointless_create_t* c, pointless_create_value_t* v, void* buffer)
+{
+	uint32_t* s = (uint32_t*)buffer;
+
+	switch (v->header.type_29) {
+		case POINTLESS_UNICODE_:
+			return pointless_hash_unicode_ucs4_32(c->features, s + 1, s[0]);
+		case POINTLESS_STRING_:
+			return pointless_hash_string_32(c->features, (uint8_t*)(s + 1), s[0]);
+	}
+
+	assert(v->header.type_29 == POINTLESS_BITVECTOR);
+	return pointless_bitvector_hash_32(POINTLESS_BITVECTOR, &v->data, buffer);
 }
 
 
@@ -184,8 +430,12 @@ static uint32_t pointless_hash_create_bitvector_32(pointless_create_t* c, pointl
 {
 	void* buffer = 0;
 
-	if (v->header.type_29 == POINTLESS_BITVECTOR)
+	if (v->header.type_29 == POINTLESS_BITVECTOR) {
+		if (c->spill)
+			return pointless_spill_entry_at(c->spill, POINTLESS_SPILL_BITVECTOR, v->data.data_u32)->hash;
+
 		buffer = cv_get_bitvector(v);
+	}
 
 	return pointless_bitvector_hash_32(v->header.type_29, &v->data, buffer);
 }
@@ -282,7 +532,11 @@ static uint32_t pointless_hash_create_vector_32(pointless_create_t* c, pointless
 	void* items;
 	pointless_create_value_t* vv;
 
-	if (v->header.is_outside_vector) {
+	// empty vectors have no vector of their own
+	if (v->header.type_29 == POINTLESS_VECTOR_EMPTY) {
+		items = 0;
+		n_items = 0;
+	} else if (v->header.is_outside_vector) {
 		items = cv_get_outside_vector(v)->items;
 		n_items = cv_get_outside_vector(v)->n_items;
 	} else {
@@ -377,6 +631,8 @@ static pointless_hash_reader_32_cb pointless_hash_reader_func_32(uint32_t t)
 			return pointless_hash_reader_unicode_32;
 		case POINTLESS_STRING_:
 			return pointless_hash_reader_string_32;
+		case POINTLESS_UNICODE_UTF8:
+			return pointless_hash_reader_unicode_utf8_32;
 		case POINTLESS_I32:
 		case POINTLESS_U32:
 		case POINTLESS_BOOLEAN:
@@ -469,15 +725,69 @@ uint32_t pointless_is_hashable(uint32_t type)
 	return (pointless_hash_reader_func_32(type) != 0);
 }
 
-uint32_t pointless_hash_reader_32(pointless_t* p, pointless_value_t* v)
+int pointless_hash_reader_stored_32(pointless_t* p, pointless_value_t* v, uint32_t* hash)
+{
+	switch (v->type) {
+		case POINTLESS_UNICODE_:
+		case POINTLESS_STRING_:
+		case POINTLESS_UNICODE_UTF8:
+			if (p->string_unicode_hashes == 0)
+				return 0;
+
+			*hash = p->string_unicode_hashes[v->data.data_u32];
+			return 1;
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+		case POINTLESS_VECTOR_I8:
+		case POINTLESS_VECTOR_U8:
+		case POINTLESS_VECTOR_I16:
+		case POINTLESS_VECTOR_U16:
+		case POINTLESS_VECTOR_I32:
+		case POINTLESS_VECTOR_U32:
+		case POINTLESS_VECTOR_I64:
+		case POINTLESS_VECTOR_U64:
+		case POINTLESS_VECTOR_FLOAT:
+			if (p->vector_hashes == 0)
+				return 0;
+
+			// vectors which are not hashable, or not reachable from a set/map key, have no stored hash
+			*hash = p->vector_hashes[v->data.data_u32];
+			return (*hash != 0);
+	}
+
+	return 0;
+}
+
+int pointless_hash_reader_compatible(pointless_t* p_a, pointless_t* p_b)
+{
+	// strings are the only values whose hash depends on the file
+	return (p_a == p_b || ((p_a->features ^ p_b->features) & POINTLESS_FF_FEATURE_FASTHASH) == 0);
+}
+
+uint32_t pointless_hash_reader_computed_32(pointless_t* p, pointless_value_t* v)
 {
 	assert(pointless_is_hashable(v->type));
 	pointless_hash_reader_32_cb cb = pointless_hash_reader_func_32(v->type);
 	return (*cb)(p, v);
 }
 
+uint32_t pointless_hash_reader_32(pointless_t* p, pointless_value_t* v)
+{
+	uint32_t hash;
+
+	if (pointless_hash_reader_stored_32(p, v, &hash))
+		return hash;
+
+	return pointless_hash_reader_computed_32(p, v);
+}
+
 uint32_t pointless_hash_reader_vector_32(pointless_t* p, pointless_value_t* v, uint32_t i, uint32_t n)
 {
+	uint32_t hash;
+
+	// only whole vectors have a stored hash
+	if (i == 0 && n == pointless_reader_vector_n_items(p, v) && pointless_hash_reader_stored_32(p, v, &hash))
+		return hash;
+
 	return pointless_hash_reader_vector_32_priv(p, v, i, n);
 }
 
@@ -20,8 +20,79 @@ uint32_t pointless_hash_compute_n_buckets(uint32_t n_items)
 	return next_power_of_2(n_items + n_items / 2);
 }
 
-static uint32_t pointless_hash_table_probe_priv(pointless_t* p, uint32_t value_hash, pointless_value_t* value, uint32_t n_buckets, uint32_t* hash_vector, pointless_value_t* key_vector, pointless_eq_cb cb, void* user, const char** error)
+void pointless_hash_table_init(pointless_hash_table_t* t, uint32_t layout, uint32_t is_map, uint32_t* hashes, uint32_t n_hashes, pointless_value_t* keys, pointless_value_t* values)
 {
+	t->layout = layout;
+	t->n_primary = 0;
+	t->n_pilots = 0;
+	t->pilots = 0;
+
+	// minimal perfect hash tables are interleaved records, after the pilots
+	if (layout == POINTLESS_HASH_TABLE_LAYOUT_MPHF) {
+		t->n_primary = hashes[0];
+		t->n_pilots = hashes[1];
+		t->pilots = hashes + POINTLESS_MPHF_HEADER_WORDS;
+		hashes = t->pilots + t->n_pilots;
+		n_hashes -= POINTLESS_MPHF_HEADER_WORDS + t->n_pilots;
+	}
+
+	if (layout != POINTLESS_HASH_TABLE_LAYOUT_SPLIT) {
+		uint32_t stride = (is_map ? POINTLESS_MAP_INTERLEAVED_STRIDE : POINTLESS_SET_INTERLEAVED_STRIDE);
+		t->n_buckets = n_hashes / stride;
+		t->hash_stride = stride * sizeof(uint32_t);
+		t->kv_stride = stride * sizeof(uint32_t);
+		t->hashes = hashes;
+		t->keys = (pointless_value_t*)(hashes + 1);
+		t->values = is_map ? (pointless_value_t*)(hashes + 3) : 0;
+	} else {
+		t->n_buckets = n_hashes;
+		t->hash_stride = sizeof(uint32_t);
+		t->kv_stride = sizeof(pointless_value_t);
+		t->hashes = hashes;
+		t->keys = keys;
+		t->values = values;
+	}
+}
+
+// compares a key in the hash table, either to a value in the same file, or through a callback
+static uint32_t pointless_hash_table_is_equal(pointless_t* p, pointless_value_t* value, pointless_value_t* key, pointless_eq_cb cb, void* user, const char** error)
+{
+	if (cb) {
+		pointless_complete_value_t v_a = pointless_value_to_complete(key);
+		return ((*cb)(p, &v_a, user, error) != 0);
+	}
+
+	pointless_complete_value_t v_a = pointless_value_to_complete(value);
+	pointless_complete_value_t v_b = pointless_value_to_complete(key);
+	return pointless_eq_reader(p, &v_a, p, &v_b, error);
+}
+
+// a minimal perfect hash table has a single candidate bucket for a hash, unless its key shares the hash with others
+static uint32_t pointless_hash_table_probe_mphf(pointless_t* p, uint32_t value_hash, pointless_value_t* value, pointless_hash_table_t* t, pointless_eq_cb cb, void* user, const char** error)
+{
+	pointless_hash_iter_state_t state;
+	uint32_t bucket, is_equal;
+
+	pointless_hash_table_probe_hash_init(p, value_hash, t, &state);
+
+	while (pointless_hash_table_probe_hash(p, t, &state, &bucket)) {
+		is_equal = pointless_hash_table_is_equal(p, value, PHT_KEY(t, bucket), cb, user, error);
+
+		if (*error)
+			return POINTLESS_HASH_TABLE_PROBE_ERROR;
+
+		if (is_equal)
+			return bucket;
+	}
+
+	return POINTLESS_HASH_TABLE_PROBE_MISS;
+}
+
+static uint32_t pointless_hash_table_probe_priv(pointless_t* p, uint32_t value_hash, pointless_value_t* value, pointless_hash_table_t* t, pointless_eq_cb cb, void* user, const char** error)
+{
+	if (t->layout == POINTLESS_HASH_TABLE_LAYOUT_MPHF)
+		return pointless_hash_table_probe_mphf(p, value_hash, value, t, cb, user, error);
+
 	// we use the same probing strategy as Python
 	// 1) number of buckets is a power-of-2
 	// 2) the recurrence used is: j = (5*j) + 1 + perturb
@@ -29,28 +100,19 @@ static uint32_t pointless_hash_table_probe_priv(pointless_t* p, uint32_t value_h
 	//    Since the recurrence j = (5*j) + 1 will repeat, after having visited all 2**i buckets
 	//    so will the first recurrence, since perturb will eventually reach zero.
 	// 3) PERTURB_SHIFT is set to 5
-	uint32_t perturb = value_hash, i = value_hash, mask = n_buckets - 1, bucket;
+	uint32_t perturb = value_hash, i = value_hash, mask = t->n_buckets - 1, bucket;
 
 	while (1) {
 		bucket = i & mask;
 
 		// we hit an empty bucket
-		if (key_vector[bucket].type == POINTLESS_EMPTY_SLOT)
+		if (PHT_KEY(t, bucket)->type == POINTLESS_EMPTY_SLOT)
 			return POINTLESS_HASH_TABLE_PROBE_MISS;
 
 		// test hash
-		if (value_hash == hash_vector[bucket]) {
+		if (value_hash == PHT_HASH(t, bucket)) {
 			// test key equality
-			uint32_t is_equal;
-
-			if (cb) {
-				pointless_complete_value_t v_a = pointless_value_to_complete(&key_vector[bucket]);
-				is_equal = ((*cb)(p, &v_a, user, error) != 0);
-			} else {
-				pointless_complete_value_t v_a = pointless_value_to_complete(value);
-				pointless_complete_value_t v_b = pointless_value_to_complete(&key_vector[bucket]);
-				is_equal = (pointless_cmp_reader(p, &v_a, p, &v_b, error) == 0);
-			}
+			uint32_t is_equal = pointless_hash_table_is_equal(p, value, PHT_KEY(t, bucket), cb, user, error);
 
 			if (*error)
 				return POINTLESS_HASH_TABLE_PROBE_ERROR;
@@ -70,19 +132,79 @@ static uint32_t pointless_hash_table_probe_priv(pointless_t* p, uint32_t value_h
 	return POINTLESS_HASH_TABLE_PROBE_ERROR;
 }
 
-void pointless_hash_table_probe_hash_init(pointless_t* p, uint32_t value_hash, uint32_t n_buckets, pointless_hash_iter_state_t* state)
+// first overflow bucket of a minimal perfect hash table with a hash of at least value_hash
+static uint32_t pointless_hash_table_mphf_lower_bound(pointless_hash_table_t* t, uint32_t value_hash)
 {
+	uint32_t lo = t->n_primary, hi = t->n_buckets, mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+
+		if (PHT_HASH(t, mid) < value_hash)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+static void pointless_hash_table_mphf_probe_hash_init(pointless_hash_table_t* t, uint32_t value_hash, pointless_hash_iter_state_t* state)
+{
+	uint32_t bucket;
+
+	// nothing to visit
+	state->i = state->mask = t->n_buckets;
+
+	if (t->n_primary == 0)
+		return;
+
+	bucket = pointless_mphf_slot(t->pilots, t->n_pilots, t->n_primary, value_hash);
+
+	// only keys with this hash are visited
+	if (PHT_HASH(t, bucket) == value_hash)
+		state->i = bucket;
+}
+
+void pointless_hash_table_probe_hash_init(pointless_t* p, uint32_t value_hash, pointless_hash_table_t* t, pointless_hash_iter_state_t* state)
+{
+	if (t->layout == POINTLESS_HASH_TABLE_LAYOUT_MPHF) {
+		pointless_hash_table_mphf_probe_hash_init(t, value_hash, state);
+		return;
+	}
+
 	state->perturb = value_hash;
 	state->i = value_hash;
-	state->mask = n_buckets - 1;
+	state->mask = t->n_buckets - 1;
 }
 
-uint32_t pointless_hash_table_probe_hash(pointless_t* p, uint32_t* hash_vector, pointless_value_t* key_vector, pointless_hash_iter_state_t* state, uint32_t* bucket_out)
+uint32_t pointless_hash_table_probe_hash(pointless_t* p, pointless_hash_table_t* t, pointless_hash_iter_state_t* state, uint32_t* bucket_out)
 {
+	// the primary bucket, then other keys with the same hash in the overflow, usually none
+	if (t->layout == POINTLESS_HASH_TABLE_LAYOUT_MPHF) {
+		if (state->i < t->n_primary) {
+			*bucket_out = state->i;
+			state->i = state->mask = pointless_hash_table_mphf_lower_bound(t, PHT_HASH(t, *bucket_out));
+
+			while (state->mask < t->n_buckets && PHT_HASH(t, state->mask) == PHT_HASH(t, *bucket_out))
+				state->mask += 1;
+
+			return 1;
+		}
+
+		if (state->i < state->mask) {
+			*bucket_out = state->i;
+			state->i += 1;
+			return 1;
+		}
+
+		return 0;
+	}
+
 	uint32_t bucket = state->i & state->mask;
 
 	// we're at an empty bucket
-	if (key_vector[bucket].type == POINTLESS_EMPTY_SLOT)
+	if (PHT_KEY(t, bucket)->type == POINTLESS_EMPTY_SLOT)
 		return 0;
 
 	// compute recurrence
@@ -94,14 +216,150 @@ uint32_t pointless_hash_table_probe_hash(pointless_t* p, uint32_t* hash_vector,
 	return 1;
 }
 
-uint32_t pointless_hash_table_probe(pointless_t* p, uint32_t value_hash, pointless_value_t* value, uint32_t n_buckets, uint32_t* hash_vector, pointless_value_t* key_vector, const char** error)
+uint32_t pointless_hash_table_probe(pointless_t* p, uint32_t value_hash, pointless_value_t* value, pointless_hash_table_t* t, const char** error)
+{
+	return pointless_hash_table_probe_priv(p, value_hash, value, t, 0, 0, error);
+}
+
+uint32_t pointless_hash_table_probe_ext(pointless_t* p, uint32_t value_hash, pointless_eq_cb cb, void* user, pointless_hash_table_t* t, const char** error)
+{
+	return pointless_hash_table_probe_priv(p, value_hash, 0, t, cb, user, error);
+}
+
+// one in-flight probe of a batch
+typedef struct {
+	uint32_t value;
+	uint32_t i;
+	uint32_t perturb;
+} pointless_hash_table_batch_probe_t;
+
+// requests the cache lines of a bucket, with an interleaved layout, both usually end up on the same line
+static void pointless_hash_table_batch_prefetch(pointless_hash_table_t* t, uint32_t bucket)
 {
-	return pointless_hash_table_probe_priv(p, value_hash, value, n_buckets, hash_vector, key_vector, 0, 0, error);
+	__builtin_prefetch(PHT_KEY(t, bucket));
+	__builtin_prefetch(&PHT_HASH(t, bucket));
+}
+
+static void pointless_hash_table_batch_start(pointless_hash_table_batch_probe_t* probe, uint32_t value, uint32_t value_hash, pointless_hash_table_t* t)
+{
+	probe->value = value;
+	probe->i = value_hash;
+	probe->perturb = value_hash;
+
+	pointless_hash_table_batch_prefetch(t, value_hash & (t->n_buckets - 1));
 }
 
-uint32_t pointless_hash_table_probe_ext(pointless_t* p, uint32_t value_hash, pointless_eq_cb cb, void* user, uint32_t n_buckets, uint32_t* hash_vector, pointless_value_t* key_vector, const char** error)
+// with a minimal perfect hash table, each key has one candidate bucket, found through its pilot. so for a group
+// of keys, we first request their pilots, then their buckets, and only then compare them
+static int pointless_hash_table_probe_batch_mphf(pointless_t* p, uint32_t n, uint32_t* value_hashes, pointless_value_t* values, pointless_eq_cb cb, void** users, pointless_hash_table_t* t, uint32_t* buckets, const char** error)
 {
-	return pointless_hash_table_probe_priv(p, value_hash, 0, n_buckets, hash_vector, key_vector, cb, user, error);
+	uint32_t i, j, n_group, bucket, is_equal;
+
+	if (t->n_primary == 0) {
+		for (i = 0; i < n; i++)
+			buckets[i] = POINTLESS_HASH_TABLE_PROBE_MISS;
+
+		return 1;
+	}
+
+	for (i = 0; i < n; i += n_group) {
+		n_group = SIMPLE_MIN(n - i, POINTLESS_HASH_TABLE_BATCH_WIDTH);
+
+		for (j = i; j < i + n_group; j++) {
+			buckets[j] = pointless_mphf_bucket(value_hashes[j], t->n_pilots);
+			__builtin_prefetch(&t->pilots[buckets[j]]);
+		}
+
+		for (j = i; j < i + n_group; j++) {
+			buckets[j] = pointless_mphf_position(value_hashes[j], t->pilots[buckets[j]], t->n_primary);
+			pointless_hash_table_batch_prefetch(t, buckets[j]);
+		}
+
+		for (j = i; j < i + n_group; j++) {
+			bucket = buckets[j];
+
+			if (PHT_HASH(t, bucket) != value_hashes[j]) {
+				buckets[j] = POINTLESS_HASH_TABLE_PROBE_MISS;
+				continue;
+			}
+
+			is_equal = pointless_hash_table_is_equal(p, values ? &values[j] : 0, PHT_KEY(t, bucket), cb, users ? users[j] : 0, error);
+
+			if (*error)
+				return 0;
+
+			// the key may still be in the overflow
+			if (!is_equal) {
+				buckets[j] = pointless_hash_table_probe_mphf(p, value_hashes[j], values ? &values[j] : 0, t, cb, users ? users[j] : 0, error);
+
+				if (buckets[j] == POINTLESS_HASH_TABLE_PROBE_ERROR)
+					return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+int pointless_hash_table_probe_batch(pointless_t* p, uint32_t n, uint32_t* value_hashes, pointless_value_t* values, pointless_eq_cb cb, void** users, pointless_hash_table_t* t, uint32_t* buckets, const char** error)
+{
+	if (t->layout == POINTLESS_HASH_TABLE_LAYOUT_MPHF)
+		return pointless_hash_table_probe_batch_mphf(p, n, value_hashes, values, cb, users, t, buckets, error);
+
+	// same probing strategy as pointless_hash_table_probe_priv(), but instead of waiting for each bucket to be
+	// loaded, we move on to the next probe in the batch, and come back once it has (hopefully) arrived
+	pointless_hash_table_batch_probe_t probes[POINTLESS_HASH_TABLE_BATCH_WIDTH];
+	uint32_t n_active = 0, next = 0, mask = t->n_buckets - 1, j;
+
+	while (n_active < POINTLESS_HASH_TABLE_BATCH_WIDTH && next < n) {
+		pointless_hash_table_batch_start(&probes[n_active++], next, value_hashes[next], t);
+		next += 1;
+	}
+
+	while (n_active > 0) {
+		for (j = 0; j < n_active; ) {
+			pointless_hash_table_batch_probe_t* probe = &probes[j];
+			uint32_t bucket = probe->i & mask;
+			uint32_t value_hash = value_hashes[probe->value];
+			uint32_t is_done = 0;
+
+			// we hit an empty bucket
+			if (PHT_KEY(t, bucket)->type == POINTLESS_EMPTY_SLOT) {
+				buckets[probe->value] = POINTLESS_HASH_TABLE_PROBE_MISS;
+				is_done = 1;
+			// test hash, then key equality
+			} else if (value_hash == PHT_HASH(t, bucket)) {
+				uint32_t is_equal = pointless_hash_table_is_equal(p, values ? &values[probe->value] : 0, PHT_KEY(t, bucket), cb, users ? users[probe->value] : 0, error);
+
+				if (*error)
+					return 0;
+
+				if (is_equal) {
+					buckets[probe->value] = bucket;
+					is_done = 1;
+				}
+			}
+
+			// compute recurrence, and request the next bucket
+			if (!is_done) {
+				probe->i = (probe->i << 2) + probe->i + probe->perturb + 1;
+				probe->perturb >>= 5;
+
+				pointless_hash_table_batch_prefetch(t, probe->i & mask);
+
+				j += 1;
+			// start a new probe in its place, or drop it
+			} else if (next < n) {
+				pointless_hash_table_batch_start(probe, next, value_hashes[next], t);
+				next += 1;
+				j += 1;
+			} else {
+				probes[j] = probes[--n_active];
+			}
+		}
+	}
+
+	return 1;
 }
 
 int pointless_hash_table_populate(pointless_create_t* c, uint32_t* hash_vector, uint32_t* keys_vector, uint32_t* values_vector, uint32_t n_keys, uint32_t* hash_serialize, uint32_t* keys_serialize, uint32_t* values_serialize, uint32_t n_buckets, uint32_t empty_slot_handle, const char** error)
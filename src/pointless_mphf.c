@@ -0,0 +1,178 @@
+#include <pointless/pointless_mphf.h>
+
+// average number of hashes per bucket, larger buckets need fewer pilots, but take longer to place
+#define POINTLESS_MPHF_BUCKET_SIZE 4
+
+// murmur3 finalizers
+static uint32_t pointless_mphf_mix_32(uint32_t h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+	return h;
+}
+
+static uint64_t pointless_mphf_mix_64(uint64_t h)
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+// maps h onto [0, n) without a division
+static uint32_t pointless_mphf_reduce(uint32_t h, uint32_t n)
+{
+	return (uint32_t)(((uint64_t)h * n) >> 32);
+}
+
+uint32_t pointless_mphf_bucket(uint32_t hash, uint32_t n_pilots)
+{
+	return pointless_mphf_reduce(pointless_mphf_mix_32(hash ^ 0x9e3779b9), n_pilots);
+}
+
+uint32_t pointless_mphf_position(uint32_t hash, uint32_t pilot, uint32_t n_keys)
+{
+	return pointless_mphf_reduce((uint32_t)(pointless_mphf_mix_64(((uint64_t)pilot << 32) | hash) >> 32), n_keys);
+}
+
+uint32_t pointless_mphf_n_pilots(uint32_t n_keys)
+{
+	return n_keys / POINTLESS_MPHF_BUCKET_SIZE + (n_keys % POINTLESS_MPHF_BUCKET_SIZE != 0);
+}
+
+uint32_t pointless_mphf_slot(uint32_t* pilots, uint32_t n_pilots, uint32_t n_keys, uint32_t hash)
+{
+	return pointless_mphf_position(hash, pilots[pointless_mphf_bucket(hash, n_pilots)], n_keys);
+}
+
+// true iff the pilot sends all keys of the bucket to distinct free slots, which are then in positions
+static int pointless_mphf_try_pilot(uint32_t* hashes, uint32_t* keys, uint32_t n, uint32_t pilot, uint32_t n_keys, void* taken, uint32_t* positions)
+{
+	uint32_t i, j;
+
+	for (i = 0; i < n; i++) {
+		positions[i] = pointless_mphf_position(hashes[keys[i]], pilot, n_keys);
+
+		if (bm_is_set_(taken, positions[i]))
+			return 0;
+
+		for (j = 0; j < i; j++) {
+			if (positions[j] == positions[i])
+				return 0;
+		}
+	}
+
+	return 1;
+}
+
+int pointless_mphf_build(uint32_t* hashes, uint32_t n_keys, uint32_t* pilots, uint32_t* slots, const char** error)
+{
+	int retval = 0;
+
+	uint32_t n_pilots = pointless_mphf_n_pilots(n_keys);
+	uint32_t i, j, b, n, pilot, max_size = 0;
+
+	// keys of bucket b are bucket_keys[bucket_start[b]:bucket_start[b + 1]]
+	uint32_t* bucket_start = (uint32_t*)pointless_calloc((size_t)n_pilots + 1, sizeof(uint32_t));
+	uint32_t* bucket_keys = (uint32_t*)pointless_malloc(sizeof(uint32_t) * ((size_t)n_keys + 1));
+	uint32_t* bucket_order = (uint32_t*)pointless_malloc(sizeof(uint32_t) * ((size_t)n_pilots + 1));
+	uint32_t* size_start = 0;
+	uint32_t* positions = 0;
+	void* taken = pointless_calloc((size_t)n_keys / 8 + 1, 1);
+
+	if (bucket_start == 0 || bucket_keys == 0 || bucket_order == 0 || taken == 0) {
+		*error = "out of memory";
+		goto cleanup;
+	}
+
+	// counting sort of keys by bucket
+	for (i = 0; i < n_keys; i++)
+		bucket_start[pointless_mphf_bucket(hashes[i], n_pilots) + 1] += 1;
+
+	for (b = 0; b < n_pilots; b++) {
+		max_size = (bucket_start[b + 1] > max_size) ? bucket_start[b + 1] : max_size;
+		bucket_start[b + 1] += bucket_start[b];
+	}
+
+	for (i = 0; i < n_keys; i++) {
+		b = pointless_mphf_bucket(hashes[i], n_pilots);
+		bucket_keys[bucket_start[b]++] = i;
+	}
+
+	for (b = n_pilots; b > 0; b--)
+		bucket_start[b] = bucket_start[b - 1];
+
+	bucket_start[0] = 0;
+
+	// counting sort of buckets by decreasing size, the big ones are placed while most slots are still free
+	size_start = (uint32_t*)pointless_calloc((size_t)max_size + 2, sizeof(uint32_t));
+	positions = (uint32_t*)pointless_malloc(sizeof(uint32_t) * ((size_t)max_size + 1));
+
+	if (size_start == 0 || positions == 0) {
+		*error = "out of memory";
+		goto cleanup;
+	}
+
+	for (b = 0; b < n_pilots; b++)
+		size_start[max_size - (bucket_start[b + 1] - bucket_start[b]) + 1] += 1;
+
+	for (i = 0; i < max_size; i++)
+		size_start[i + 1] += size_start[i];
+
+	for (b = 0; b < n_pilots; b++)
+		bucket_order[size_start[max_size - (bucket_start[b + 1] - bucket_start[b])]++] = b;
+
+	// find a pilot for each bucket
+	for (i = 0; i < n_pilots; i++) {
+		b = bucket_order[i];
+		n = bucket_start[b + 1] - bucket_start[b];
+
+		// equal hashes end up in the same slot with any pilot
+		for (j = 1; j < n; j++) {
+			uint32_t k;
+
+			for (k = 0; k < j; k++) {
+				if (hashes[bucket_keys[bucket_start[b] + j]] == hashes[bucket_keys[bucket_start[b] + k]]) {
+					*error = "minimal perfect hash requires distinct hashes";
+					goto cleanup;
+				}
+			}
+		}
+
+		pilot = 0;
+
+		while (!pointless_mphf_try_pilot(hashes, bucket_keys + bucket_start[b], n, pilot, n_keys, taken, positions)) {
+			if (pilot == UINT32_MAX) {
+				*error = "unable to find a minimal perfect hash";
+				goto cleanup;
+			}
+
+			pilot += 1;
+		}
+
+		pilots[b] = pilot;
+
+		for (j = 0; j < n; j++) {
+			slots[bucket_keys[bucket_start[b] + j]] = positions[j];
+			bm_set_(taken, positions[j]);
+		}
+	}
+
+	retval = 1;
+
+cleanup:
+
+	pointless_free(bucket_start);
+	pointless_free(bucket_keys);
+	pointless_free(bucket_order);
+	pointless_free(size_start);
+	pointless_free(positions);
+	pointless_free(taken);
+
+	return retval;
+}
@@ -0,0 +1,269 @@
+#include <pointless/pointless_open_table.h>
+#include <pointless/pointless_defs.h>
+
+// first allocation, must be a power of two
+#define POINTLESS_OPEN_TABLE_MIN_ENTRIES 16
+
+// fibonacci hashing, the multiplication moves the entropy of aligned pointers into the high bits
+static uint32_t pointless_ptr_table_hash(const void* key)
+{
+	return (uint32_t)(((uint64_t)(uintptr_t)key * 0x9e3779b97f4a7c15ULL) >> 32);
+}
+
+// a new, zeroed, entry array for t, with the same backing as the one it replaces
+static int pointless_open_table_entries(pointless_dynarray_t* entries, pointless_dynarray_t* old, size_t item_size, size_t* n_entries)
+{
+	*n_entries = (pointless_dynarray_n_items(old) == 0) ? POINTLESS_OPEN_TABLE_MIN_ENTRIES : pointless_dynarray_n_items(old) * 2;
+
+	pointless_dynarray_init(entries, item_size);
+	pointless_dynarray_set_backing(entries, old->backing);
+
+	if (!pointless_dynarray_resize(entries, *n_entries)) {
+		pointless_dynarray_destroy(entries);
+		return 0;
+	}
+
+	return 1;
+}
+
+void pointless_bytes_table_init(pointless_bytes_table_t* t)
+{
+	pointless_dynarray_init(&t->entries, sizeof(pointless_bytes_table_entry_t));
+	t->n_items = 0;
+}
+
+void pointless_bytes_table_destroy(pointless_bytes_table_t* t)
+{
+	pointless_dynarray_destroy(&t->entries);
+	t->n_items = 0;
+}
+
+static pointless_bytes_table_entry_t* pointless_bytes_table_find(pointless_bytes_table_entry_t* entries, size_t n_entries, const void* key, size_t n_key, uint32_t hash)
+{
+	size_t i = hash & (n_entries - 1);
+
+	while (entries[i].key) {
+		if (entries[i].hash == hash && entries[i].n_key == n_key && memcmp(entries[i].key, key, n_key) == 0)
+			break;
+
+		i = (i + 1) & (n_entries - 1);
+	}
+
+	return &entries[i];
+}
+
+static int pointless_bytes_table_grow(pointless_bytes_table_t* t)
+{
+	pointless_dynarray_t a;
+	size_t i, n_entries, n_old = pointless_dynarray_n_items(&t->entries);
+
+	if (!pointless_open_table_entries(&a, &t->entries, sizeof(pointless_bytes_table_entry_t), &n_entries))
+		return 0;
+
+	pointless_bytes_table_entry_t* old = (pointless_bytes_table_entry_t*)pointless_dynarray_buffer(&t->entries);
+	pointless_bytes_table_entry_t* entries = (pointless_bytes_table_entry_t*)pointless_dynarray_buffer(&a);
+
+	// hashes are kept, so moving an entry never touches its key
+	for (i = 0; i < n_old; i++) {
+		if (old[i].key == 0)
+			continue;
+
+		size_t j = old[i].hash & (n_entries - 1);
+
+		while (entries[j].key)
+			j = (j + 1) & (n_entries - 1);
+
+		entries[j] = old[i];
+	}
+
+	pointless_dynarray_destroy(&t->entries);
+	t->entries = a;
+
+	return 1;
+}
+
+uint32_t pointless_bytes_table_get(pointless_bytes_table_t* t, const void* key, size_t n_key)
+{
+	if (t->n_items == 0)
+		return POINTLESS_OPEN_TABLE_MISSING;
+
+	uint32_t hash = pointless_hash_string_v2_32((uint8_t*)key, n_key);
+	pointless_bytes_table_entry_t* e = pointless_bytes_table_find((pointless_bytes_table_entry_t*)pointless_dynarray_buffer(&t->entries), pointless_dynarray_n_items(&t->entries), key, n_key, hash);
+
+	return e->key ? e->value : POINTLESS_OPEN_TABLE_MISSING;
+}
+
+int pointless_bytes_table_set(pointless_bytes_table_t* t, const void* key, size_t n_key, uint32_t value)
+{
+	if ((t->n_items + 1) * 2 > pointless_dynarray_n_items(&t->entries) && !pointless_bytes_table_grow(t))
+		return 0;
+
+	uint32_t hash = pointless_hash_string_v2_32((uint8_t*)key, n_key);
+	pointless_bytes_table_entry_t* e = pointless_bytes_table_find((pointless_bytes_table_entry_t*)pointless_dynarray_buffer(&t->entries), pointless_dynarray_n_items(&t->entries), key, n_key, hash);
+
+	assert(e->key == 0);
+
+	e->key = key;
+	e->n_key = n_key;
+	e->hash = hash;
+	e->value = value;
+
+	t->n_items += 1;
+
+	return 1;
+}
+
+void pointless_ptr_table_init(pointless_ptr_table_t* t)
+{
+	pointless_dynarray_init(&t->entries, sizeof(pointless_ptr_table_entry_t));
+	t->n_items = 0;
+}
+
+void pointless_ptr_table_destroy(pointless_ptr_table_t* t)
+{
+	pointless_dynarray_destroy(&t->entries);
+	t->n_items = 0;
+}
+
+static pointless_ptr_table_entry_t* pointless_ptr_table_find(pointless_ptr_table_entry_t* entries, size_t n_entries, const void* key)
+{
+	size_t i = pointless_ptr_table_hash(key) & (n_entries - 1);
+
+	while (entries[i].key && entries[i].key != key)
+		i = (i + 1) & (n_entries - 1);
+
+	return &entries[i];
+}
+
+static int pointless_ptr_table_grow(pointless_ptr_table_t* t)
+{
+	pointless_dynarray_t a;
+	size_t i, n_entries, n_old = pointless_dynarray_n_items(&t->entries);
+
+	if (!pointless_open_table_entries(&a, &t->entries, sizeof(pointless_ptr_table_entry_t), &n_entries))
+		return 0;
+
+	pointless_ptr_table_entry_t* old = (pointless_ptr_table_entry_t*)pointless_dynarray_buffer(&t->entries);
+	pointless_ptr_table_entry_t* entries = (pointless_ptr_table_entry_t*)pointless_dynarray_buffer(&a);
+
+	for (i = 0; i < n_old; i++) {
+		if (old[i].key)
+			*pointless_ptr_table_find(entries, n_entries, old[i].key) = old[i];
+	}
+
+	pointless_dynarray_destroy(&t->entries);
+	t->entries = a;
+
+	return 1;
+}
+
+uint32_t pointless_ptr_table_get(pointless_ptr_table_t* t, const void* key)
+{
+	if (t->n_items == 0)
+		return POINTLESS_OPEN_TABLE_MISSING;
+
+	pointless_ptr_table_entry_t* e = pointless_ptr_table_find((pointless_ptr_table_entry_t*)pointless_dynarray_buffer(&t->entries), pointless_dynarray_n_items(&t->entries), key);
+
+	return e->key ? e->value : POINTLESS_OPEN_TABLE_MISSING;
+}
+
+int pointless_ptr_table_set(pointless_ptr_table_t* t, const void* key, uint32_t value)
+{
+	if ((t->n_items + 1) * 2 > pointless_dynarray_n_items(&t->entries) && !pointless_ptr_table_grow(t))
+		return 0;
+
+	pointless_ptr_table_entry_t* e = pointless_ptr_table_find((pointless_ptr_table_entry_t*)pointless_dynarray_buffer(&t->entries), pointless_dynarray_n_items(&t->entries), key);
+
+	if (e->key == 0)
+		t->n_items += 1;
+
+	e->key = key;
+	e->value = value;
+
+	return 1;
+}
+
+void pointless_ref_table_init(pointless_ref_table_t* t)
+{
+	pointless_dynarray_init(&t->entries, sizeof(pointless_ref_table_entry_t));
+	t->n_items = 0;
+}
+
+void pointless_ref_table_destroy(pointless_ref_table_t* t)
+{
+	pointless_dynarray_destroy(&t->entries);
+	t->n_items = 0;
+}
+
+static int pointless_ref_table_grow(pointless_ref_table_t* t)
+{
+	pointless_dynarray_t a;
+	size_t i, n_entries, n_old = pointless_dynarray_n_items(&t->entries);
+
+	if (!pointless_open_table_entries(&a, &t->entries, sizeof(pointless_ref_table_entry_t), &n_entries))
+		return 0;
+
+	pointless_ref_table_entry_t* old = (pointless_ref_table_entry_t*)pointless_dynarray_buffer(&t->entries);
+	pointless_ref_table_entry_t* entries = (pointless_ref_table_entry_t*)pointless_dynarray_buffer(&a);
+
+	for (i = 0; i < n_entries; i++)
+		entries[i].value = POINTLESS_OPEN_TABLE_MISSING;
+
+	for (i = 0; i < n_old; i++) {
+		if (old[i].value == POINTLESS_OPEN_TABLE_MISSING)
+			continue;
+
+		size_t j = old[i].hash & (n_entries - 1);
+
+		while (entries[j].value != POINTLESS_OPEN_TABLE_MISSING)
+			j = (j + 1) & (n_entries - 1);
+
+		entries[j] = old[i];
+	}
+
+	pointless_dynarray_destroy(&t->entries);
+	t->entries = a;
+
+	return 1;
+}
+
+uint32_t pointless_ref_table_get(pointless_ref_table_t* t, uint32_t hash, pointless_ref_table_eq_cb eq, void* user)
+{
+	if (t->n_items == 0)
+		return POINTLESS_OPEN_TABLE_MISSING;
+
+	pointless_ref_table_entry_t* entries = (pointless_ref_table_entry_t*)pointless_dynarray_buffer(&t->entries);
+	size_t n_entries = pointless_dynarray_n_items(&t->entries);
+	size_t i = hash & (n_entries - 1);
+
+	while (entries[i].value != POINTLESS_OPEN_TABLE_MISSING) {
+		if (entries[i].hash == hash && (*eq)(entries[i].value, user))
+			return entries[i].value;
+
+		i = (i + 1) & (n_entries - 1);
+	}
+
+	return POINTLESS_OPEN_TABLE_MISSING;
+}
+
+int pointless_ref_table_set(pointless_ref_table_t* t, uint32_t hash, uint32_t value)
+{
+	assert(value != POINTLESS_OPEN_TABLE_MISSING);
+
+	if ((t->n_items + 1) * 2 > pointless_dynarray_n_items(&t->entries) && !pointless_ref_table_grow(t))
+		return 0;
+
+	pointless_ref_table_entry_t* entries = (pointless_ref_table_entry_t*)pointless_dynarray_buffer(&t->entries);
+	size_t n_entries = pointless_dynarray_n_items(&t->entries);
+	size_t i = hash & (n_entries - 1);
+
+	while (entries[i].value != POINTLESS_OPEN_TABLE_MISSING)
+		i = (i + 1) & (n_entries - 1);
+
+	entries[i].hash = hash;
+	entries[i].value = value;
+
+	t->n_items += 1;
+
+	return 1;
+}
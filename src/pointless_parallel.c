@@ -0,0 +1,108 @@
+#include <pointless/pointless_parallel.h>
+
+// items are handed out in chunks, since the per-item work is often tiny
+#define POINTLESS_PARALLEL_CHUNK 64
+
+typedef struct {
+	pointless_parallel_item_cb cb;
+	void* user;
+	uint64_t n_items;
+	uint64_t next_item;
+	uint32_t is_stopped;
+	const char* error;
+	pthread_mutex_t error_lock;
+} pointless_parallel_state_t;
+
+static void* pointless_parallel_worker(void* user)
+{
+	pointless_parallel_state_t* state = (pointless_parallel_state_t*)user;
+
+	while (__sync_fetch_and_add(&state->is_stopped, 0) == 0) {
+		uint64_t i = __sync_fetch_and_add(&state->next_item, POINTLESS_PARALLEL_CHUNK);
+
+		if (i >= state->n_items)
+			break;
+
+		uint64_t n = (i + POINTLESS_PARALLEL_CHUNK < state->n_items) ? i + POINTLESS_PARALLEL_CHUNK : state->n_items;
+
+		for (; i < n; i++) {
+			const char* error = 0;
+
+			if (!(*state->cb)((uint32_t)i, state->user, &error)) {
+				// first error wins
+				pthread_mutex_lock(&state->error_lock);
+
+				if (state->error == 0)
+					state->error = error;
+
+				pthread_mutex_unlock(&state->error_lock);
+
+				__sync_fetch_and_add(&state->is_stopped, 1);
+				return 0;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int32_t pointless_parallel_for(uint32_t n_items, uint32_t n_threads, pointless_parallel_item_cb cb, void* user, const char** error)
+{
+	pointless_parallel_state_t state;
+	state.cb = cb;
+	state.user = user;
+	state.n_items = n_items;
+	state.next_item = 0;
+	state.is_stopped = 0;
+	state.error = 0;
+
+	if (pthread_mutex_init(&state.error_lock, 0) != 0) {
+		*error = "pthread_mutex_init() failure";
+		return 0;
+	}
+
+	// the calling thread is one of the workers
+	uint32_t i, n_started = 0;
+	pthread_t* threads = 0;
+
+	// threads beyond one per chunk never get any items, and threads beyond one per processor only contend
+	uint64_t n_chunks = ((uint64_t)n_items + POINTLESS_PARALLEL_CHUNK - 1) / POINTLESS_PARALLEL_CHUNK;
+	long n_processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (n_threads > n_chunks)
+		n_threads = (uint32_t)n_chunks;
+
+	if (n_processors > 0 && n_threads > (uint64_t)n_processors)
+		n_threads = (uint32_t)n_processors;
+
+	if (n_threads > POINTLESS_PARALLEL_MAX_THREADS)
+		n_threads = POINTLESS_PARALLEL_MAX_THREADS;
+
+	n_threads = (n_threads > 0) ? n_threads - 1 : 0;
+
+	if (n_threads > 0)
+		threads = (pthread_t*)pointless_malloc(sizeof(pthread_t) * n_threads);
+
+	// if we cannot start all threads, the ones we have just take on more work
+	if (threads) {
+		for (i = 0; i < n_threads; i++) {
+			if (pthread_create(&threads[n_started], 0, pointless_parallel_worker, &state) == 0)
+				n_started += 1;
+		}
+	}
+
+	pointless_parallel_worker(&state);
+
+	for (i = 0; i < n_started; i++)
+		pthread_join(threads[i], 0);
+
+	pointless_free(threads);
+	pthread_mutex_destroy(&state.error_lock);
+
+	if (state.error) {
+		*error = state.error;
+		return 0;
+	}
+
+	return 1;
+}
@@ -0,0 +1,352 @@
+#include <pointless/pointless_prefetch.h>
+
+typedef struct pointless_prefetch_thread_s {
+	pthread_t thread;
+	uint32_t done;
+	struct pointless_prefetch_thread_s* next;
+} pointless_prefetch_thread_t;
+
+// per pointless_t, owned by p->prefetch, the list is shared by all callers of pointless_prefetch()
+typedef struct {
+	uint32_t stop;
+	pthread_mutex_t lock;
+	pointless_prefetch_thread_t* threads;
+} pointless_prefetch_threads_t;
+
+typedef struct {
+	pointless_t* p;
+	pointless_value_t v;
+	uint32_t max_depth;
+	uint32_t* stop;
+	uint32_t* done;
+	const char* error;
+
+	// containers already visited
+	void* vector;
+	void* set;
+	void* map;
+
+	// pending page-aligned range, adjacent heap ranges are merged into a single madvise() call
+	uintptr_t page_size;
+	uintptr_t pending_begin;
+	uintptr_t pending_end;
+} pointless_prefetch_state_t;
+
+static void pointless_prefetch_flush(pointless_prefetch_state_t* state)
+{
+	// only a hint, so failures are ignored
+	if (state->pending_begin < state->pending_end)
+		madvise((void*)state->pending_begin, state->pending_end - state->pending_begin, MADV_WILLNEED);
+
+	state->pending_begin = state->pending_end = 0;
+}
+
+static void pointless_prefetch_range(pointless_prefetch_state_t* state, void* ptr, uint64_t n_bytes)
+{
+	// stay within the mapping, which need not start or end on a page boundary of the data itself
+	uintptr_t map_begin = (uintptr_t)state->p->fd_ptr;
+	uintptr_t map_end = map_begin + state->p->fd_len;
+	uintptr_t begin = (uintptr_t)ptr;
+	uintptr_t end = begin + n_bytes;
+
+	begin = begin & ~(state->page_size - 1);
+	end = SIMPLE_MIN((end + state->page_size - 1) & ~(state->page_size - 1), map_end);
+	begin = SIMPLE_MAX(begin, map_begin);
+
+	if (begin >= end)
+		return;
+
+	if (state->pending_begin < state->pending_end && begin <= state->pending_end && end >= state->pending_begin) {
+		state->pending_begin = SIMPLE_MIN(state->pending_begin, begin);
+		state->pending_end = SIMPLE_MAX(state->pending_end, end);
+		return;
+	}
+
+	pointless_prefetch_flush(state);
+
+	state->pending_begin = begin;
+	state->pending_end = end;
+}
+
+static uint64_t pointless_prefetch_vector_item_size(uint32_t type)
+{
+	switch (type) {
+		case POINTLESS_VECTOR_VALUE:
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+			return sizeof(pointless_value_t);
+		case POINTLESS_VECTOR_I8:
+		case POINTLESS_VECTOR_U8:
+			return sizeof(uint8_t);
+		case POINTLESS_VECTOR_I16:
+		case POINTLESS_VECTOR_U16:
+			return sizeof(uint16_t);
+		case POINTLESS_VECTOR_I32:
+		case POINTLESS_VECTOR_U32:
+		case POINTLESS_VECTOR_FLOAT:
+			return sizeof(uint32_t);
+		case POINTLESS_VECTOR_I64:
+		case POINTLESS_VECTOR_U64:
+			return sizeof(uint64_t);
+	}
+
+	assert(0);
+	return 0;
+}
+
+// marks containers as visited, returns 0 if they had been visited already
+static int pointless_prefetch_visit(void* visited, uint32_t i)
+{
+	if (bm_is_set_(visited, i))
+		return 0;
+
+	bm_set_(visited, i);
+	return 1;
+}
+
+static uint32_t pointless_prefetch_cb(pointless_t* p, pointless_value_t* v, uint32_t depth, void* user)
+{
+	pointless_prefetch_state_t* state = (pointless_prefetch_state_t*)user;
+
+	if (__sync_fetch_and_add(state->stop, 0))
+		return POINTLESS_WALK_STOP;
+
+	if (depth > state->max_depth)
+		return POINTLESS_WALK_MOVE_UP;
+
+	// the value must be valid before we read its heap data
+	if (!pointless_validate_lazy(p, v, &state->error))
+		return POINTLESS_WALK_STOP;
+
+	switch (v->type) {
+		case POINTLESS_UNICODE_:
+			pointless_prefetch_range(state, PC_HEAP_OFFSET(p, string_unicode_offsets, v->data.data_u32), sizeof(uint32_t) + ((uint64_t)pointless_reader_unicode_len(p, v) + 1) * sizeof(pointless_unicode_char_t));
+			break;
+		case POINTLESS_STRING_:
+			pointless_prefetch_range(state, PC_HEAP_OFFSET(p, string_unicode_offsets, v->data.data_u32), sizeof(uint32_t) + ((uint64_t)pointless_reader_string_len(p, v) + 1) * sizeof(pointless_string_char_t));
+			break;
+		case POINTLESS_UNICODE_UTF8:
+			pointless_prefetch_range(state, PC_HEAP_OFFSET(p, string_unicode_offsets, v->data.data_u32), sizeof(uint32_t) + ((uint64_t)pointless_reader_unicode_utf8_len(p, v) + 1) * sizeof(uint8_t));
+			break;
+		case POINTLESS_BITVECTOR:
+			pointless_prefetch_range(state, PC_HEAP_OFFSET(p, bitvector_offsets, v->data.data_u32), sizeof(uint32_t) + ICEIL((uint64_t)pointless_reader_bitvector_n_bits(p, v), 8));
+			break;
+		case POINTLESS_VECTOR_VALUE:
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+		case POINTLESS_VECTOR_I8:
+		case POINTLESS_VECTOR_U8:
+		case POINTLESS_VECTOR_I16:
+		case POINTLESS_VECTOR_U16:
+		case POINTLESS_VECTOR_I32:
+		case POINTLESS_VECTOR_U32:
+		case POINTLESS_VECTOR_I64:
+		case POINTLESS_VECTOR_U64:
+		case POINTLESS_VECTOR_FLOAT:
+			if (!pointless_prefetch_visit(state->vector, v->data.data_u32))
+				return POINTLESS_WALK_MOVE_UP;
+
+			pointless_prefetch_range(state, PC_HEAP_OFFSET(p, vector_offsets, v->data.data_u32), sizeof(uint32_t) + (uint64_t)pointless_reader_vector_n_items(p, v) * pointless_prefetch_vector_item_size(v->type));
+			break;
+		case POINTLESS_SET_VALUE:
+			if (!pointless_prefetch_visit(state->set, v->data.data_u32))
+				return POINTLESS_WALK_MOVE_UP;
+
+			pointless_prefetch_range(state, PC_HEAP_OFFSET(p, set_offsets, v->data.data_u32), sizeof(pointless_set_header_t));
+			break;
+		case POINTLESS_MAP_VALUE_VALUE:
+			if (!pointless_prefetch_visit(state->map, v->data.data_u32))
+				return POINTLESS_WALK_MOVE_UP;
+
+			pointless_prefetch_range(state, PC_HEAP_OFFSET(p, map_offsets, v->data.data_u32), sizeof(pointless_map_header_t));
+			break;
+	}
+
+	// children are only read once the current range has been requested
+	if (v->type == POINTLESS_VECTOR_VALUE || v->type == POINTLESS_VECTOR_VALUE_HASHABLE || v->type == POINTLESS_SET_VALUE || v->type == POINTLESS_MAP_VALUE_VALUE)
+		pointless_prefetch_flush(state);
+
+	return POINTLESS_WALK_VISIT_CHILDREN;
+}
+
+static void pointless_prefetch_state_destroy(pointless_prefetch_state_t* state)
+{
+	pointless_free(state->vector);
+	pointless_free(state->set);
+	pointless_free(state->map);
+	pointless_free(state);
+}
+
+static int32_t pointless_prefetch_run(pointless_prefetch_state_t* state, const char** error)
+{
+	pointless_walk_from(state->p, &state->v, pointless_prefetch_cb, state);
+	pointless_prefetch_flush(state);
+
+	if (state->error) {
+		*error = state->error;
+		return 0;
+	}
+
+	return 1;
+}
+
+static void* pointless_prefetch_thread(void* user)
+{
+	pointless_prefetch_state_t* state = (pointless_prefetch_state_t*)user;
+	const char* error = 0;
+
+	uint32_t* done = state->done;
+
+	pointless_prefetch_run(state, &error);
+	pointless_prefetch_state_destroy(state);
+
+	__sync_fetch_and_add(done, 1);
+
+	return 0;
+}
+
+static pointless_prefetch_threads_t* pointless_prefetch_threads(pointless_t* p, const char** error)
+{
+	pointless_prefetch_threads_t* threads = (pointless_prefetch_threads_t*)__atomic_load_n(&p->prefetch, __ATOMIC_ACQUIRE);
+
+	if (threads)
+		return threads;
+
+	threads = (pointless_prefetch_threads_t*)pointless_calloc(1, sizeof(pointless_prefetch_threads_t));
+
+	if (threads == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	if (pthread_mutex_init(&threads->lock, 0) != 0) {
+		pointless_free(threads);
+		*error = "pthread_mutex_init() failure";
+		return 0;
+	}
+
+	// callers on other threads may be doing the same, the first one wins
+	if (!__sync_bool_compare_and_swap(&p->prefetch, 0, threads)) {
+		pthread_mutex_destroy(&threads->lock);
+		pointless_free(threads);
+		threads = (pointless_prefetch_threads_t*)__atomic_load_n(&p->prefetch, __ATOMIC_ACQUIRE);
+	}
+
+	return threads;
+}
+
+// join and free finished background prefetches
+static void pointless_prefetch_reap(pointless_prefetch_threads_t* threads)
+{
+	pthread_mutex_lock(&threads->lock);
+
+	pointless_prefetch_thread_t** link = &threads->threads;
+
+	while (*link) {
+		pointless_prefetch_thread_t* thread = *link;
+
+		if (__sync_fetch_and_add(&thread->done, 0)) {
+			pthread_join(thread->thread, 0);
+			*link = thread->next;
+			pointless_free(thread);
+		} else {
+			link = &thread->next;
+		}
+	}
+
+	pthread_mutex_unlock(&threads->lock);
+}
+
+int32_t pointless_prefetch(pointless_t* p, pointless_value_t* v, uint32_t max_depth, uint32_t flags, const char** error)
+{
+	// nothing to prefetch for buffers
+	if (p->fd_ptr == 0)
+		return 1;
+
+	long page_size = sysconf(_SC_PAGESIZE);
+
+	if (page_size <= 0) {
+		*error = "sysconf(_SC_PAGESIZE) error";
+		return 0;
+	}
+
+	pointless_prefetch_threads_t* threads = pointless_prefetch_threads(p, error);
+
+	if (threads == 0)
+		return 0;
+
+	pointless_prefetch_reap(threads);
+
+	pointless_prefetch_state_t* state = (pointless_prefetch_state_t*)pointless_calloc(1, sizeof(pointless_prefetch_state_t));
+
+	if (state == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	state->p = p;
+	state->v = *v;
+	state->max_depth = max_depth;
+	state->stop = &threads->stop;
+	state->page_size = (uintptr_t)page_size;
+	state->vector = pointless_calloc(ICEIL(p->header->n_vector, 8), 1);
+	state->set = pointless_calloc(ICEIL(p->header->n_set, 8), 1);
+	state->map = pointless_calloc(ICEIL(p->header->n_map, 8), 1);
+
+	if (state->vector == 0 || state->set == 0 || state->map == 0) {
+		pointless_prefetch_state_destroy(state);
+		*error = "out of memory";
+		return 0;
+	}
+
+	if (!(flags & POINTLESS_PREFETCH_ASYNC)) {
+		int32_t retval = pointless_prefetch_run(state, error);
+		pointless_prefetch_state_destroy(state);
+		return retval;
+	}
+
+	pointless_prefetch_thread_t* thread = (pointless_prefetch_thread_t*)pointless_malloc(sizeof(pointless_prefetch_thread_t));
+
+	if (thread == 0) {
+		pointless_prefetch_state_destroy(state);
+		*error = "out of memory";
+		return 0;
+	}
+
+	thread->done = 0;
+	state->done = &thread->done;
+
+	if (pthread_create(&thread->thread, 0, pointless_prefetch_thread, state) != 0) {
+		pointless_free(thread);
+		pointless_prefetch_state_destroy(state);
+		*error = "pthread_create() failure";
+		return 0;
+	}
+
+	pthread_mutex_lock(&threads->lock);
+	thread->next = threads->threads;
+	threads->threads = thread;
+	pthread_mutex_unlock(&threads->lock);
+
+	return 1;
+}
+
+void pointless_prefetch_join(pointless_t* p)
+{
+	pointless_prefetch_threads_t* threads = (pointless_prefetch_threads_t*)p->prefetch;
+
+	if (threads == 0)
+		return;
+
+	__sync_fetch_and_add(&threads->stop, 1);
+
+	while (threads->threads) {
+		pointless_prefetch_thread_t* thread = threads->threads;
+		threads->threads = thread->next;
+
+		pthread_join(thread->thread, 0);
+		pointless_free(thread);
+	}
+
+	pthread_mutex_destroy(&threads->lock);
+	pointless_free(threads);
+	p->prefetch = 0;
+}
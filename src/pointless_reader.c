@@ -1,6 +1,6 @@
 #include <pointless/pointless_reader.h>
 
-static int pointless_init(pointless_t* p, void* buf, uint64_t buflen, int do_validate, const char** error)
+static int pointless_init(pointless_t* p, void* buf, uint64_t buflen, int validate_mode, uint32_t n_threads, const char** error)
 {
 	// our header
 	if (buflen < sizeof(pointless_header_t)) {
@@ -10,8 +10,8 @@ static int pointless_init(pointless_t* p, void* buf, uint64_t buflen, int do_val
 
 	p->header = (pointless_header_t*)buf;
 
-	// check for version
-	switch (p->header->version) {
+	// check for version, only the last one holds feature bits
+	switch (POINTLESS_FF_VERSION_NUMBER(p->header->version)) {
 		case POINTLESS_FF_VERSION_OFFSET_32_OLDHASH:
 			*error = "old-hash file version not supported";
 			return 0;
@@ -19,12 +19,25 @@ static int pointless_init(pointless_t* p, void* buf, uint64_t buflen, int do_val
 			*error = "32-bit offset files no longer supported";
 			break;
 		case POINTLESS_FF_VERSION_OFFSET_64_NEWHASH:
+		case POINTLESS_FF_VERSION_OFFSET_64_FEATURES:
 			break;
 		default:
 			*error = "file version not supported";
 			return 0;
 	}
 
+	if (POINTLESS_FF_VERSION_FEATURES(p->header->version) != 0 && POINTLESS_FF_VERSION_NUMBER(p->header->version) != POINTLESS_FF_VERSION_OFFSET_64_FEATURES) {
+		*error = "file version not supported";
+		return 0;
+	}
+
+	p->features = pointless_ff_version_features(p->header->version);
+
+	if ((p->features & ~POINTLESS_FF_FEATURE_ALL_) != 0) {
+		*error = "file format feature not supported";
+		return 0;
+	}
+
 	// right, we need some number of bytes for the offset vectors
 	uint64_t mandatory_size = sizeof(pointless_header_t);
 
@@ -50,17 +63,180 @@ static int pointless_init(pointless_t* p, void* buf, uint64_t buflen, int do_val
 	p->heap_len = (buflen - mandatory_size);
 	p->heap_ptr = (void*)(p->map_offsets_64 + p->header->n_map);
 
+	// the heap ends where the checksum trailer starts
+	p->checksum_trailer = 0;
+	p->heap_block_checksums = 0;
+
+	if ((p->features & POINTLESS_FF_FEATURE_CHECKSUM) && !pointless_checksum_trailer_init(p, buflen, error))
+		return 0;
+
+	// the stored hashes start the heap
+	p->string_unicode_hashes = 0;
+	p->vector_hashes = 0;
+
+	if (p->features & POINTLESS_FF_FEATURE_HASH_SLOTS) {
+		if (p->heap_len < ((uint64_t)p->header->n_string_unicode + (uint64_t)p->header->n_vector) * sizeof(uint32_t)) {
+			*error = "heap is too small to hold stored hashes";
+			return 0;
+		}
+
+		p->string_unicode_hashes = (uint32_t*)p->heap_ptr;
+		p->vector_hashes = p->string_unicode_hashes + p->header->n_string_unicode;
+	}
+
 	// let us validate the damn thing
 	pointless_validate_context_t context;
 	context.p = p;
+	context.n_threads = n_threads;
 
-	if (do_validate)
-		return pointless_validate(&context, error);
-	else
-		return 1;
+	switch (validate_mode) {
+		case POINTLESS_VALIDATE_FULL:
+			return pointless_validate(&context, error);
+		case POINTLESS_VALIDATE_LAZY:
+			return pointless_validate_lazy_init(&context, error);
+	}
+
+	return 1;
 }
 
-static int _pointless_open_f(pointless_t* p, const char* fname, int do_validate, const char** error)
+// transparent huge page size on x86-64 and arm64 with 4k pages
+#define POINTLESS_HUGEPAGE_SIZE (2 << 20)
+
+void pointless_open_options_init(pointless_open_options_t* options)
+{
+	options->validate_mode = POINTLESS_VALIDATE_FULL;
+	options->validate_threads = 1;
+	options->populate = 0;
+	options->advice = POINTLESS_ADVICE_NORMAL;
+	options->lock = 0;
+	options->hugepage_load = 0;
+}
+
+// copies [offset, offset + length) of the file into huge page aligned anonymous memory
+static int pointless_map_anonymous(pointless_t* p, int fd, uint64_t offset, uint64_t length, const char** error)
+{
+	uint64_t n_bytes = ICEIL(length, POINTLESS_HUGEPAGE_SIZE) * POINTLESS_HUGEPAGE_SIZE;
+	uint64_t n_reserve = n_bytes + POINTLESS_HUGEPAGE_SIZE;
+
+	char* reserve = (char*)mmap(0, n_reserve, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (reserve == MAP_FAILED) {
+		*error = "mmap error";
+		return 0;
+	}
+
+	// trim the reservation down to an aligned range
+	char* base = (char*)(((uintptr_t)reserve + POINTLESS_HUGEPAGE_SIZE - 1) & ~((uintptr_t)POINTLESS_HUGEPAGE_SIZE - 1));
+
+	if (base > reserve)
+		munmap(reserve, base - reserve);
+
+	if (base + n_bytes < reserve + n_reserve)
+		munmap(base + n_bytes, (reserve + n_reserve) - (base + n_bytes));
+
+	p->fd_ptr = base;
+	p->fd_len = n_bytes;
+
+#ifdef MADV_HUGEPAGE
+	// only a hint, transparent huge pages may be disabled
+	madvise(base, n_bytes, MADV_HUGEPAGE);
+#endif
+
+	uint64_t n_read = 0;
+
+	while (n_read < length) {
+		ssize_t n = pread(fd, base + n_read, (size_t)SIMPLE_MIN(length - n_read, (uint64_t)1 << 30), (off_t)(offset + n_read));
+
+		if (n < 0 && errno == EINTR)
+			continue;
+
+		if (n <= 0) {
+			*error = "pread error";
+			return 0;
+		}
+
+		n_read += (uint64_t)n;
+	}
+
+	if (mprotect(base, n_bytes, PROT_READ) != 0) {
+		*error = "mprotect error";
+		return 0;
+	}
+
+	return 1;
+}
+
+// maps [offset, offset + length) of the file into p->fd_ptr/fd_len according to the residency
+// options, and returns a pointer to the first byte of the range in data
+static int pointless_map(pointless_t* p, int fd, uint64_t offset, uint64_t length, pointless_open_options_t* options, void** data, const char** error)
+{
+	if (options->hugepage_load) {
+		if (!pointless_map_anonymous(p, fd, offset, length, error))
+			return 0;
+
+		*data = p->fd_ptr;
+	} else {
+		// mmap() offsets must be page aligned, so we map from the start of the page holding the first byte
+		long page_size = sysconf(_SC_PAGESIZE);
+
+		if (page_size <= 0) {
+			*error = "sysconf(_SC_PAGESIZE) error";
+			return 0;
+		}
+
+		uint64_t page_offset = offset % (uint64_t)page_size;
+		int flags = MAP_SHARED;
+
+#ifdef MAP_POPULATE
+		if (options->populate)
+			flags |= MAP_POPULATE;
+#endif
+
+		p->fd_len = page_offset + length;
+		p->fd_ptr = mmap(0, p->fd_len, PROT_READ, flags, fd, (off_t)(offset - page_offset));
+
+		if (p->fd_ptr == MAP_FAILED) {
+			p->fd_ptr = 0;
+			*error = "mmap error";
+			return 0;
+		}
+
+		*data = (char*)p->fd_ptr + page_offset;
+
+#ifndef MAP_POPULATE
+		if (options->populate && madvise(p->fd_ptr, p->fd_len, MADV_WILLNEED) != 0) {
+			*error = "madvise error";
+			return 0;
+		}
+#endif
+	}
+
+	int advice = MADV_NORMAL;
+
+	switch (options->advice) {
+		case POINTLESS_ADVICE_NORMAL:     advice = MADV_NORMAL;     break;
+		case POINTLESS_ADVICE_WILLNEED:   advice = MADV_WILLNEED;   break;
+		case POINTLESS_ADVICE_RANDOM:     advice = MADV_RANDOM;     break;
+		case POINTLESS_ADVICE_SEQUENTIAL: advice = MADV_SEQUENTIAL; break;
+		default:
+			*error = "unknown madvise() advice";
+			return 0;
+	}
+
+	if (advice != MADV_NORMAL && madvise(p->fd_ptr, p->fd_len, advice) != 0) {
+		*error = "madvise error";
+		return 0;
+	}
+
+	if (options->lock && mlock(p->fd_ptr, p->fd_len) != 0) {
+		*error = (errno == ENOMEM || errno == EPERM) ? "mlock error, RLIMIT_MEMLOCK exceeded" : "mlock error";
+		return 0;
+	}
+
+	return 1;
+}
+
+static int _pointless_open_f(pointless_t* p, const char* fname, pointless_open_options_t* options, const char** error)
 {
 	p->fd = 0;
 	p->fd_len = 0;
@@ -68,6 +244,10 @@ static int _pointless_open_f(pointless_t* p, const char* fname, int do_validate,
 
 	p->buf = 0;
 	p->buflen = 0;
+	p->buf_is_borrowed = 0;
+
+	p->lazy = 0;
+	p->prefetch = 0;
 
 	p->fd = fopen(fname, "rb");
 
@@ -110,52 +290,188 @@ static int _pointless_open_f(pointless_t* p, const char* fname, int do_validate,
 		return 0;
 	}
 
-	p->fd_len = s.st_size;
-	p->fd_ptr = mmap(0, p->fd_len, PROT_READ, MAP_SHARED, fileno(p->fd), 0);
+	void* data = 0;
 
-	if (p->fd_ptr == MAP_FAILED) {
-		*error = "mmap error";
+	if (!pointless_map(p, fileno(p->fd), 0, (uint64_t)s.st_size, options, &data, error)) {
 		pointless_close(p);
 		return 0;
 	}
 
-	if (!pointless_init(p, p->fd_ptr, p->fd_len, do_validate, error)) {
+	// certificates are tied to the file, so they are checked here rather than in pointless_init()
+	int validate_mode = options->validate_mode;
+
+	if (!pointless_init(p, data, (uint64_t)s.st_size, (validate_mode == POINTLESS_VALIDATE_CERTIFIED) ? POINTLESS_VALIDATE_SKIP : validate_mode, options->validate_threads, error)) {
 		pointless_close(p);
 		return 0;
 	}
 
+	if (validate_mode == POINTLESS_VALIDATE_CERTIFIED) {
+		pointless_validate_context_t context;
+		context.p = p;
+		context.n_threads = options->validate_threads;
+
+		if (!pointless_validate_certified(&context, fname, error)) {
+			pointless_close(p);
+			return 0;
+		}
+	}
+
 	return 1;
 }
 
 int pointless_open_f(pointless_t* p, const char* fname, const char** error)
 {
-	return _pointless_open_f(p, fname, 1, error);
+	pointless_open_options_t options;
+	pointless_open_options_init(&options);
+	options.validate_mode = POINTLESS_VALIDATE_FULL;
+	options.validate_threads = 1;
+
+	return _pointless_open_f(p, fname, &options, error);
 }
 
 int pointless_open_f_skip_validate(pointless_t* p, const char* fname, const char** error)
 {
-	return _pointless_open_f(p, fname, 0, error);
+	pointless_open_options_t options;
+	pointless_open_options_init(&options);
+	options.validate_mode = POINTLESS_VALIDATE_SKIP;
+	options.validate_threads = 1;
+
+	return _pointless_open_f(p, fname, &options, error);
+}
+
+int pointless_open_f_lazy_validate(pointless_t* p, const char* fname, const char** error)
+{
+	pointless_open_options_t options;
+	pointless_open_options_init(&options);
+	options.validate_mode = POINTLESS_VALIDATE_LAZY;
+	options.validate_threads = 1;
+
+	return _pointless_open_f(p, fname, &options, error);
+}
+
+int pointless_open_f_parallel_validate(pointless_t* p, const char* fname, uint32_t n_threads, const char** error)
+{
+	pointless_open_options_t options;
+	pointless_open_options_init(&options);
+	options.validate_mode = POINTLESS_VALIDATE_FULL;
+	options.validate_threads = n_threads;
+
+	return _pointless_open_f(p, fname, &options, error);
+}
+
+int pointless_open_f_options(pointless_t* p, const char* fname, pointless_open_options_t* options, const char** error)
+{
+	return _pointless_open_f(p, fname, options, error);
+}
+
+int pointless_open_f_certified_validate(pointless_t* p, const char* fname, uint32_t n_threads, const char** error)
+{
+	pointless_open_options_t options;
+	pointless_open_options_init(&options);
+	options.validate_mode = POINTLESS_VALIDATE_CERTIFIED;
+	options.validate_threads = n_threads;
+
+	return _pointless_open_f(p, fname, &options, error);
+}
+
+int pointless_open_fd_options(pointless_t* p, int fd, uint64_t offset, uint64_t length, pointless_open_options_t* options, const char** error)
+{
+	p->fd = 0;
+	p->fd_len = 0;
+	p->fd_ptr = 0;
+
+	p->buf = 0;
+	p->buflen = 0;
+	p->buf_is_borrowed = 0;
+
+	p->lazy = 0;
+	p->prefetch = 0;
+
+	if (options->validate_mode == POINTLESS_VALIDATE_CERTIFIED) {
+		*error = "certified validation requires a file";
+		return 0;
+	}
+
+	// the header, and therefore the offset vectors, must be 8-byte aligned in memory
+	if (offset % 8 != 0) {
+		*error = "offset must be 8-byte aligned";
+		return 0;
+	}
+
+	struct stat s;
+
+	if (fstat(fd, &s) != 0) {
+		*error = "fstat error";
+		return 0;
+	}
+
+	if (offset > (uint64_t)s.st_size) {
+		*error = "offset is past the end of the file";
+		return 0;
+	}
+
+	if (length == 0)
+		length = (uint64_t)s.st_size - offset;
+
+	if (length == 0 || length > (uint64_t)s.st_size - offset) {
+		*error = "length is past the end of the file";
+		return 0;
+	}
+
+	void* data = 0;
+
+	if (!pointless_map(p, fd, offset, length, options, &data, error)) {
+		pointless_close(p);
+		return 0;
+	}
+
+	if (!pointless_init(p, data, length, options->validate_mode, options->validate_threads, error)) {
+		pointless_close(p);
+		return 0;
+	}
+
+	return 1;
+}
+
+int pointless_open_fd(pointless_t* p, int fd, uint64_t offset, uint64_t length, int validate_mode, uint32_t n_threads, const char** error)
+{
+	pointless_open_options_t options;
+	pointless_open_options_init(&options);
+	options.validate_mode = validate_mode;
+	options.validate_threads = n_threads;
+
+	return pointless_open_fd_options(p, fd, offset, length, &options, error);
 }
 
 void pointless_close(pointless_t* p)
 {
+	// background threads may still be reading the mapping
+	pointless_prefetch_join(p);
+
 	if (p->fd_ptr)
 		munmap(p->fd_ptr, p->fd_len);
 
 	if (p->fd)
 		fclose(p->fd);
 
-	pointless_free(p->buf);
+	if (!p->buf_is_borrowed)
+		pointless_free(p->buf);
+
+	pointless_validate_lazy_destroy(p);
 }
 
-static int _pointless_open_b(pointless_t* p, const void* buffer, size_t n_buffer, int do_validate, const char** error)
+static int _pointless_open_b(pointless_t* p, const void* buffer, size_t n_buffer, int validate_mode, uint32_t n_threads, const char** error)
 {
 	p->fd = 0;
 	p->fd_len = 0;
 	p->fd_ptr = 0;
 
+	p->lazy = 0;
+	p->prefetch = 0;
+
 	p->buf = pointless_malloc(n_buffer);
 	p->buflen = n_buffer;
+	p->buf_is_borrowed = 0;
 
 	if (p->buf == 0) {
 		*error = "out of memory";
@@ -164,7 +480,39 @@ static int _pointless_open_b(pointless_t* p, const void* buffer, size_t n_buffer
 
 	memcpy(p->buf, buffer, n_buffer);
 
-	if (!pointless_init(p, p->buf, p->buflen, do_validate, error)) {
+	if (!pointless_init(p, p->buf, p->buflen, validate_mode, n_threads, error)) {
+		pointless_close(p);
+		return 0;
+	}
+
+	return 1;
+}
+
+int pointless_open_b_borrow(pointless_t* p, const void* buffer, size_t n_buffer, int validate_mode, uint32_t n_threads, const char** error)
+{
+	p->fd = 0;
+	p->fd_len = 0;
+	p->fd_ptr = 0;
+
+	p->lazy = 0;
+	p->prefetch = 0;
+
+	p->buf = (void*)buffer;
+	p->buflen = n_buffer;
+	p->buf_is_borrowed = 1;
+
+	// offset vectors are read as 64-bit integers
+	if (((uintptr_t)buffer) % 8 != 0) {
+		*error = "borrowed buffer must be 8-byte aligned";
+		return 0;
+	}
+
+	if (validate_mode == POINTLESS_VALIDATE_CERTIFIED) {
+		*error = "certified validation requires a file";
+		return 0;
+	}
+
+	if (!pointless_init(p, p->buf, p->buflen, validate_mode, n_threads, error)) {
 		pointless_close(p);
 		return 0;
 	}
@@ -174,12 +522,22 @@ static int _pointless_open_b(pointless_t* p, const void* buffer, size_t n_buffer
 
 int pointless_open_b(pointless_t* p, const void* buffer, size_t n_buffer, const char** error)
 {
-	return _pointless_open_b(p, buffer, n_buffer, 1, error);
+	return _pointless_open_b(p, buffer, n_buffer, POINTLESS_VALIDATE_FULL, 1, error);
 }
 
 int pointless_open_b_skip_validate(pointless_t* p, const void* buffer, size_t n_buffer, const char** error)
 {
-	return _pointless_open_b(p, buffer, n_buffer, 0, error);
+	return _pointless_open_b(p, buffer, n_buffer, POINTLESS_VALIDATE_SKIP, 1, error);
+}
+
+int pointless_open_b_lazy_validate(pointless_t* p, const void* buffer, size_t n_buffer, const char** error)
+{
+	return _pointless_open_b(p, buffer, n_buffer, POINTLESS_VALIDATE_LAZY, 1, error);
+}
+
+int pointless_open_b_parallel_validate(pointless_t* p, const void* buffer, size_t n_buffer, uint32_t n_threads, const char** error)
+{
+	return _pointless_open_b(p, buffer, n_buffer, POINTLESS_VALIDATE_FULL, n_threads, error);
 }
 
 pointless_value_t* pointless_root(pointless_t* p)
@@ -207,6 +565,22 @@ uint32_t* pointless_reader_unicode_value_ucs4(pointless_t* p, pointless_value_t*
 	return pointless_reader_unicode_value(p, v);
 }
 
+uint32_t pointless_reader_unicode_utf8_len(pointless_t* p, pointless_value_t* v)
+{
+	assert(v->type == POINTLESS_UNICODE_UTF8);
+	assert(v->data.data_u32 < p->header->n_string_unicode);
+	uint32_t* u_len = (uint32_t*)PC_HEAP_OFFSET(p, string_unicode_offsets, v->data.data_u32);
+	return *u_len;
+}
+
+uint8_t* pointless_reader_unicode_value_utf8(pointless_t* p, pointless_value_t* v)
+{
+	assert(v->type == POINTLESS_UNICODE_UTF8);
+	assert(v->data.data_u32 < p->header->n_string_unicode);
+	uint32_t* u_len = (uint32_t*)PC_HEAP_OFFSET(p, string_unicode_offsets, v->data.data_u32);
+	return (uint8_t*)(u_len + 1);
+}
+
 uint32_t pointless_reader_string_len(pointless_t* p, pointless_value_t* v)
 {
 	assert(v->data.data_u32 < p->header->n_string_unicode);
@@ -388,25 +762,39 @@ uint32_t pointless_reader_set_n_items(pointless_t* p, pointless_value_t* s)
 	return header->n_items;
 }
 
-uint32_t pointless_reader_set_n_buckets(pointless_t* p, pointless_value_t* s)
+void pointless_set_hash_table(pointless_t* p, pointless_value_t* s, pointless_hash_table_t* t)
 {
 	assert(s->type == POINTLESS_SET_VALUE);
 	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(p, set_offsets, s->data.data_u32);
-	assert(pointless_reader_vector_n_items(p, &header->key_vector) == pointless_reader_vector_n_items(p, &header->hash_vector));
 	assert((size_t)header % 4 == 0);
-	return pointless_reader_vector_n_items(p, &header->key_vector);
+	assert(header->hash_vector.type == POINTLESS_VECTOR_U32);
+
+	uint32_t* hashes = pointless_reader_vector_u32(p, &header->hash_vector);
+	uint32_t n_hashes = pointless_reader_vector_n_items(p, &header->hash_vector);
+
+	if (header->layout != POINTLESS_HASH_TABLE_LAYOUT_SPLIT) {
+		pointless_hash_table_init(t, header->layout, 0, hashes, n_hashes, 0, 0);
+	} else {
+		assert(header->key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
+		assert(pointless_reader_vector_n_items(p, &header->key_vector) == n_hashes);
+		pointless_hash_table_init(t, header->layout, 0, hashes, n_hashes, pointless_reader_vector_value(p, &header->key_vector), 0);
+	}
+}
+
+uint32_t pointless_reader_set_n_buckets(pointless_t* p, pointless_value_t* s)
+{
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
+	return t.n_buckets;
 }
 
 uint32_t pointless_reader_set_iter(pointless_t* p, pointless_value_t* s, pointless_value_t** k, uint32_t* iter_state)
 {
-	assert(s->type == POINTLESS_SET_VALUE);
-	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(p, set_offsets, s->data.data_u32);
-	assert((size_t)header % 4 == 0);
-	assert(header->key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->key_vector);
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
 
-	while (*iter_state < n_buckets) {
-		*k = &pointless_reader_vector_value(p, &header->key_vector)[*iter_state];
+	while (*iter_state < t.n_buckets) {
+		*k = PHT_KEY(&t, *iter_state);
 		*iter_state += 1;
 
 		if ((*k)->type != POINTLESS_EMPTY_SLOT)
@@ -424,49 +812,35 @@ void pointless_reader_set_lookup(pointless_t* p, pointless_value_t* s, pointless
 		return;
 	}
 
-	// this must be a set
-	assert(s->type == POINTLESS_SET_VALUE);
-	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(p, set_offsets, s->data.data_u32);
-	assert((size_t)header % 4 == 0);
-
 	// value hash
 	uint32_t hash = pointless_hash_reader_32(p, k);
 
-	// other info
-	uint32_t* hash_vector = pointless_reader_vector_u32(p, &header->hash_vector);
-	pointless_value_t* key_vector = pointless_reader_vector_value(p, &header->key_vector);
-
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->key_vector);
+	// buckets
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
 
 	// do the probe
-	uint32_t probe = pointless_hash_table_probe(p, hash, k, n_buckets, hash_vector, key_vector, error);
+	uint32_t probe = pointless_hash_table_probe(p, hash, k, &t, error);
 
 	if (probe == POINTLESS_HASH_TABLE_PROBE_ERROR || probe == POINTLESS_HASH_TABLE_PROBE_MISS)
 		*kk = 0;
 	else
-		*kk = &key_vector[probe];
+		*kk = PHT_KEY(&t, probe);
 }
 
 void pointless_reader_set_lookup_ext(pointless_t* p, pointless_value_t* s, uint32_t hash, pointless_eq_cb cb, void* user, pointless_value_t** kk, const char** error)
 {
-	// this must be a set
-	assert(s->type == POINTLESS_SET_VALUE);
-	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(p, set_offsets, s->data.data_u32);
-	assert((size_t)header % 4 == 0);
-
-	// other info
-	uint32_t* hash_vector = pointless_reader_vector_u32(p, &header->hash_vector);
-	pointless_value_t* key_vector = pointless_reader_vector_value(p, &header->key_vector);
-
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->key_vector);
+	// buckets
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
 
 	// do the probe
-	uint32_t probe = pointless_hash_table_probe_ext(p, hash, cb, user, n_buckets, hash_vector, key_vector, error);
+	uint32_t probe = pointless_hash_table_probe_ext(p, hash, cb, user, &t, error);
 
 	if (probe == POINTLESS_HASH_TABLE_PROBE_ERROR || probe == POINTLESS_HASH_TABLE_PROBE_MISS)
 		*kk = 0;
 	else
-		*kk = &key_vector[probe];
+		*kk = PHT_KEY(&t, probe);
 }
 
 pointless_value_t* pointless_set_hash_vector(pointless_t* p, pointless_value_t* s)
@@ -489,6 +863,35 @@ pointless_value_t* pointless_set_key_vector(pointless_t* p, pointless_value_t* s
 	return &header->key_vector;
 }
 
+uint32_t pointless_set_n_children(pointless_t* p, pointless_value_t* s)
+{
+	assert(s->type == POINTLESS_SET_VALUE);
+	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(p, set_offsets, s->data.data_u32);
+
+	if (header->layout == POINTLESS_HASH_TABLE_LAYOUT_SPLIT)
+		return 2;
+
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
+	return 1 + t.n_buckets;
+}
+
+pointless_value_t* pointless_set_child_at(pointless_t* p, pointless_value_t* s, uint32_t i)
+{
+	assert(s->type == POINTLESS_SET_VALUE);
+	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(p, set_offsets, s->data.data_u32);
+
+	if (i == 0)
+		return &header->hash_vector;
+
+	if (header->layout == POINTLESS_HASH_TABLE_LAYOUT_SPLIT)
+		return &header->key_vector;
+
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
+	return PHT_KEY(&t, i - 1);
+}
+
 uint32_t pointless_reader_map_n_items(pointless_t* p, pointless_value_t* m)
 {
 	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
@@ -497,29 +900,42 @@ uint32_t pointless_reader_map_n_items(pointless_t* p, pointless_value_t* m)
 	return header->n_items;
 }
 
-uint32_t pointless_reader_map_n_buckets(pointless_t* p, pointless_value_t* m)
+void pointless_map_hash_table(pointless_t* p, pointless_value_t* m, pointless_hash_table_t* t)
 {
 	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
 	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
-	assert(pointless_reader_vector_n_items(p, &header->hash_vector) == pointless_reader_vector_n_items(p, &header->key_vector));
-	assert(pointless_reader_vector_n_items(p, &header->key_vector) == pointless_reader_vector_n_items(p, &header->value_vector));
 	assert((size_t)header % 4 == 0);
-	return pointless_reader_vector_n_items(p, &header->key_vector);
+	assert(header->hash_vector.type == POINTLESS_VECTOR_U32);
+
+	uint32_t* hashes = pointless_reader_vector_u32(p, &header->hash_vector);
+	uint32_t n_hashes = pointless_reader_vector_n_items(p, &header->hash_vector);
+
+	if (header->layout != POINTLESS_HASH_TABLE_LAYOUT_SPLIT) {
+		pointless_hash_table_init(t, header->layout, 1, hashes, n_hashes, 0, 0);
+	} else {
+		assert(header->key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
+		assert(header->value_vector.type == POINTLESS_VECTOR_VALUE || header->value_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
+		assert(pointless_reader_vector_n_items(p, &header->key_vector) == n_hashes);
+		assert(pointless_reader_vector_n_items(p, &header->value_vector) == n_hashes);
+		pointless_hash_table_init(t, header->layout, 1, hashes, n_hashes, pointless_reader_vector_value(p, &header->key_vector), pointless_reader_vector_value(p, &header->value_vector));
+	}
 }
 
+uint32_t pointless_reader_map_n_buckets(pointless_t* p, pointless_value_t* m)
+{
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
+	return t.n_buckets;
+}
 
 uint32_t pointless_reader_map_iter(pointless_t* p, pointless_value_t* m, pointless_value_t** k, pointless_value_t** v, uint32_t* iter_state)
 {
-	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
-	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
-	assert(header->key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
-	assert(header->value_vector.type == POINTLESS_VECTOR_VALUE || header->value_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->key_vector);
-	assert((size_t)header % 4 == 0);
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
 
-	while (*iter_state < n_buckets) {
-		*k = &pointless_reader_vector_value(p, &header->key_vector)[*iter_state];
-		*v = &pointless_reader_vector_value(p, &header->value_vector)[*iter_state];
+	while (*iter_state < t.n_buckets) {
+		*k = PHT_KEY(&t, *iter_state);
+		*v = PHT_VALUE(&t, *iter_state);
 		*iter_state += 1;
 
 		if ((*k)->type != POINTLESS_EMPTY_SLOT)
@@ -531,36 +947,23 @@ uint32_t pointless_reader_map_iter(pointless_t* p, pointless_value_t* m, pointle
 
 void pointless_reader_map_iter_hash_init(pointless_t* p, pointless_value_t* m, uint32_t hash, pointless_hash_iter_state_t* iter_state)
 {
-	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
-	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
-	assert(header->hash_vector.type == POINTLESS_VECTOR_U32);
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->hash_vector);
-	assert((size_t)header % 4 == 0);
-	pointless_hash_table_probe_hash_init(p, hash, n_buckets, iter_state);
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
+	pointless_hash_table_probe_hash_init(p, hash, &t, iter_state);
 }
 
 uint32_t pointless_reader_map_iter_hash(pointless_t* p, pointless_value_t* m, uint32_t hash, pointless_value_t** kk, pointless_value_t** vv, pointless_hash_iter_state_t* iter_state)
 {
-	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
-	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
-	assert(header->hash_vector.type == POINTLESS_VECTOR_U32);
-	assert(header->key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
-	assert(header->value_vector.type == POINTLESS_VECTOR_VALUE || header->value_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
-
-	assert((size_t)header % 4 == 0);
-
-	// get vector pointers
-	uint32_t* hash_vector = pointless_reader_vector_u32(p, &header->hash_vector);
-	pointless_value_t* key_vector = pointless_reader_vector_value(p, &header->key_vector);
-	pointless_value_t* value_vector = pointless_reader_vector_value(p, &header->value_vector);
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
 
 	// probe until we hit an empty bucket, or a matching hash(again)
 	uint32_t bucket_out = 0;
 
-	while (pointless_hash_table_probe_hash(p, hash_vector, key_vector, iter_state, &bucket_out)) {
-		if (hash_vector[bucket_out] == hash) {
-			*kk = &key_vector[bucket_out];
-			*vv = &value_vector[bucket_out];
+	while (pointless_hash_table_probe_hash(p, &t, iter_state, &bucket_out)) {
+		if (PHT_HASH(&t, bucket_out) == hash) {
+			*kk = PHT_KEY(&t, bucket_out);
+			*vv = PHT_VALUE(&t, bucket_out);
 			return 1;
 		}
 	}
@@ -570,33 +973,22 @@ uint32_t pointless_reader_map_iter_hash(pointless_t* p, pointless_value_t* m, ui
 
 void pointless_reader_set_iter_hash_init(pointless_t* p, pointless_value_t* s, uint32_t hash, pointless_hash_iter_state_t* iter_state)
 {
-	assert(s->type == POINTLESS_SET_VALUE);
-	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(p, set_offsets, s->data.data_u32);
-	assert(header->hash_vector.type == POINTLESS_VECTOR_U32);
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->hash_vector);
-	assert((size_t)header % 4 == 0);
-	pointless_hash_table_probe_hash_init(p, hash, n_buckets, iter_state);
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
+	pointless_hash_table_probe_hash_init(p, hash, &t, iter_state);
 }
 
 uint32_t pointless_reader_set_iter_hash(pointless_t* p, pointless_value_t* s, uint32_t hash, pointless_value_t** kk, pointless_hash_iter_state_t* iter_state)
 {
-	assert(s->type == POINTLESS_SET_VALUE);
-	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET	(p, set_offsets, s->data.data_u32);
-	assert(header->hash_vector.type == POINTLESS_VECTOR_U32);
-	assert(header->key_vector.type == POINTLESS_VECTOR_VALUE_HASHABLE);
-
-	assert((size_t)header % 4 == 0);
-
-	// get vector pointers
-	uint32_t* hash_vector = pointless_reader_vector_u32(p, &header->hash_vector);
-	pointless_value_t* key_vector = pointless_reader_vector_value(p, &header->key_vector);
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
 
 	// probe until we hit an empty bucket, or a matching hash(again)
 	uint32_t bucket_out = 0;
 
-	while (pointless_hash_table_probe_hash(p, hash_vector, key_vector, iter_state, &bucket_out)) {
-		if (hash_vector[bucket_out] == hash) {
-			*kk = &key_vector[bucket_out];
+	while (pointless_hash_table_probe_hash(p, &t, iter_state, &bucket_out)) {
+		if (PHT_HASH(&t, bucket_out) == hash) {
+			*kk = PHT_KEY(&t, bucket_out);
 			return 1;
 		}
 	}
@@ -612,56 +1004,106 @@ void pointless_reader_map_lookup(pointless_t* p, pointless_value_t* m, pointless
 		return;
 	}
 
-	// this must be a map
-	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
-	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
-	assert((size_t)header % 4 == 0);
-
 	// value hash
 	uint32_t hash = pointless_hash_reader_32(p, k);
 
-	// other info
-	uint32_t* hash_vector = pointless_reader_vector_u32(p, &header->hash_vector);
-	pointless_value_t* key_vector = pointless_reader_vector_value(p, &header->key_vector);
-	pointless_value_t* value_vector = pointless_reader_vector_value(p, &header->value_vector);
-
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->key_vector);
+	// buckets
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
 
 	// do the probe
-	uint32_t probe = pointless_hash_table_probe(p, hash, k, n_buckets, hash_vector, key_vector, error);
+	uint32_t probe = pointless_hash_table_probe(p, hash, k, &t, error);
 
 	if (probe == POINTLESS_HASH_TABLE_PROBE_ERROR || probe == POINTLESS_HASH_TABLE_PROBE_MISS) {
 		*kk = 0;
 		*vv = 0;
 	} else {
-		*kk = &key_vector[probe];
-		*vv = &value_vector[probe];
+		*kk = PHT_KEY(&t, probe);
+		*vv = PHT_VALUE(&t, probe);
 	}
 }
 
-void pointless_reader_map_lookup_ext(pointless_t* p, pointless_value_t* m, uint32_t hash, pointless_eq_cb cb, void* user, pointless_value_t** kk, pointless_value_t** vv, const char** error)
+// batches are hashed and probed in chunks of this size, so that no allocations are needed
+#define POINTLESS_LOOKUP_BATCH_CHUNK 256
+
+static void pointless_reader_lookup_batch(pointless_t* p, pointless_hash_table_t* t, uint32_t n, pointless_value_t* keys, uint32_t* hashes, pointless_eq_cb cb, void** users, pointless_value_t** kk, pointless_value_t** vv, const char** error)
 {
-	// this must be a map
-	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
-	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
-	assert((size_t)header % 4 == 0);
+	uint32_t chunk_hashes[POINTLESS_LOOKUP_BATCH_CHUNK];
+	uint32_t chunk_buckets[POINTLESS_LOOKUP_BATCH_CHUNK];
+	uint32_t i, j, n_chunk;
+
+	for (i = 0; i < n; i += n_chunk) {
+		n_chunk = SIMPLE_MIN(n - i, POINTLESS_LOOKUP_BATCH_CHUNK);
+
+		// hash all keys of the chunk first
+		if (hashes == 0) {
+			for (j = 0; j < n_chunk; j++) {
+				if (!pointless_is_hashable(keys[i + j].type)) {
+					*error = "value is not hashable";
+					return;
+				}
+
+				chunk_hashes[j] = pointless_hash_reader_32(p, &keys[i + j]);
+			}
+		}
+
+		if (!pointless_hash_table_probe_batch(p, n_chunk, hashes ? hashes + i : chunk_hashes, keys ? keys + i : 0, cb, users ? users + i : 0, t, chunk_buckets, error))
+			return;
+
+		for (j = 0; j < n_chunk; j++) {
+			uint32_t bucket = chunk_buckets[j];
+
+			kk[i + j] = (bucket == POINTLESS_HASH_TABLE_PROBE_MISS) ? 0 : PHT_KEY(t, bucket);
+
+			if (vv)
+				vv[i + j] = (bucket == POINTLESS_HASH_TABLE_PROBE_MISS) ? 0 : PHT_VALUE(t, bucket);
+		}
+	}
+}
 
-	// other info
-	uint32_t* hash_vector = pointless_reader_vector_u32(p, &header->hash_vector);
-	pointless_value_t* key_vector = pointless_reader_vector_value(p, &header->key_vector);
-	pointless_value_t* value_vector = pointless_reader_vector_value(p, &header->value_vector);
+void pointless_reader_set_lookup_batch(pointless_t* p, pointless_value_t* s, pointless_value_t* keys, uint32_t n, pointless_value_t** kk, const char** error)
+{
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
+	pointless_reader_lookup_batch(p, &t, n, keys, 0, 0, 0, kk, 0, error);
+}
+
+void pointless_reader_set_lookup_batch_ext(pointless_t* p, pointless_value_t* s, uint32_t* hashes, pointless_eq_cb cb, void** users, uint32_t n, pointless_value_t** kk, const char** error)
+{
+	pointless_hash_table_t t;
+	pointless_set_hash_table(p, s, &t);
+	pointless_reader_lookup_batch(p, &t, n, 0, hashes, cb, users, kk, 0, error);
+}
 
-	uint32_t n_buckets = pointless_reader_vector_n_items(p, &header->key_vector);
+void pointless_reader_map_lookup_batch(pointless_t* p, pointless_value_t* m, pointless_value_t* keys, uint32_t n, pointless_value_t** kk, pointless_value_t** vv, const char** error)
+{
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
+	pointless_reader_lookup_batch(p, &t, n, keys, 0, 0, 0, kk, vv, error);
+}
+
+void pointless_reader_map_lookup_batch_ext(pointless_t* p, pointless_value_t* m, uint32_t* hashes, pointless_eq_cb cb, void** users, uint32_t n, pointless_value_t** kk, pointless_value_t** vv, const char** error)
+{
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
+	pointless_reader_lookup_batch(p, &t, n, 0, hashes, cb, users, kk, vv, error);
+}
+
+void pointless_reader_map_lookup_ext(pointless_t* p, pointless_value_t* m, uint32_t hash, pointless_eq_cb cb, void* user, pointless_value_t** kk, pointless_value_t** vv, const char** error)
+{
+	// buckets
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
 
 	// do the probe
-	uint32_t probe = pointless_hash_table_probe_ext(p, hash, cb, user, n_buckets, hash_vector, key_vector, error);
+	uint32_t probe = pointless_hash_table_probe_ext(p, hash, cb, user, &t, error);
 
 	if (probe == POINTLESS_HASH_TABLE_PROBE_ERROR || probe == POINTLESS_HASH_TABLE_PROBE_MISS) {
 		*kk = 0;
 		*vv = 0;
 	} else {
-		*kk = &key_vector[probe];
-		*vv = &value_vector[probe];
+		*kk = PHT_KEY(&t, probe);
+		*vv = PHT_VALUE(&t, probe);
 	}
 }
 
@@ -695,6 +1137,35 @@ pointless_value_t* pointless_map_value_vector(pointless_t* p, pointless_value_t*
 	return &header->value_vector;
 }
 
+uint32_t pointless_map_n_children(pointless_t* p, pointless_value_t* m)
+{
+	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
+	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
+
+	if (header->layout == POINTLESS_HASH_TABLE_LAYOUT_SPLIT)
+		return 3;
+
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
+	return 1 + 2 * t.n_buckets;
+}
+
+pointless_value_t* pointless_map_child_at(pointless_t* p, pointless_value_t* m, uint32_t i)
+{
+	assert(m->type == POINTLESS_MAP_VALUE_VALUE);
+	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(p, map_offsets, m->data.data_u32);
+
+	if (i == 0)
+		return &header->hash_vector;
+
+	if (header->layout == POINTLESS_HASH_TABLE_LAYOUT_SPLIT)
+		return (i == 1) ? &header->key_vector : &header->value_vector;
+
+	pointless_hash_table_t t;
+	pointless_map_hash_table(p, m, &t);
+	return ((i - 1) % 2 == 0) ? PHT_KEY(&t, (i - 1) / 2) : PHT_VALUE(&t, (i - 1) / 2);
+}
+
 // number of containers
 uint32_t pointless_n_containers(pointless_t* p)
 {
@@ -18,6 +18,9 @@ static int check_string(pointless_t* p, pointless_value_t* v, void* user)
 	} else if (v->type == POINTLESS_STRING_) {
 		uint8_t* s = pointless_reader_string_value_ascii(p, v);
 		return (pointless_cmp_string_8_8(s, key_s) == 0);
+	} else if (v->type == POINTLESS_UNICODE_UTF8) {
+		uint8_t* s = pointless_reader_unicode_value_utf8(p, v);
+		return (pointless_cmp_string_utf8_8(s, key_s) == 0);
 	}
 
 	return 0;
@@ -33,6 +36,9 @@ static int check_string_n(pointless_t* p, pointless_value_t* v, void* user)
 	} else if (v->type == POINTLESS_STRING_) {
 		uint8_t* s = pointless_reader_string_value_ascii(p, v);
 		return (pointless_cmp_string_8_8_n(s, key->s, key->n) == 0);
+	} else if (v->type == POINTLESS_UNICODE_UTF8) {
+		uint8_t* s = pointless_reader_unicode_value_utf8(p, v);
+		return (pointless_cmp_string_utf8_8_n(s, key->s, key->n) == 0);
 	}
 
 	return 0;
@@ -48,6 +54,9 @@ static int check_unicode(pointless_t* p, pointless_value_t* v, void* user)
 	} else if (v->type == POINTLESS_STRING_) {
 		uint8_t* s = pointless_reader_string_value_ascii(p, v);
 		return (pointless_cmp_string_8_32(s, key_s) == 0);
+	} else if (v->type == POINTLESS_UNICODE_UTF8) {
+		uint8_t* s = pointless_reader_unicode_value_utf8(p, v);
+		return (pointless_cmp_string_utf8_32(s, key_s) == 0);
 	}
 
 	return 0;
@@ -144,13 +153,13 @@ static int pointless_get_set_(pointless_t* p, pointless_value_t* set, uint32_t h
 
 int pointless_get_mapping_string_to_u32(pointless_t* p, pointless_value_t* map, char* key, uint32_t* value)
 {
-	uint32_t hash = pointless_hash_string_v1_32((uint8_t*)key);
+	uint32_t hash = pointless_hash_string_32(p->features, (uint8_t*)key, strlen(key));
 	return pointless_get_map_(p, map, hash, check_string, (void*)key, check_and_get_u32, 0, (void*)value);
 }
 
 int pointless_get_mapping_string_to_i64(pointless_t* p, pointless_value_t* map, char* key, int64_t* value)
 {
-	uint32_t hash = pointless_hash_string_v1_32((uint8_t*)key);
+	uint32_t hash = pointless_hash_string_32(p->features, (uint8_t*)key, strlen(key));
 	return pointless_get_map_(p, map, hash, check_string, (void*)key, check_and_get_i64, 0, (void*)value);
 }
 
@@ -273,13 +282,13 @@ int pointless_get_mapping_string_to_vector_value(pointless_t* p, pointless_value
 
 int pointless_get_mapping_string_to_value(pointless_t* p, pointless_value_t* map, char* key, pointless_value_t* value)
 {
-	uint32_t hash = pointless_hash_string_v1_32((uint8_t*)key);
+	uint32_t hash = pointless_hash_string_32(p->features, (uint8_t*)key, strlen(key));
 	return pointless_get_map_(p, map, hash, check_string, (void*)key, get_value, 0, (void*)value);
 }
 
 int pointless_get_mapping_string_n_to_value(pointless_t* p, pointless_value_t* map, char* key, size_t n, pointless_value_t* value)
 {
-	uint32_t hash = pointless_hash_string_v1_32_((uint8_t*)key, n);
+	uint32_t hash = pointless_hash_string_32(p->features, (uint8_t*)key, n);
 
 	check_string_n_t user;
 	user.s = (uint8_t*)key;
@@ -290,20 +299,20 @@ int pointless_get_mapping_string_n_to_value(pointless_t* p, pointless_value_t* m
 
 int pointless_get_mapping_unicode_to_value(pointless_t* p, pointless_value_t* map, uint32_t* key, pointless_value_t* value)
 {
-	uint32_t hash = pointless_hash_string_v1_32((uint8_t*)key);
+	uint32_t hash = pointless_hash_unicode_ucs4_32(p->features, key, pointless_ucs4_len(key));
 	return pointless_get_map_(p, map, hash, check_unicode, (void*)key, get_value, 0, (void*)value);
 }
 
 int pointless_get_mapping_unicode_to_u32(pointless_t* p, pointless_value_t* map, uint32_t* key, uint32_t* value)
 {
-	uint32_t hash = pointless_hash_string_v1_32((uint8_t*)key);
+	uint32_t hash = pointless_hash_unicode_ucs4_32(p->features, key, pointless_ucs4_len(key));
 	return pointless_get_map_(p, map, hash, check_unicode, (void*)key, check_and_get_u32, 0, (void*)value);
 }
 
 
 static int pointless_get_mapping_string_to_value_type(pointless_t* p, pointless_value_t* map, char* key, pointless_value_t* value, uint32_t type)
 {
-	uint32_t hash = pointless_hash_string_v1_32((uint8_t*)key);
+	uint32_t hash = pointless_hash_string_32(p->features, (uint8_t*)key, strlen(key));
 
 	pointless_value_t v;
 
@@ -426,7 +435,7 @@ int pointless_is_in_set_acyclic(pointless_t* p, pointless_value_t* s, pointless_
 	while (pointless_reader_set_iter_hash(p, s, hash, &kk, &iter_state)) {
 		_kk = pointless_value_to_complete(kk);
 
-		if (pointless_cmp_reader_acyclic(p, &_kk, p, &_k) == 0)
+		if (pointless_eq_reader_acyclic(p, &_kk, p, &_k))
 			return 1;
 	}
 
@@ -450,7 +459,7 @@ int pointless_is_in_map_acyclic(pointless_t* p, pointless_value_t* m, pointless_
 
 	while (pointless_reader_map_iter_hash(p, m, hash, &kk, &vv, &iter_state)) {
 		_kk = pointless_value_to_complete(kk);
-		if (pointless_cmp_reader_acyclic(p, &_kk, p, &_k) == 0)
+		if (pointless_eq_reader_acyclic(p, &_kk, p, &_k))
 			return 1;
 	}
 
@@ -72,6 +72,7 @@ static uint32_t pointless_recreate_convert_rec(pointless_recreate_state_t* state
 			break;
 		case POINTLESS_UNICODE_:
 		case POINTLESS_STRING_:
+		case POINTLESS_UNICODE_UTF8:
 			handle = state->string_unicode_r_c_mapping[v->data.data_u32];
 			break;
 		case POINTLESS_BITVECTOR:
@@ -96,6 +97,7 @@ static uint32_t pointless_recreate_convert_rec(pointless_recreate_state_t* state
 	pointless_value_t* value = 0;
 	void* bits = 0;
 	void* source_bits = 0;
+	uint32_t* ucs4 = 0;
 
 	if (pointless_is_vector_type(v->type))
 		n_items = pointless_reader_vector_n_items(state->p, v);
@@ -180,6 +182,21 @@ static uint32_t pointless_recreate_convert_rec(pointless_recreate_state_t* state
 			if (handle == POINTLESS_CREATE_VALUE_FAIL)
 				*state->error = "out of memory";
 			return handle;
+		case POINTLESS_UNICODE_UTF8:
+			// the creator keeps unicodes as ucs-4, and encodes them when the output is written
+			ucs4 = pointless_utf8_to_ucs4(pointless_reader_unicode_value_utf8(state->p, v));
+
+			if (ucs4 == 0) {
+				*state->error = "out of memory";
+				return POINTLESS_CREATE_VALUE_FAIL;
+			}
+
+			handle = pointless_create_unicode_ucs4(state->c, ucs4);
+			pointless_free(ucs4);
+			state->string_unicode_r_c_mapping[v->data.data_u32] = handle;
+			if (handle == POINTLESS_CREATE_VALUE_FAIL)
+				*state->error = "pointless_create_unicode_ucs4 failure";
+			return handle;
 		case POINTLESS_BITVECTOR_0:
 		case POINTLESS_BITVECTOR_1:
 		case POINTLESS_BITVECTOR_01:
@@ -337,9 +354,16 @@ int pointless_recreate_64(const char* fname_in, const char* fname_out, const cha
 	if (!pointless_open_f(&p, fname_in, error))
 		return 0;
 
-	// create destination
+	// create destination, keeping the format features of the source, which also give its hash table layout
 	pointless_create_t c;
-	pointless_create_begin_64(&c);
+
+	if (POINTLESS_FF_VERSION_NUMBER(p.header->version) != POINTLESS_FF_VERSION_OFFSET_64_FEATURES) {
+		pointless_create_begin_64(&c);
+	} else if (!pointless_create_begin_64_features(&c, p.features, error)) {
+		pointless_close(&p);
+		pointless_create_end(&c);
+		return 0;
+	}
 
 	uint32_t root = pointless_recreate_value(&p, pointless_root(&p), &c, error);
 
@@ -0,0 +1,288 @@
+#include <pointless/pointless_spill.h>
+#include <pointless/pointless_defs.h>
+
+#include <unistd.h>
+#include <errno.h>
+
+// appends are gathered in a buffer of this size, and the reader reads at least this much at a time
+#define POINTLESS_SPILL_BUFFER_SIZE (1024 * 1024)
+
+// buffers are compared in pieces of this size, so looking for duplicates allocates nothing
+#define POINTLESS_SPILL_PIECE_SIZE 4096
+
+static int pointless_spill_write_all(int fd, const char* buffer, size_t n)
+{
+	while (n > 0) {
+		ssize_t n_written = write(fd, buffer, SIMPLE_MIN(n, (size_t)1 << 30));
+
+		if (n_written < 0 && errno == EINTR)
+			continue;
+
+		if (n_written <= 0)
+			return 0;
+
+		buffer += n_written;
+		n -= (size_t)n_written;
+	}
+
+	return 1;
+}
+
+static int pointless_spill_read_all(int fd, char* buffer, size_t n, uint64_t offset)
+{
+	while (n > 0) {
+		ssize_t n_read = pread(fd, buffer, SIMPLE_MIN(n, (size_t)1 << 30), (off_t)offset);
+
+		if (n_read < 0 && errno == EINTR)
+			continue;
+
+		if (n_read <= 0)
+			return 0;
+
+		buffer += n_read;
+		offset += (uint64_t)n_read;
+		n -= (size_t)n_read;
+	}
+
+	return 1;
+}
+
+static int pointless_spill_flush(pointless_spill_t* s)
+{
+	if (!pointless_spill_write_all(s->fd, s->buffer, s->n_buffer))
+		return 0;
+
+	s->n_file += s->n_buffer;
+	s->n_buffer = 0;
+
+	return 1;
+}
+
+// items never straddle the file and the write buffer, so this is a single read or copy
+static int pointless_spill_read(pointless_spill_t* s, uint64_t offset, void* buffer, size_t n)
+{
+	if (offset < s->n_file)
+		return pointless_spill_read_all(s->fd, (char*)buffer, n, offset);
+
+	assert(offset - s->n_file + n <= s->n_buffer);
+	memcpy(buffer, s->buffer + (offset - s->n_file), n);
+
+	return 1;
+}
+
+int pointless_spill_init(pointless_spill_t* s, const char* dir, const char** error)
+{
+	uint32_t kind;
+
+	s->fd = -1;
+	s->n_file = 0;
+	s->buffer = 0;
+	s->n_buffer = 0;
+
+	for (kind = 0; kind < POINTLESS_SPILL_N_KINDS; kind++) {
+		pointless_dynarray_init(&s->entries[kind], sizeof(pointless_spill_entry_t));
+		pointless_ref_table_init(&s->maps[kind]);
+	}
+
+	s->buffer = (char*)pointless_malloc(POINTLESS_SPILL_BUFFER_SIZE);
+
+	if (s->buffer == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	s->fd = pointless_dynarray_temp_file(dir);
+
+	if (s->fd == -1) {
+		pointless_spill_destroy(s);
+		*error = "error creating spill file";
+		return 0;
+	}
+
+	return 1;
+}
+
+void pointless_spill_destroy(pointless_spill_t* s)
+{
+	uint32_t kind;
+
+	if (s->fd != -1)
+		close(s->fd);
+
+	pointless_free(s->buffer);
+
+	for (kind = 0; kind < POINTLESS_SPILL_N_KINDS; kind++) {
+		pointless_dynarray_destroy(&s->entries[kind]);
+		pointless_ref_table_destroy(&s->maps[kind]);
+	}
+
+	s->fd = -1;
+	s->buffer = 0;
+}
+
+int pointless_spill_append(pointless_spill_t* s, uint32_t kind, const void* buffer, uint64_t n_bytes, uint64_t n_heap, uint32_t hash, uint32_t handle, int dedup)
+{
+	pointless_spill_entry_t e;
+	e.offset = s->n_file + s->n_buffer;
+	e.n_bytes = n_bytes;
+	e.n_heap = n_heap;
+	e.hash = hash;
+	e.handle = handle;
+
+	// the bytes of a failed append are never referenced, so they need not be taken back
+	if (s->n_buffer + n_bytes > POINTLESS_SPILL_BUFFER_SIZE) {
+		if (!pointless_spill_flush(s))
+			return 0;
+
+		e.offset = s->n_file;
+	}
+
+	if (n_bytes >= POINTLESS_SPILL_BUFFER_SIZE) {
+		if (!pointless_spill_write_all(s->fd, (const char*)buffer, n_bytes))
+			return 0;
+
+		s->n_file += n_bytes;
+	} else {
+		memcpy(s->buffer + s->n_buffer, buffer, n_bytes);
+		s->n_buffer += n_bytes;
+	}
+
+	if (!pointless_dynarray_push(&s->entries[kind], &e))
+		return 0;
+
+	if (dedup && !pointless_ref_table_set(&s->maps[kind], pointless_hash_string_v2_32((uint8_t*)buffer, n_bytes), (uint32_t)(pointless_dynarray_n_items(&s->entries[kind]) - 1))) {
+		pointless_dynarray_pop(&s->entries[kind]);
+		return 0;
+	}
+
+	return 1;
+}
+
+typedef struct {
+	pointless_spill_t* s;
+	uint32_t kind;
+	const char* buffer;
+	uint64_t n_bytes;
+	int is_error;
+} pointless_spill_find_state_t;
+
+static int pointless_spill_find_eq(uint32_t i, void* user)
+{
+	pointless_spill_find_state_t* state = (pointless_spill_find_state_t*)user;
+	pointless_spill_entry_t* e = pointless_spill_entry_at(state->s, state->kind, i);
+	char piece[POINTLESS_SPILL_PIECE_SIZE];
+	uint64_t n_done = 0, n;
+
+	if (e->n_bytes != state->n_bytes)
+		return 0;
+
+	while (n_done < e->n_bytes) {
+		n = SIMPLE_MIN(e->n_bytes - n_done, (uint64_t)POINTLESS_SPILL_PIECE_SIZE);
+
+		if (!pointless_spill_read(state->s, e->offset + n_done, piece, n)) {
+			state->is_error = 1;
+			return 0;
+		}
+
+		if (memcmp(piece, state->buffer + n_done, n) != 0)
+			return 0;
+
+		n_done += n;
+	}
+
+	return 1;
+}
+
+int pointless_spill_find(pointless_spill_t* s, uint32_t kind, const void* buffer, uint64_t n_bytes, uint32_t* handle)
+{
+	pointless_spill_find_state_t state;
+	state.s = s;
+	state.kind = kind;
+	state.buffer = (const char*)buffer;
+	state.n_bytes = n_bytes;
+	state.is_error = 0;
+
+	uint32_t i = pointless_ref_table_get(&s->maps[kind], pointless_hash_string_v2_32((uint8_t*)buffer, n_bytes), pointless_spill_find_eq, &state);
+
+	if (state.is_error)
+		return 0;
+
+	*handle = (i == POINTLESS_OPEN_TABLE_MISSING) ? POINTLESS_OPEN_TABLE_MISSING : pointless_spill_entry_at(s, kind, i)->handle;
+
+	return 1;
+}
+
+void* pointless_spill_get(pointless_spill_t* s, uint32_t kind, uint32_t i, const char** error)
+{
+	pointless_spill_entry_t* e = pointless_spill_entry_at(s, kind, i);
+	void* buffer = pointless_malloc((size_t)e->n_bytes);
+
+	if (buffer == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	if (!pointless_spill_read(s, e->offset, buffer, (size_t)e->n_bytes)) {
+		pointless_free(buffer);
+		*error = "spill file read failure";
+		return 0;
+	}
+
+	return buffer;
+}
+
+void pointless_spill_reader_init(pointless_spill_reader_t* r, pointless_spill_t* s)
+{
+	r->s = s;
+	r->window = 0;
+	r->n_window_alloc = 0;
+	r->offset = 0;
+	r->n_window = 0;
+}
+
+void pointless_spill_reader_destroy(pointless_spill_reader_t* r)
+{
+	pointless_free(r->window);
+	pointless_spill_reader_init(r, r->s);
+}
+
+void* pointless_spill_reader_get(pointless_spill_reader_t* r, uint32_t kind, uint32_t i, const char** error)
+{
+	pointless_spill_t* s = r->s;
+	pointless_spill_entry_t* e = pointless_spill_entry_at(s, kind, i);
+
+	// everything is read from the file from here on
+	if (s->n_buffer > 0 && !pointless_spill_flush(s)) {
+		*error = "spill file write failure";
+		return 0;
+	}
+
+	if (e->offset < r->offset || e->offset + e->n_bytes > r->offset + r->n_window) {
+		size_t n = (size_t)SIMPLE_MIN(SIMPLE_MAX(e->n_bytes, (uint64_t)POINTLESS_SPILL_BUFFER_SIZE), s->n_file - e->offset);
+
+		if (n > r->n_window_alloc) {
+			char* window = (char*)pointless_realloc(r->window, n);
+
+			if (window == 0) {
+				*error = "out of memory";
+				return 0;
+			}
+
+			r->window = window;
+			r->n_window_alloc = n;
+		}
+
+		// the window is dropped first, so a failed read leaves nothing stale behind
+		r->n_window = 0;
+
+		if (!pointless_spill_read_all(s->fd, r->window, n, e->offset)) {
+			*error = "spill file read failure";
+			return 0;
+		}
+
+		r->offset = e->offset;
+		r->n_window = n;
+	}
+
+	return r->window + (e->offset - r->offset);
+}
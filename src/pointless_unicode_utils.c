@@ -113,3 +113,199 @@ uint32_t* pointless_ascii_to_ucs4(uint8_t* ascii)
 	*ucs4 = 0;
 	return ucs4_;
 }
+
+int pointless_is_ucs4_utf8(uint32_t* s)
+{
+	while (*s && *s <= 0x10FFFF)
+		s++;
+
+	return (*s == 0);
+}
+
+static size_t pointless_utf8_n_bytes(uint32_t c)
+{
+	if (c < 0x80)
+		return 1;
+
+	if (c < 0x800)
+		return 2;
+
+	if (c < 0x10000)
+		return 3;
+
+	return 4;
+}
+
+size_t pointless_ucs4_utf8_len(uint32_t* s)
+{
+	size_t n = 0;
+
+	while (*s)
+		n += pointless_utf8_n_bytes(*s++);
+
+	return n;
+}
+
+uint8_t* pointless_ucs4_to_utf8(uint32_t* ucs4)
+{
+	assert(pointless_is_ucs4_utf8(ucs4));
+	size_t n = pointless_ucs4_utf8_len(ucs4);
+	uint8_t* utf8_ = (uint8_t*)pointless_malloc(sizeof(uint8_t) * (n + 1));
+
+	if (utf8_ == 0)
+		return 0;
+
+	uint8_t* utf8 = utf8_;
+
+	for (; *ucs4; ucs4++) {
+		uint32_t c = *ucs4;
+
+		switch (pointless_utf8_n_bytes(c)) {
+			case 1:
+				*utf8++ = (uint8_t)c;
+				break;
+			case 2:
+				*utf8++ = (uint8_t)(0xC0 | (c >> 6));
+				*utf8++ = (uint8_t)(0x80 | (c & 0x3F));
+				break;
+			case 3:
+				*utf8++ = (uint8_t)(0xE0 | (c >> 12));
+				*utf8++ = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+				*utf8++ = (uint8_t)(0x80 | (c & 0x3F));
+				break;
+			case 4:
+				*utf8++ = (uint8_t)(0xF0 | (c >> 18));
+				*utf8++ = (uint8_t)(0x80 | ((c >> 12) & 0x3F));
+				*utf8++ = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+				*utf8++ = (uint8_t)(0x80 | (c & 0x3F));
+				break;
+		}
+	}
+
+	*utf8 = 0;
+	return utf8_;
+}
+
+uint32_t* pointless_utf8_to_ucs4(uint8_t* utf8)
+{
+	size_t n = pointless_utf8_len(utf8);
+
+	// watch out for overflow
+	intop_sizet_t c = intop_sizet_mult(intop_sizet_init(n + 1), intop_sizet_init(sizeof(uint32_t)));
+
+	if (c.is_overflow)
+		return 0;
+
+	uint32_t* ucs4_ = (uint32_t*)pointless_malloc(c.value);
+
+	if (ucs4_ == 0)
+		return 0;
+
+	uint32_t* ucs4 = ucs4_;
+
+	while (*utf8)
+		*ucs4++ = pointless_utf8_next(&utf8);
+
+	*ucs4 = 0;
+	return ucs4_;
+}
+
+int pointless_is_utf8(uint8_t* s, size_t n)
+{
+	size_t i = 0, j, n_cont;
+	uint32_t c, c_min;
+
+	while (i < n) {
+		c = s[i];
+
+		if (c == 0)
+			return 0;
+
+		if (c < 0x80) {
+			i += 1;
+			continue;
+		}
+
+		if (0xC2 <= c && c <= 0xDF) {
+			n_cont = 1;
+			c_min = 0x80;
+			c &= 0x1F;
+		} else if (0xE0 <= c && c <= 0xEF) {
+			n_cont = 2;
+			c_min = 0x800;
+			c &= 0x0F;
+		} else if (0xF0 <= c && c <= 0xF4) {
+			n_cont = 3;
+			c_min = 0x10000;
+			c &= 0x07;
+		} else {
+			return 0;
+		}
+
+		if (n - i - 1 < n_cont)
+			return 0;
+
+		for (j = 1; j <= n_cont; j++) {
+			if ((s[i + j] & 0xC0) != 0x80)
+				return 0;
+
+			c = (c << 6) | (s[i + j] & 0x3F);
+		}
+
+		// overlong or out of range
+		if (c < c_min || c > 0x10FFFF)
+			return 0;
+
+		i += n_cont + 1;
+	}
+
+	return 1;
+}
+
+int pointless_is_utf8_ucs1(uint8_t* s, size_t n)
+{
+	size_t i;
+
+	// lead bytes from 0xC4 start code points of 0x100 and above, continuation bytes are below that
+	for (i = 0; i < n; i++) {
+		if (s[i] >= 0xC4)
+			return 0;
+	}
+
+	return 1;
+}
+
+size_t pointless_utf8_len(uint8_t* s)
+{
+	size_t n = 0;
+
+	// every code point has exactly one byte which is not a continuation byte
+	for (; *s; s++)
+		n += ((*s & 0xC0) != 0x80);
+
+	return n;
+}
+
+uint32_t pointless_utf8_next(uint8_t** s)
+{
+	uint8_t* p = *s;
+	uint32_t c = p[0];
+
+	if (c < 0x80) {
+		*s += (c != 0);
+		return c;
+	}
+
+	if (c < 0xE0) {
+		*s += 2;
+		return ((c & 0x1F) << 6) | (p[1] & 0x3F);
+	}
+
+	if (c < 0xF0) {
+		*s += 3;
+		return ((c & 0x0F) << 12) | ((uint32_t)(p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+	}
+
+	*s += 4;
+	return ((c & 0x07) << 18) | ((uint32_t)(p[1] & 0x3F) << 12) | ((uint32_t)(p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+}
@@ -8,54 +8,59 @@ typedef struct {
 	void* vector;
 	void* set;
 	void* map;
+	void* string;
+	void* unicode;
+	void* utf8;
 } pointless_validate_state_t;
 
-static int pointless_validate_set_complicated(pointless_validate_state_t* state, pointless_value_t* v)
+static int pointless_validate_set_complicated(pointless_validate_context_t* context, pointless_value_t* v, const char** error)
 {
 	// get header
-	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(state->context->p, set_offsets, v->data.data_u32);
+	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(context->p, set_offsets, v->data.data_u32);
 
-	// vectors must have the same number of items
-	uint32_t n_hash = pointless_reader_vector_n_items(state->context->p, &header->hash_vector);
-	uint32_t n_keys = pointless_reader_vector_n_items(state->context->p, &header->key_vector);
+	// vectors must have the same number of items, other layouts had their buckets checked with the header
+	if (header->layout == POINTLESS_HASH_TABLE_LAYOUT_SPLIT) {
+		uint32_t n_hash = pointless_reader_vector_n_items(context->p, &header->hash_vector);
+		uint32_t n_keys = pointless_reader_vector_n_items(context->p, &header->key_vector);
 
-	if (n_hash != n_keys) {
-		state->error = "set hash and key vectors do not contain the same number of items";
-		return 0;
+		if (n_hash != n_keys) {
+			*error = "set hash and key vectors do not contain the same number of items";
+			return 0;
+		}
 	}
 
-	// get base pointers for both
-	uint32_t* hashes = pointless_reader_vector_u32(state->context->p, &header->hash_vector);
-	pointless_value_t* keys = pointless_reader_vector_value(state->context->p, &header->key_vector);
+	// get the buckets
+	pointless_hash_table_t t;
+	pointless_set_hash_table(context->p, v, &t);
 
 	// at this stage, all items have been validated, all that is left is to test the hash-map invariants
-	return pointless_hash_table_validate(state->context->p, header->n_items, n_keys, hashes, keys, 0, &state->error);
+	return pointless_hash_table_validate(context->p, header->n_items, &t, error);
 }
 
-static int pointless_validate_map_complicated(pointless_validate_state_t* state, pointless_value_t* v)
+static int pointless_validate_map_complicated(pointless_validate_context_t* context, pointless_value_t* v, const char** error)
 {
 	// get header
-	// get header
-	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(state->context->p, map_offsets, v->data.data_u32);
-
-	// vectors must have the same number of items
-	uint32_t n_hash = pointless_reader_vector_n_items(state->context->p, &header->hash_vector);
-	uint32_t n_keys = pointless_reader_vector_n_items(state->context->p, &header->key_vector);
-	uint32_t n_values = pointless_reader_vector_n_items(state->context->p, &header->value_vector);
-
-	// (a == b && b == c) <=> !(a != b || b != c)
-	if (n_hash != n_keys || n_hash != n_values) {
-		state->error = "map hash, key and value vectors do not contain the same number of items";
-		return 0;
+	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(context->p, map_offsets, v->data.data_u32);
+
+	// vectors must have the same number of items, other layouts had their buckets checked with the header
+	if (header->layout == POINTLESS_HASH_TABLE_LAYOUT_SPLIT) {
+		uint32_t n_hash = pointless_reader_vector_n_items(context->p, &header->hash_vector);
+		uint32_t n_keys = pointless_reader_vector_n_items(context->p, &header->key_vector);
+		uint32_t n_values = pointless_reader_vector_n_items(context->p, &header->value_vector);
+
+		// (a == b && b == c) <=> !(a != b || b != c)
+		if (n_hash != n_keys || n_hash != n_values) {
+			*error = "map hash, key and value vectors do not contain the same number of items";
+			return 0;
+		}
 	}
 
-	// get base pointers for both
-	uint32_t* hashes = pointless_reader_vector_u32(state->context->p, &header->hash_vector);
-	pointless_value_t* keys = pointless_reader_vector_value(state->context->p, &header->key_vector);
-	pointless_value_t* values = pointless_reader_vector_value(state->context->p, &header->value_vector);
+	// get the buckets
+	pointless_hash_table_t t;
+	pointless_map_hash_table(context->p, v, &t);
 
 	// at this stage, all items have been validated, all that is left is to test the hash-map invariants
-	return pointless_hash_table_validate(state->context->p, header->n_items, n_keys, hashes, keys, values, &state->error);
+	return pointless_hash_table_validate(context->p, header->n_items, &t, error);
 }
 
 static uint32_t pointless_validate_pass_cb(pointless_t* p, pointless_value_t* v, uint32_t depth, void* user)
@@ -104,7 +109,14 @@ static uint32_t pointless_validate_pass_cb(pointless_t* p, pointless_value_t* v,
 		if (!pointless_validate_inline_invariants(state->context, v, &state->error))
 			return POINTLESS_WALK_STOP;
 
-		if (!pointless_validate_heap_value(state->context, v, &state->error))
+		// with worker threads, string contents are checked after the walk
+		if (state->string && v->type == POINTLESS_STRING_)
+			bm_set_(state->string, v->data.data_u32);
+		else if (state->unicode && v->type == POINTLESS_UNICODE_)
+			bm_set_(state->unicode, v->data.data_u32);
+		else if (state->utf8 && v->type == POINTLESS_UNICODE_UTF8)
+			bm_set_(state->utf8, v->data.data_u32);
+		else if (!pointless_validate_heap_value(state->context, v, &state->error))
 			return POINTLESS_WALK_STOP;
 	// pass-2, cycle validation
 	} else if (state->pass == 2) {
@@ -116,13 +128,17 @@ static uint32_t pointless_validate_pass_cb(pointless_t* p, pointless_value_t* v,
 				state->error = "POINTLESS_VECTOR_VALUE_HASHABLE is in a cycle";
 				return POINTLESS_WALK_STOP;
 			}
+
+			// all children were validated in pass 1, so the stored hash can be checked
+			if (!pointless_validate_hash_slot(state->context, v, &state->error))
+				return POINTLESS_WALK_STOP;
 		}
 	// pass-3, hash test
 	} else if (state->pass == 3) {
-		if (v->type == POINTLESS_MAP_VALUE_VALUE && !pointless_validate_map_complicated(state, v))
+		if (v->type == POINTLESS_MAP_VALUE_VALUE && !pointless_validate_map_complicated(state->context, v, &state->error))
 			return POINTLESS_WALK_STOP;
 
-		if (v->type == POINTLESS_SET_VALUE && !pointless_validate_set_complicated(state, v))
+		if (v->type == POINTLESS_SET_VALUE && !pointless_validate_set_complicated(state->context, v, &state->error))
 			return POINTLESS_WALK_STOP;
 	}
 
@@ -130,6 +146,56 @@ static uint32_t pointless_validate_pass_cb(pointless_t* p, pointless_value_t* v,
 	return POINTLESS_WALK_VISIT_CHILDREN;
 }
 
+static int32_t pointless_validate_string_unicode_cb(pointless_validate_context_t* context, uint32_t i, void* user, const char** error)
+{
+	pointless_validate_state_t* state = (pointless_validate_state_t*)user;
+	pointless_value_t v;
+	v.data.data_u32 = i;
+
+	if (bm_is_set_(state->string, i)) {
+		v.type = POINTLESS_STRING_;
+
+		if (!pointless_validate_heap_value(context, &v, error))
+			return 0;
+	}
+
+	if (bm_is_set_(state->unicode, i)) {
+		v.type = POINTLESS_UNICODE_;
+
+		if (!pointless_validate_heap_value(context, &v, error))
+			return 0;
+	}
+
+	if (bm_is_set_(state->utf8, i)) {
+		v.type = POINTLESS_UNICODE_UTF8;
+
+		if (!pointless_validate_heap_value(context, &v, error))
+			return 0;
+	}
+
+	return 1;
+}
+
+static int32_t pointless_validate_set_cb(pointless_validate_context_t* context, uint32_t i, void* user, const char** error)
+{
+	pointless_validate_state_t* state = (pointless_validate_state_t*)user;
+	pointless_value_t v;
+	v.type = POINTLESS_SET_VALUE;
+	v.data.data_u32 = i;
+
+	return (!bm_is_set_(state->set, i) || pointless_validate_set_complicated(context, &v, error));
+}
+
+static int32_t pointless_validate_map_cb(pointless_validate_context_t* context, uint32_t i, void* user, const char** error)
+{
+	pointless_validate_state_t* state = (pointless_validate_state_t*)user;
+	pointless_value_t v;
+	v.type = POINTLESS_MAP_VALUE_VALUE;
+	v.data.data_u32 = i;
+
+	return (!bm_is_set_(state->map, i) || pointless_validate_map_complicated(context, &v, error));
+}
+
 int pointless_validate(pointless_validate_context_t* context, const char** error)
 {
 	// our return value
@@ -145,18 +211,36 @@ int pointless_validate(pointless_validate_context_t* context, const char** error
 	state.vector = pointless_calloc(ICEIL(context->p->header->n_vector, 8), 1);
 	state.set = pointless_calloc(ICEIL(context->p->header->n_set, 8), 1);
 	state.map = pointless_calloc(ICEIL(context->p->header->n_map, 8), 1);
+	state.string = 0;
+	state.unicode = 0;
+	state.utf8 = 0;
 
 	if (state.vector == 0 || state.set == 0 || state.map == 0) {
 		*error = "out of memory";
 		goto cleanup;
 	}
 
+	if (context->n_threads > 1) {
+		state.string = pointless_calloc(ICEIL(context->p->header->n_string_unicode, 8), 1);
+		state.unicode = pointless_calloc(ICEIL(context->p->header->n_string_unicode, 8), 1);
+		state.utf8 = pointless_calloc(ICEIL(context->p->header->n_string_unicode, 8), 1);
+
+		if (state.string == 0 || state.unicode == 0 || state.utf8 == 0) {
+			*error = "out of memory";
+			goto cleanup;
+		}
+	}
+
 	// pass 1
 	pointless_walk(context->p, pointless_validate_pass_cb, (void*)&state);
 
 	if (state.error)
 		goto cleanup;
 
+	// strings referenced in pass 1
+	if (state.string && !pointless_validate_parallel_for(context, context->p->header->n_string_unicode, pointless_validate_string_unicode_cb, &state, &state.error))
+		goto cleanup;
+
 	// it is now safe to perform cycle analysis
 	state.cycle_marker = pointless_cycle_marker_read(context->p, error);
 
@@ -175,17 +259,25 @@ int pointless_validate(pointless_validate_context_t* context, const char** error
 	if (state.error)
 		goto cleanup;
 
-	// reset visited vector
-	memset(state.vector, 0, ICEIL(context->p->header->n_vector, 8));
-	memset(state.set, 0, ICEIL(context->p->header->n_set, 8));
-	memset(state.map, 0, ICEIL(context->p->header->n_map, 8));
+	// pass 3, the sets/maps visited in pass 2 are exactly the ones reachable from the root
+	if (context->n_threads > 1) {
+		if (!pointless_validate_parallel_for(context, context->p->header->n_set, pointless_validate_set_cb, &state, &state.error))
+			goto cleanup;
 
-	// pass 3
-	state.pass = 3;
-	pointless_walk(context->p, pointless_validate_pass_cb, (void*)&state);
+		if (!pointless_validate_parallel_for(context, context->p->header->n_map, pointless_validate_map_cb, &state, &state.error))
+			goto cleanup;
+	} else {
+		// reset visited vector
+		memset(state.vector, 0, ICEIL(context->p->header->n_vector, 8));
+		memset(state.set, 0, ICEIL(context->p->header->n_set, 8));
+		memset(state.map, 0, ICEIL(context->p->header->n_map, 8));
 
-	if (state.error)
-		goto cleanup;
+		state.pass = 3;
+		pointless_walk(context->p, pointless_validate_pass_cb, (void*)&state);
+
+		if (state.error)
+			goto cleanup;
+	}
 
 	retval = 1;
 
@@ -195,6 +287,9 @@ cleanup:
 	pointless_free(state.vector);
 	pointless_free(state.set);
 	pointless_free(state.map);
+	pointless_free(state.string);
+	pointless_free(state.unicode);
+	pointless_free(state.utf8);
 
 	if (state.error)
 		*error = state.error;
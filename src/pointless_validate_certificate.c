@@ -0,0 +1,135 @@
+#include <pointless/pointless_validate.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#define POINTLESS_CERTIFICATE_MAGIC 0x43564c50 // "PLVC"
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t dev;
+	uint64_t ino;
+	uint64_t size;
+	int64_t mtime_sec;
+	int64_t mtime_nsec;
+	uint64_t checksum;
+} pointless_certificate_t;
+
+static int32_t pointless_certificate_init(pointless_validate_context_t* context, pointless_certificate_t* cert)
+{
+	struct stat s;
+
+	if (context->p->fd == 0 || fstat(fileno(context->p->fd), &s) != 0)
+		return 0;
+
+	memset(cert, 0, sizeof(*cert));
+	cert->magic = POINTLESS_CERTIFICATE_MAGIC;
+	cert->version = context->p->header->version;
+	cert->dev = (uint64_t)s.st_dev;
+	cert->ino = (uint64_t)s.st_ino;
+	cert->size = (uint64_t)s.st_size;
+#if defined(__APPLE__)
+	// MacOS has the same timestamp under another name
+	cert->mtime_sec = (int64_t)s.st_mtimespec.tv_sec;
+	cert->mtime_nsec = (int64_t)s.st_mtimespec.tv_nsec;
+#elif defined(__linux__) || defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200809L
+	cert->mtime_sec = (int64_t)s.st_mtim.tv_sec;
+	cert->mtime_nsec = (int64_t)s.st_mtim.tv_nsec;
+#else
+	// whole seconds only, the size and checksum still catch most rewrites within the same second
+	cert->mtime_sec = (int64_t)s.st_mtime;
+	cert->mtime_nsec = 0;
+#endif
+
+	// header and offset vectors are contiguous, and end where the heap starts
+	uint64_t n_bytes = (uint64_t)((char*)context->p->heap_ptr - (char*)context->p->header);
+	cert->checksum = pointless_checksum_64(context->p->header, n_bytes, 0);
+
+	return 1;
+}
+
+static char* pointless_certificate_fname(const char* fname, const char* suffix)
+{
+	char* cert_fname = (char*)pointless_malloc(strlen(fname) + strlen(suffix) + 1);
+
+	if (cert_fname) {
+		strcpy(cert_fname, fname);
+		strcat(cert_fname, suffix);
+	}
+
+	return cert_fname;
+}
+
+static int32_t pointless_certificate_read(const char* fname, pointless_certificate_t* cert)
+{
+	char* cert_fname = pointless_certificate_fname(fname, ".validated");
+
+	if (cert_fname == 0)
+		return 0;
+
+	int fd = open(cert_fname, O_RDONLY);
+	pointless_free(cert_fname);
+
+	if (fd == -1)
+		return 0;
+
+	ssize_t n = read(fd, cert, sizeof(*cert));
+	close(fd);
+
+	return (n == sizeof(*cert));
+}
+
+static void pointless_certificate_write(const char* fname, pointless_certificate_t* cert)
+{
+	// same pattern as pointless_create_output_and_end_f(), so readers never see a partial certificate
+	char* cert_fname = pointless_certificate_fname(fname, ".validated");
+	char* temp_fname = pointless_certificate_fname(fname, ".validated.XXXXXX");
+	int fd = -1;
+
+	if (cert_fname == 0 || temp_fname == 0)
+		goto cleanup;
+
+	fd = mkstemp(temp_fname);
+
+	if (fd == -1)
+		goto cleanup;
+
+	// other worker processes may run as different users
+	if (write(fd, cert, sizeof(*cert)) != sizeof(*cert) || fsync(fd) != 0 || fchmod(fd, S_IRUSR | S_IRGRP | S_IROTH) != 0) {
+		close(fd);
+		unlink(temp_fname);
+		goto cleanup;
+	}
+
+	close(fd);
+
+	if (rename(temp_fname, cert_fname) != 0)
+		unlink(temp_fname);
+
+cleanup:
+
+	pointless_free(cert_fname);
+	pointless_free(temp_fname);
+}
+
+int32_t pointless_validate_certified(pointless_validate_context_t* context, const char* fname, const char** error)
+{
+	pointless_certificate_t expected, found;
+
+	// not a regular file we can fstat(), certificates are no use
+	if (!pointless_certificate_init(context, &expected))
+		return pointless_validate(context, error);
+
+	if (pointless_certificate_read(fname, &found) && memcmp(&expected, &found, sizeof(expected)) == 0)
+		return 1;
+
+	if (!pointless_validate(context, error))
+		return 0;
+
+	// failing to write the certificate just means we validate again next time
+	pointless_certificate_write(fname, &expected);
+
+	return 1;
+}
@@ -0,0 +1,143 @@
+#include <pointless/pointless_validate.h>
+
+int32_t pointless_checksum_trailer_init(pointless_t* p, uint64_t buflen, const char** error)
+{
+	// header and offset vectors, which have already been checked to fit in the buffer
+	uint64_t mandatory_size = (uint64_t)((char*)p->heap_ptr - (char*)p->header);
+
+	if (buflen < mandatory_size + sizeof(pointless_checksum_trailer_t) || buflen % 8 != 0) {
+		*error = "file is too small to hold checksum trailer";
+		return 0;
+	}
+
+	pointless_checksum_trailer_t* trailer = (pointless_checksum_trailer_t*)((char*)p->header + buflen - sizeof(pointless_checksum_trailer_t));
+
+	if (trailer->heap_block_size == 0 || trailer->heap_len > buflen) {
+		*error = "invalid checksum trailer";
+		return 0;
+	}
+
+	if (trailer->n_heap_blocks != ICEIL(trailer->heap_len, trailer->heap_block_size)) {
+		*error = "invalid checksum trailer";
+		return 0;
+	}
+
+	// heap, padding to 8 bytes, one checksum per heap block, trailer
+	uint64_t checksums_offset = mandatory_size + trailer->heap_len;
+	checksums_offset += (8 - checksums_offset % 8) % 8;
+
+	if (checksums_offset + trailer->n_heap_blocks * sizeof(uint64_t) + sizeof(pointless_checksum_trailer_t) != buflen) {
+		*error = "invalid checksum trailer";
+		return 0;
+	}
+
+	uint64_t* heap_block_checksums = (uint64_t*)((char*)p->header + checksums_offset);
+
+	// the trailer checksum protects everything we rely on below
+	pointless_checksum_state_t state;
+	pointless_checksum_64_init(&state, 0);
+	pointless_checksum_64_update(&state, heap_block_checksums, trailer->n_heap_blocks * sizeof(uint64_t));
+	pointless_checksum_64_update(&state, trailer, offsetof(pointless_checksum_trailer_t, trailer_checksum));
+
+	if (pointless_checksum_64_digest(&state) != trailer->trailer_checksum) {
+		*error = "checksum trailer mismatch";
+		return 0;
+	}
+
+	if (pointless_checksum_64(p->header, sizeof(pointless_header_t), 0) != trailer->header_checksum) {
+		*error = "header checksum mismatch";
+		return 0;
+	}
+
+	p->checksum_trailer = trailer;
+	p->heap_block_checksums = heap_block_checksums;
+	p->heap_len = trailer->heap_len;
+
+	return 1;
+}
+
+uint64_t pointless_checksum_n_heap_blocks(pointless_t* p)
+{
+	return (p->checksum_trailer ? p->checksum_trailer->n_heap_blocks : 0);
+}
+
+int32_t pointless_checksum_verify_offsets(pointless_t* p, uint32_t i, const char** error)
+{
+	uint64_t* offsets[5] = {p->string_unicode_offsets_64, p->vector_offsets_64, p->bitvector_offsets_64, p->set_offsets_64, p->map_offsets_64};
+	uint32_t n_offsets[5] = {p->header->n_string_unicode, p->header->n_vector, p->header->n_bitvector, p->header->n_set, p->header->n_map};
+
+	if (p->checksum_trailer == 0) {
+		*error = "file has no checksums";
+		return 0;
+	}
+
+	if (i >= 5) {
+		*error = "offset vector index out of range";
+		return 0;
+	}
+
+	if (pointless_checksum_64(offsets[i], (uint64_t)n_offsets[i] * sizeof(uint64_t), 0) != p->checksum_trailer->offsets_checksum[i]) {
+		*error = "offset vector checksum mismatch";
+		return 0;
+	}
+
+	return 1;
+}
+
+int32_t pointless_checksum_verify_heap_block(pointless_t* p, uint64_t i, const char** error)
+{
+	if (p->checksum_trailer == 0) {
+		*error = "file has no checksums";
+		return 0;
+	}
+
+	if (i >= p->checksum_trailer->n_heap_blocks) {
+		*error = "heap block index out of range";
+		return 0;
+	}
+
+	uint64_t block_size = p->checksum_trailer->heap_block_size;
+	uint64_t begin = i * block_size;
+	uint64_t n_bytes = SIMPLE_MIN(block_size, p->heap_len - begin);
+
+	if (pointless_checksum_64((char*)p->heap_ptr + begin, n_bytes, 0) != p->heap_block_checksums[i]) {
+		*error = "heap block checksum mismatch";
+		return 0;
+	}
+
+	return 1;
+}
+
+// items [0, 5) are the offset vectors, the rest are heap blocks
+static int32_t pointless_checksum_verify_cb(pointless_validate_context_t* context, uint32_t i, void* user, const char** error)
+{
+	if (i < 5)
+		return pointless_checksum_verify_offsets(context->p, i, error);
+
+	return pointless_checksum_verify_heap_block(context->p, (uint64_t)i - 5, error);
+}
+
+int32_t pointless_checksum_verify(pointless_t* p, uint32_t n_threads, const char** error)
+{
+	if (p->checksum_trailer == 0) {
+		*error = "file has no checksums";
+		return 0;
+	}
+
+	if (p->checksum_trailer->n_heap_blocks > UINT32_MAX - 5) {
+		*error = "too many heap blocks";
+		return 0;
+	}
+
+	pointless_validate_context_t context;
+	context.p = p;
+	context.n_threads = n_threads;
+
+	// the header was checked at open time, but the buffer may have changed since
+	if (pointless_checksum_64(p->header, sizeof(pointless_header_t), 0) != p->checksum_trailer->header_checksum) {
+		*error = "header checksum mismatch";
+		return 0;
+	}
+
+	return pointless_validate_parallel_for(&context, 5 + (uint32_t)p->checksum_trailer->n_heap_blocks, pointless_checksum_verify_cb, 0, error);
+}
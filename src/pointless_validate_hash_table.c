@@ -1,7 +1,10 @@
 #include <pointless/pointless_validate.h>
 
-int32_t pointless_hash_table_validate(pointless_t* p, uint32_t n_items, uint32_t n_buckets, uint32_t* hash_vector, pointless_value_t* key_vector, pointless_value_t* value_vector, const char** error)
+// open addressing: the bucket count follows from the item count, and there is at least one empty bucket
+static int32_t pointless_hash_table_validate_open(uint32_t n_items, pointless_hash_table_t* t, const char** error)
 {
+	uint32_t n_buckets = t->n_buckets;
+
 	if (pointless_hash_compute_n_buckets(n_items) != n_buckets) {
 		*error = "invalid number of buckets in hash table";
 		return 0;
@@ -11,13 +14,13 @@ int32_t pointless_hash_table_validate(pointless_t* p, uint32_t n_items, uint32_t
 	uint32_t n_used = 0, n_empty = 0, i;
 
 	for (i = 0; i < n_buckets; i++) {
-		if (key_vector[i].type == POINTLESS_EMPTY_SLOT)
+		if (PHT_KEY(t, i)->type == POINTLESS_EMPTY_SLOT)
 			n_empty += 1;
 		else
 			n_used += 1;
 
 		// when key vector has an empty slot, so must the value vector
-		if (value_vector && key_vector[i].type == POINTLESS_EMPTY_SLOT && value_vector[i].type != POINTLESS_EMPTY_SLOT) {
+		if (t->values && PHT_KEY(t, i)->type == POINTLESS_EMPTY_SLOT && PHT_VALUE(t, i)->type != POINTLESS_EMPTY_SLOT) {
 			*error = "empty slot in key vector does not imply an empty slot in value vector";
 			return 0;
 		}
@@ -33,29 +36,69 @@ int32_t pointless_hash_table_validate(pointless_t* p, uint32_t n_items, uint32_t
 		return 0;
 	}
 
+	return 1;
+}
+
+// minimal perfect hash: one bucket per item, none empty, and the overflow sorted by hash, so that it can be searched
+static int32_t pointless_hash_table_validate_mphf(uint32_t n_items, pointless_hash_table_t* t, const char** error)
+{
+	uint32_t i;
+
+	if (t->n_buckets != n_items) {
+		*error = "invalid number of buckets in hash table";
+		return 0;
+	}
+
+	for (i = 0; i < t->n_buckets; i++) {
+		if (PHT_KEY(t, i)->type == POINTLESS_EMPTY_SLOT) {
+			*error = "empty slot in minimal perfect hash table";
+			return 0;
+		}
+
+		if (i > t->n_primary && PHT_HASH(t, i) < PHT_HASH(t, i - 1)) {
+			*error = "minimal perfect hash table overflow is not sorted by hash";
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+int32_t pointless_hash_table_validate(pointless_t* p, uint32_t n_items, pointless_hash_table_t* t, const char** error)
+{
+	uint32_t n_buckets = t->n_buckets, i;
+
+	if (t->layout == POINTLESS_HASH_TABLE_LAYOUT_MPHF) {
+		if (!pointless_hash_table_validate_mphf(n_items, t, error))
+			return 0;
+	} else if (!pointless_hash_table_validate_open(n_items, t, error)) {
+		return 0;
+	}
+
 	// make sure hashes match the given object
 	for (i = 0; i < n_buckets; i++) {
 		// make sure it is hashable
-		if (!pointless_is_hashable(key_vector[i].type)) {
+		if (!pointless_is_hashable(PHT_KEY(t, i)->type)) {
 			*error = "key in set/map is not hashable";
 			return 0;
 		}
 
 		// just compute the hash, even for empty slots
-		uint32_t h = pointless_hash_reader_32(p, &key_vector[i]);
+		uint32_t h = pointless_hash_reader_32(p, PHT_KEY(t, i));
 
-		if (h != hash_vector[i]) {
+		if (h != PHT_HASH(t, i)) {
 			*error = "hash for object in hash-table does not match hash in slot";
 			return 0;
 		}
 	}
 
-	// right, all the hashes match, now, make sure they are in the right place
+	// right, all the hashes match, now, make sure they are in the right place, for a minimal perfect hash table, this
+	// also means that primary buckets are where their pilot sends them, and that all keys are distinct
 	for (i = 0; i < n_buckets; i++) {
-		if (key_vector[i].type == POINTLESS_EMPTY_SLOT)
+		if (PHT_KEY(t, i)->type == POINTLESS_EMPTY_SLOT)
 			continue;
 
-		uint32_t probe_i = pointless_hash_table_probe(p, hash_vector[i], &key_vector[i], n_buckets, hash_vector, key_vector, error);
+		uint32_t probe_i = pointless_hash_table_probe(p, PHT_HASH(t, i), PHT_KEY(t, i), t, error);
 
 		if (probe_i == POINTLESS_HASH_TABLE_PROBE_ERROR)
 			return 0;
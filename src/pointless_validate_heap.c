@@ -65,6 +65,11 @@ static int32_t pointless_validate_vector_heap(pointless_validate_context_t* cont
 		return 0;
 	}
 
+	// the hash of a value vector depends on its children, which are not validated yet, pointless_validate()
+	// checks it once they are, and pointless_validate_lazy() once it has validated them
+	if (v->type != POINTLESS_VECTOR_VALUE && v->type != POINTLESS_VECTOR_VALUE_HASHABLE)
+		return pointless_validate_hash_slot(context, v, error);
+
 	return 1;
 }
 
@@ -125,7 +130,7 @@ static int32_t pointless_validate_unicode_heap(pointless_validate_context_t* con
 		return 0;
 	}
 
-	return 1;
+	return pointless_validate_hash_slot(context, v, error);
 }
 
 static int32_t pointless_validate_string_heap(pointless_validate_context_t* context, pointless_value_t* v, const char** error)
@@ -164,6 +169,148 @@ static int32_t pointless_validate_string_heap(pointless_validate_context_t* cont
 		return 0;
 	}
 
+	return pointless_validate_hash_slot(context, v, error);
+}
+
+// true iff every item of a value vector is hashable, at any depth, the depth is bounded by the walk which reached v
+static int pointless_validate_is_hashable(pointless_t* p, pointless_value_t* v, uint32_t depth)
+{
+	pointless_value_t* items = pointless_reader_vector_value(p, v);
+	uint32_t i, n_items = pointless_reader_vector_n_items(p, v);
+
+	if (depth >= POINTLESS_MAX_DEPTH)
+		return 0;
+
+	for (i = 0; i < n_items; i++) {
+		if (!pointless_is_hashable(items[i].type))
+			return 0;
+
+		if (items[i].type == POINTLESS_VECTOR_VALUE_HASHABLE && !pointless_validate_is_hashable(p, &items[i], depth + 1))
+			return 0;
+	}
+
+	return 1;
+}
+
+int32_t pointless_validate_hash_slot(pointless_validate_context_t* context, pointless_value_t* v, const char** error)
+{
+	uint32_t hash, expected_hash;
+
+	if (!pointless_hash_reader_stored_32(context->p, v, &hash))
+		return 1;
+
+	// vectors with unhashable items, such as the empty slots of set/map key vectors, must not have a stored hash
+	if (v->type == POINTLESS_VECTOR_VALUE_HASHABLE) {
+		expected_hash = pointless_validate_is_hashable(context->p, v, 0) ? pointless_hash_reader_computed_32(context->p, v) : 0;
+	} else {
+		expected_hash = pointless_hash_reader_computed_32(context->p, v);
+	}
+
+	if (hash != expected_hash) {
+		*error = "stored hash does not match value";
+		return 0;
+	}
+
+	return 1;
+}
+
+static int32_t pointless_validate_unicode_utf8_heap(pointless_validate_context_t* context, pointless_value_t* v, const char** error)
+{
+	assert(v->data.data_u32 < context->p->header->n_string_unicode);
+	uint64_t offset = PC_OFFSET(context->p, string_unicode_offsets, v->data.data_u32);
+
+	// uint32_t | uint8_t * (len + 1)
+	if (!pointless_require_heap(context, offset, sizeof(uint32_t))) {
+		*error = "utf-8 unicode too large for heap";
+		return 0;
+	}
+
+	uint32_t* s_len = (uint32_t*)((char*)context->p->heap_ptr + offset);
+
+	intop_u64_t n_bytes = intop_u64_add(intop_u64_init(sizeof(uint32_t)), intop_u64_mult(intop_u64_init((uint64_t)*s_len + 1), intop_u64_init(sizeof(uint8_t))));
+
+	if (n_bytes.is_overflow || !pointless_require_heap(context, offset, n_bytes.value)) {
+		*error = "utf-8 unicode too large for heap";
+		return 0;
+	}
+
+	uint8_t* s = (uint8_t*)(s_len + 1);
+
+	if (!pointless_is_utf8(s, *s_len)) {
+		*error = "malformed utf-8 unicode";
+		return 0;
+	}
+
+	if (s[*s_len] != 0) {
+		*error = "missing end-of-unicode";
+		return 0;
+	}
+
+	return pointless_validate_hash_slot(context, v, error);
+}
+
+// interleaved buckets are the children of a set/map, so unlike key/value vectors, we check their bounds up front
+static int32_t pointless_validate_interleaved_heap(pointless_validate_context_t* context, pointless_value_t* hash_vector, uint32_t stride, const char** error)
+{
+	if (!(context->p->features & POINTLESS_FF_FEATURE_INTERLEAVED)) {
+		*error = "interleaved hash table not supported in this file";
+		return 0;
+	}
+
+	if (!pointless_validate_heap_ref(context, hash_vector, error))
+		return 0;
+
+	if (!pointless_validate_vector_heap(context, hash_vector, error))
+		return 0;
+
+	if (pointless_reader_vector_n_items(context->p, hash_vector) % stride != 0) {
+		*error = "interleaved hash table does not contain a whole number of buckets";
+		return 0;
+	}
+
+	return 1;
+}
+
+// same as above, the vector must also hold exactly the pilots and n_items buckets
+static int32_t pointless_validate_mphf_heap(pointless_validate_context_t* context, pointless_value_t* hash_vector, uint32_t stride, uint32_t n_items, const char** error)
+{
+	if (!(context->p->features & POINTLESS_FF_FEATURE_MPHF)) {
+		*error = "minimal perfect hash table not supported in this file";
+		return 0;
+	}
+
+	if (!pointless_validate_heap_ref(context, hash_vector, error))
+		return 0;
+
+	if (!pointless_validate_vector_heap(context, hash_vector, error))
+		return 0;
+
+	uint32_t n_words = pointless_reader_vector_n_items(context->p, hash_vector);
+	uint32_t* words = pointless_reader_vector_u32(context->p, hash_vector);
+
+	if (n_words < POINTLESS_MPHF_HEADER_WORDS) {
+		*error = "minimal perfect hash table header missing";
+		return 0;
+	}
+
+	uint32_t n_primary = words[0];
+	uint32_t n_pilots = words[1];
+
+	if (n_primary > n_items || (n_primary == 0) != (n_items == 0)) {
+		*error = "minimal perfect hash table has an invalid number of primary buckets";
+		return 0;
+	}
+
+	if (n_pilots != pointless_mphf_n_pilots(n_primary)) {
+		*error = "minimal perfect hash table has an invalid number of pilots";
+		return 0;
+	}
+
+	if ((uint64_t)n_words != (uint64_t)POINTLESS_MPHF_HEADER_WORDS + n_pilots + (uint64_t)stride * n_items) {
+		*error = "minimal perfect hash table does not contain exactly one bucket per item";
+		return 0;
+	}
+
 	return 1;
 }
 
@@ -187,13 +334,33 @@ static int32_t pointless_validate_set_heap(pointless_validate_context_t* context
 		return 0;
 	}
 
-	if (header->key_vector.type != POINTLESS_VECTOR_VALUE_HASHABLE) {
-		*error = "set key vector not of type POINTLESS_VECTOR_VALUE_HASHABLE";
-		printf("but rather %i\n", (int)header->key_vector.type);
-		return 0;
+	switch (header->layout) {
+		case POINTLESS_HASH_TABLE_LAYOUT_SPLIT:
+			if (header->key_vector.type != POINTLESS_VECTOR_VALUE_HASHABLE) {
+				*error = "set key vector not of type POINTLESS_VECTOR_VALUE_HASHABLE";
+				printf("but rather %i\n", (int)header->key_vector.type);
+				return 0;
+			}
+
+			return 1;
+		case POINTLESS_HASH_TABLE_LAYOUT_INTERLEAVED:
+			if (header->key_vector.type != POINTLESS_VECTOR_EMPTY) {
+				*error = "interleaved set key vector not of type POINTLESS_VECTOR_EMPTY";
+				return 0;
+			}
+
+			return pointless_validate_interleaved_heap(context, &header->hash_vector, POINTLESS_SET_INTERLEAVED_STRIDE, error);
+		case POINTLESS_HASH_TABLE_LAYOUT_MPHF:
+			if (header->key_vector.type != POINTLESS_VECTOR_EMPTY) {
+				*error = "minimal perfect hash set key vector not of type POINTLESS_VECTOR_EMPTY";
+				return 0;
+			}
+
+			return pointless_validate_mphf_heap(context, &header->hash_vector, POINTLESS_SET_INTERLEAVED_STRIDE, header->n_items, error);
 	}
 
-	return 1;
+	*error = "unknown set layout";
+	return 0;
 }
 
 static int32_t pointless_validate_map_heap(pointless_validate_context_t* context, pointless_value_t* v, const char** error)
@@ -216,18 +383,38 @@ static int32_t pointless_validate_map_heap(pointless_validate_context_t* context
 		return 0;
 	}
 
-	if (header->key_vector.type != POINTLESS_VECTOR_VALUE_HASHABLE) {
-		*error = "map key vector not of type POINTLESS_VECTOR_VALUE_HASHABLE";
-		printf("but rather %i\n", (int)header->key_vector.type);
-		return 0;
-	}
-
-	if (header->value_vector.type != POINTLESS_VECTOR_VALUE_HASHABLE && header->value_vector.type != POINTLESS_VECTOR_VALUE) {
-		*error = "map key vector not of type POINTLESS_VECTOR_VALUE or POINTLESS_VECTOR_VALUE_HASHABLE";
-		return 0;
+	switch (header->layout) {
+		case POINTLESS_HASH_TABLE_LAYOUT_SPLIT:
+			if (header->key_vector.type != POINTLESS_VECTOR_VALUE_HASHABLE) {
+				*error = "map key vector not of type POINTLESS_VECTOR_VALUE_HASHABLE";
+				printf("but rather %i\n", (int)header->key_vector.type);
+				return 0;
+			}
+
+			if (header->value_vector.type != POINTLESS_VECTOR_VALUE_HASHABLE && header->value_vector.type != POINTLESS_VECTOR_VALUE) {
+				*error = "map key vector not of type POINTLESS_VECTOR_VALUE or POINTLESS_VECTOR_VALUE_HASHABLE";
+				return 0;
+			}
+
+			return 1;
+		case POINTLESS_HASH_TABLE_LAYOUT_INTERLEAVED:
+			if (header->key_vector.type != POINTLESS_VECTOR_EMPTY || header->value_vector.type != POINTLESS_VECTOR_EMPTY) {
+				*error = "interleaved map key/value vectors not of type POINTLESS_VECTOR_EMPTY";
+				return 0;
+			}
+
+			return pointless_validate_interleaved_heap(context, &header->hash_vector, POINTLESS_MAP_INTERLEAVED_STRIDE, error);
+		case POINTLESS_HASH_TABLE_LAYOUT_MPHF:
+			if (header->key_vector.type != POINTLESS_VECTOR_EMPTY || header->value_vector.type != POINTLESS_VECTOR_EMPTY) {
+				*error = "minimal perfect hash map key/value vectors not of type POINTLESS_VECTOR_EMPTY";
+				return 0;
+			}
+
+			return pointless_validate_mphf_heap(context, &header->hash_vector, POINTLESS_MAP_INTERLEAVED_STRIDE, header->n_items, error);
 	}
 
-	return 1;
+	*error = "unknown map layout";
+	return 0;
 }
 
 int32_t pointless_validate_heap_value(pointless_validate_context_t* context, pointless_value_t* v, const char** error)
@@ -251,6 +438,8 @@ int32_t pointless_validate_heap_value(pointless_validate_context_t* context, poi
 			return pointless_validate_unicode_heap(context, v, error);
 		case POINTLESS_STRING_:
 			return pointless_validate_string_heap(context, v, error);
+		case POINTLESS_UNICODE_UTF8:
+			return pointless_validate_unicode_utf8_heap(context, v, error);
 		case POINTLESS_BITVECTOR:
 			return pointless_validate_bitvector_heap(context, v, error);
 		case POINTLESS_BITVECTOR_0:
@@ -31,6 +31,13 @@ int32_t pointless_validate_inline_invariants(pointless_validate_context_t* conte
 				return 0;
 			}
 
+			break;
+		case POINTLESS_UNICODE_UTF8:
+			if (!(context->p->features & POINTLESS_FF_FEATURE_UTF8)) {
+				*error = "utf-8 unicode in a file without utf-8 unicodes";
+				return 0;
+			}
+
 			break;
 		case POINTLESS_UNICODE_:
 		case POINTLESS_STRING_:
@@ -76,6 +83,7 @@ int32_t pointless_validate_heap_ref(pointless_validate_context_t* context, point
 	switch (v->type) {
 		case POINTLESS_UNICODE_:
 		case POINTLESS_STRING_:
+		case POINTLESS_UNICODE_UTF8:
 			if (v->data.data_u32 >= context->p->header->n_string_unicode) {
 				*error = "string/unicode reference out of bounds";
 				return 0;
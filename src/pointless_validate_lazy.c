@@ -0,0 +1,299 @@
+#include <pointless/pointless_validate.h>
+
+static void* pointless_validate_lazy_bitmap(pointless_validate_lazy_t* lazy, uint32_t type)
+{
+	switch (type) {
+		case POINTLESS_UNICODE_:
+		case POINTLESS_STRING_:
+		case POINTLESS_UNICODE_UTF8:
+			return lazy->string_unicode;
+		case POINTLESS_VECTOR_VALUE:
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+		case POINTLESS_VECTOR_I8:
+		case POINTLESS_VECTOR_U8:
+		case POINTLESS_VECTOR_I16:
+		case POINTLESS_VECTOR_U16:
+		case POINTLESS_VECTOR_I32:
+		case POINTLESS_VECTOR_U32:
+		case POINTLESS_VECTOR_I64:
+		case POINTLESS_VECTOR_U64:
+		case POINTLESS_VECTOR_FLOAT:
+			return lazy->vector;
+		case POINTLESS_BITVECTOR:
+			return lazy->bitvector;
+		case POINTLESS_SET_VALUE:
+			return lazy->set;
+		case POINTLESS_MAP_VALUE_VALUE:
+			return lazy->map;
+	}
+
+	// inline value
+	return 0;
+}
+
+// containers whose validation depends on how deep it goes, a shallow pass does not count for a deep one,
+// the same vector may be referenced both as a value vector and as a hashable one
+static void* pointless_validate_lazy_deep_bitmap(pointless_validate_lazy_t* lazy, uint32_t type)
+{
+	switch (type) {
+		case POINTLESS_VECTOR_VALUE:
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+			return lazy->vector_deep;
+		case POINTLESS_MAP_VALUE_VALUE:
+			return lazy->map_deep;
+	}
+
+	return 0;
+}
+
+static int32_t pointless_validate_lazy_rec(pointless_validate_context_t* context, pointless_value_t* v, uint32_t depth, int32_t deep, const char** error);
+
+// keys and values of interleaved and minimal perfect hash tables are validated the same way as the items of key/value vectors
+static int32_t pointless_validate_lazy_item(pointless_validate_context_t* context, pointless_value_t* v, uint32_t depth, int32_t deep, const char** error)
+{
+	if (deep)
+		return pointless_validate_lazy_rec(context, v, depth, deep, error);
+
+	return (pointless_validate_heap_ref(context, v, error) && pointless_validate_inline_invariants(context, v, error));
+}
+
+static int32_t pointless_validate_lazy_set(pointless_validate_context_t* context, pointless_value_t* v, uint32_t depth, int32_t deep, const char** error)
+{
+	pointless_set_header_t* header = (pointless_set_header_t*)PC_HEAP_OFFSET(context->p, set_offsets, v->data.data_u32);
+	pointless_hash_table_t t;
+	uint32_t i;
+
+	// keys are hashed and compared when probing, so they are validated all the way down
+	if (!pointless_validate_lazy_rec(context, &header->hash_vector, depth + 1, deep, error))
+		return 0;
+
+	if (header->layout != POINTLESS_HASH_TABLE_LAYOUT_SPLIT) {
+		pointless_set_hash_table(context->p, v, &t);
+
+		for (i = 0; i < t.n_buckets; i++) {
+			if (!pointless_validate_lazy_item(context, PHT_KEY(&t, i), depth + 1, 1, error))
+				return 0;
+		}
+	} else {
+		if (!pointless_validate_lazy_rec(context, &header->key_vector, depth + 1, 1, error))
+			return 0;
+
+		uint32_t n_hash = pointless_reader_vector_n_items(context->p, &header->hash_vector);
+		uint32_t n_keys = pointless_reader_vector_n_items(context->p, &header->key_vector);
+
+		if (n_hash != n_keys) {
+			*error = "set hash and key vectors do not contain the same number of items";
+			return 0;
+		}
+
+		pointless_set_hash_table(context->p, v, &t);
+	}
+
+	return pointless_hash_table_validate(context->p, header->n_items, &t, error);
+}
+
+static int32_t pointless_validate_lazy_map(pointless_validate_context_t* context, pointless_value_t* v, uint32_t depth, int32_t deep, const char** error)
+{
+	pointless_map_header_t* header = (pointless_map_header_t*)PC_HEAP_OFFSET(context->p, map_offsets, v->data.data_u32);
+	pointless_hash_table_t t;
+	uint32_t i;
+
+	// same as sets, values are only validated when touched, unless we are already going deep
+	if (!pointless_validate_lazy_rec(context, &header->hash_vector, depth + 1, deep, error))
+		return 0;
+
+	if (header->layout != POINTLESS_HASH_TABLE_LAYOUT_SPLIT) {
+		pointless_map_hash_table(context->p, v, &t);
+
+		for (i = 0; i < t.n_buckets; i++) {
+			if (!pointless_validate_lazy_item(context, PHT_KEY(&t, i), depth + 1, 1, error))
+				return 0;
+
+			if (!pointless_validate_lazy_item(context, PHT_VALUE(&t, i), depth + 1, deep, error))
+				return 0;
+		}
+	} else {
+		if (!pointless_validate_lazy_rec(context, &header->key_vector, depth + 1, 1, error))
+			return 0;
+
+		if (!pointless_validate_lazy_rec(context, &header->value_vector, depth + 1, deep, error))
+			return 0;
+
+		uint32_t n_hash = pointless_reader_vector_n_items(context->p, &header->hash_vector);
+		uint32_t n_keys = pointless_reader_vector_n_items(context->p, &header->key_vector);
+		uint32_t n_values = pointless_reader_vector_n_items(context->p, &header->value_vector);
+
+		if (n_hash != n_keys || n_hash != n_values) {
+			*error = "map hash, key and value vectors do not contain the same number of items";
+			return 0;
+		}
+
+		pointless_map_hash_table(context->p, v, &t);
+	}
+
+	return pointless_hash_table_validate(context->p, header->n_items, &t, error);
+}
+
+static int32_t pointless_validate_lazy_rec(pointless_validate_context_t* context, pointless_value_t* v, uint32_t depth, int32_t deep, const char** error)
+{
+	// hashable vectors are not marked until all their children are, so cycles end up here
+	if (depth >= POINTLESS_MAX_DEPTH) {
+		*error = "maximum depth exceeded";
+		return 0;
+	}
+
+	if (!pointless_validate_heap_ref(context, v, error))
+		return 0;
+
+	if (!pointless_validate_inline_invariants(context, v, error))
+		return 0;
+
+	void* bitmap = pointless_validate_lazy_bitmap(context->p->lazy, v->type);
+	void* deep_bitmap = pointless_validate_lazy_deep_bitmap(context->p->lazy, v->type);
+
+	// inline values need nothing more, and containers are only validated once at each depth
+	if (bitmap == 0)
+		return 1;
+
+	// hashable vectors are hashed and compared, so they are always validated all the way down
+	if (v->type == POINTLESS_VECTOR_VALUE_HASHABLE)
+		deep = 1;
+
+	if (deep && deep_bitmap) {
+		if (bm_is_set_atomic_(deep_bitmap, v->data.data_u32))
+			return 1;
+	} else if (bm_is_set_atomic_(bitmap, v->data.data_u32)) {
+		return 1;
+	}
+
+	if (!pointless_validate_heap_value(context, v, error))
+		return 0;
+
+	uint32_t i, n_items;
+	pointless_value_t* items;
+
+	switch (v->type) {
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+		case POINTLESS_VECTOR_VALUE:
+			n_items = pointless_reader_vector_n_items(context->p, v);
+			items = pointless_reader_vector_value(context->p, v);
+
+			for (i = 0; i < n_items; i++) {
+				if (deep) {
+					if (!pointless_validate_lazy_rec(context, &items[i], depth + 1, deep, error))
+						return 0;
+				} else {
+					// children must be valid references, their heap values are checked when touched
+					if (!pointless_validate_heap_ref(context, &items[i], error))
+						return 0;
+
+					if (!pointless_validate_inline_invariants(context, &items[i], error))
+						return 0;
+				}
+			}
+
+			// children are valid, so the stored hash can be checked
+			if (v->type == POINTLESS_VECTOR_VALUE_HASHABLE && !pointless_validate_hash_slot(context, v, error))
+				return 0;
+
+			break;
+		case POINTLESS_SET_VALUE:
+			if (!pointless_validate_lazy_set(context, v, depth, deep, error))
+				return 0;
+
+			break;
+		case POINTLESS_MAP_VALUE_VALUE:
+			if (!pointless_validate_lazy_map(context, v, depth, deep, error))
+				return 0;
+
+			break;
+	}
+
+	// only now is the container valid, so a reader on another thread which sees the bit can skip it
+	bm_set_atomic_(bitmap, v->data.data_u32);
+
+	if (deep && deep_bitmap)
+		bm_set_atomic_(deep_bitmap, v->data.data_u32);
+
+	return 1;
+}
+
+int32_t pointless_validate_lazy_init(pointless_validate_context_t* context, const char** error)
+{
+	pointless_t* p = context->p;
+
+	p->lazy = (pointless_validate_lazy_t*)pointless_calloc(1, sizeof(pointless_validate_lazy_t));
+
+	if (p->lazy == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	p->lazy->string_unicode = pointless_calloc(ICEIL(p->header->n_string_unicode, 8), 1);
+	p->lazy->vector = pointless_calloc(ICEIL(p->header->n_vector, 8), 1);
+	p->lazy->bitvector = pointless_calloc(ICEIL(p->header->n_bitvector, 8), 1);
+	p->lazy->set = pointless_calloc(ICEIL(p->header->n_set, 8), 1);
+	p->lazy->map = pointless_calloc(ICEIL(p->header->n_map, 8), 1);
+	p->lazy->vector_deep = pointless_calloc(ICEIL(p->header->n_vector, 8), 1);
+	p->lazy->map_deep = pointless_calloc(ICEIL(p->header->n_map, 8), 1);
+
+	if (p->lazy->string_unicode == 0 || p->lazy->vector == 0 || p->lazy->bitvector == 0 || p->lazy->set == 0 || p->lazy->map == 0 || p->lazy->vector_deep == 0 || p->lazy->map_deep == 0) {
+		*error = "out of memory";
+		return 0;
+	}
+
+	// the root is the only value not referenced by a container
+	if (!pointless_validate_heap_ref(context, &p->header->root, error))
+		return 0;
+
+	if (!pointless_validate_inline_invariants(context, &p->header->root, error))
+		return 0;
+
+	return 1;
+}
+
+int32_t pointless_validate_lazy(pointless_t* p, pointless_value_t* v, const char** error)
+{
+	// inline values have already been checked as part of their container
+	if (p->lazy == 0 || pointless_validate_lazy_bitmap(p->lazy, v->type) == 0)
+		return 1;
+
+	// a file which failed once, is invalid
+	const char* lazy_error = __atomic_load_n(&p->lazy->error, __ATOMIC_ACQUIRE);
+
+	if (lazy_error == 0) {
+		pointless_validate_context_t context;
+		context.p = p;
+		context.n_threads = 1;
+
+		// readers on other threads may be validating the same containers, which is harmless, the first error wins
+		if (!pointless_validate_lazy_rec(&context, v, 0, 0, &lazy_error)) {
+			__sync_bool_compare_and_swap(&p->lazy->error, 0, lazy_error);
+			lazy_error = __atomic_load_n(&p->lazy->error, __ATOMIC_ACQUIRE);
+		}
+	}
+
+	if (lazy_error) {
+		*error = lazy_error;
+		return 0;
+	}
+
+	return 1;
+}
+
+void pointless_validate_lazy_destroy(pointless_t* p)
+{
+	if (p->lazy == 0)
+		return;
+
+	pointless_free(p->lazy->string_unicode);
+	pointless_free(p->lazy->vector);
+	pointless_free(p->lazy->bitvector);
+	pointless_free(p->lazy->set);
+	pointless_free(p->lazy->map);
+	pointless_free(p->lazy->vector_deep);
+	pointless_free(p->lazy->map_deep);
+	pointless_free(p->lazy);
+
+	p->lazy = 0;
+}
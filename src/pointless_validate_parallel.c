@@ -0,0 +1,23 @@
+#include <pointless/pointless_validate.h>
+
+typedef struct {
+	pointless_validate_context_t* context;
+	pointless_validate_item_cb cb;
+	void* user;
+} pointless_validate_parallel_t;
+
+static int32_t pointless_validate_parallel_cb(uint32_t i, void* user, const char** error)
+{
+	pointless_validate_parallel_t* v = (pointless_validate_parallel_t*)user;
+	return (*v->cb)(v->context, i, v->user, error);
+}
+
+int32_t pointless_validate_parallel_for(pointless_validate_context_t* context, uint32_t n_items, pointless_validate_item_cb cb, void* user, const char** error)
+{
+	pointless_validate_parallel_t v;
+	v.context = context;
+	v.cb = cb;
+	v.user = user;
+
+	return pointless_parallel_for(n_items, context->n_threads, pointless_validate_parallel_cb, &v, error);
+}
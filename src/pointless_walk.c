@@ -30,38 +30,24 @@ static void pointless_walk_priv(pointless_t* p, pointless_value_t* v, uint32_t d
 		}
 	// sets
 	} else if (v->type == POINTLESS_SET_VALUE) {
-		pointless_value_t* hash_vector = pointless_set_hash_vector(p, v);
-		pointless_value_t* key_vector = pointless_set_key_vector(p, v);
+		uint32_t i, n_children = pointless_set_n_children(p, v);
 
-		pointless_walk_priv(p, hash_vector, depth + 1, cb, stop, user);
+		for (i = 0; i < n_children; i++) {
+			pointless_walk_priv(p, pointless_set_child_at(p, v, i), depth + 1, cb, stop, user);
 
-		if (*stop)
-			return;
-
-		pointless_walk_priv(p, key_vector, depth + 1, cb, stop, user);
-
-		if (*stop)
-			return;
+			if (*stop)
+				return;
+		}
 	// maps
 	} else if (v->type == POINTLESS_MAP_VALUE_VALUE) {
-		pointless_value_t* hash_vector = pointless_map_hash_vector(p, v);
-		pointless_value_t* key_vector = pointless_map_key_vector(p, v);
-		pointless_value_t* value_vector = pointless_map_value_vector(p, v);
-
-		pointless_walk_priv(p, hash_vector, depth + 1, cb, stop, user);
-
-		if (*stop)
-			return;
-
-		pointless_walk_priv(p, key_vector, depth + 1, cb, stop, user);
+		uint32_t i, n_children = pointless_map_n_children(p, v);
 
-		if (*stop)
-			return;
+		for (i = 0; i < n_children; i++) {
+			pointless_walk_priv(p, pointless_map_child_at(p, v, i), depth + 1, cb, stop, user);
 
-		pointless_walk_priv(p, value_vector, depth + 1, cb, stop, user);
-
-		if (*stop)
-			return;
+			if (*stop)
+				return;
+		}
 	}
 
 	// done
@@ -73,3 +59,9 @@ void pointless_walk(pointless_t* p, pointless_walk_cb cb, void* user)
 	pointless_value_t* root = pointless_root(p);
 	pointless_walk_priv(p, root, 0, cb, &stop, user);
 }
+
+void pointless_walk_from(pointless_t* p, pointless_value_t* v, pointless_walk_cb cb, void* user)
+{
+	uint32_t stop = 0;
+	pointless_walk_priv(p, v, 0, cb, &stop, user);
+}
@@ -1,8 +0,0 @@
-#include <Judy.h>
-
-int main()
-{
-	Pvoid_t visited_judy = 0;
-	Word_t* PValue = 0;
-	JLG(PValue, visited_judy, (Word_t)0);
-}
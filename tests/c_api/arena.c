@@ -0,0 +1,73 @@
+#include "test.h"
+
+#define ARENA_N_ALLOC 20000
+
+static void arena_failure(const char* what, uint32_t i)
+{
+	fprintf(stderr, "validate_arena(): %s, allocation %u\n", what, i);
+	exit(EXIT_FAILURE);
+}
+
+// small and big allocations, every third one rolled back, must keep their contents and alignment
+void validate_arena()
+{
+	pointless_arena_t arena;
+	uint8_t* buffers[ARENA_N_ALLOC];
+	size_t sizes[ARENA_N_ALLOC];
+	uint8_t fills[ARENA_N_ALLOC];
+	uint32_t i, n = 0;
+	size_t j;
+
+	pointless_arena_init(&arena);
+
+	for (i = 0; i < ARENA_N_ALLOC; i++) {
+		size_t n_bytes = (i % 1000 == 999) ? 300000 + i : 1 + i % 97;
+		uint8_t* p = (uint8_t*)pointless_arena_alloc(&arena, n_bytes);
+
+		if (p == 0)
+			arena_failure("out of memory", i);
+
+		if ((uintptr_t)p % POINTLESS_ARENA_ALIGN != 0)
+			arena_failure("misaligned", i);
+
+		memset(p, (int)(i & 0xFF), n_bytes);
+
+		if (i % 3 == 0) {
+			pointless_arena_rollback(&arena, p);
+		} else {
+			buffers[n] = p;
+			sizes[n] = n_bytes;
+			fills[n] = (uint8_t)(i & 0xFF);
+			n += 1;
+		}
+	}
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < sizes[i]; j++) {
+			if (buffers[i][j] != fills[i])
+				arena_failure("overwritten", i);
+		}
+	}
+
+	pointless_arena_destroy(&arena);
+}
+
+// sizes whose rounding or block header would wrap around must fail, and leave the arena usable
+void validate_arena_overflow()
+{
+	pointless_arena_t arena;
+	size_t sizes[] = {SIZE_MAX, SIZE_MAX - 1, SIZE_MAX - POINTLESS_ARENA_ALIGN + 1, SIZE_MAX - POINTLESS_ARENA_ALIGN, SIZE_MAX - 16};
+	uint32_t i;
+
+	pointless_arena_init(&arena);
+
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		if (pointless_arena_alloc(&arena, sizes[i]) != 0)
+			arena_failure("huge allocation succeeded", i);
+	}
+
+	if (pointless_arena_alloc(&arena, 16) == 0)
+		arena_failure("out of memory", i);
+
+	pointless_arena_destroy(&arena);
+}
@@ -1,12 +1,12 @@
 #include "test.h"
 
-void create_wrapper(const char* fname, create_cb cb)
+static void create_wrapper_(const char* fname, create_cb cb, void (*begin)(pointless_create_t* c))
 {
 	pointless_create_t c;
 	const char* error = 0;
 
 	clock_t t_0 = clock();
-	pointless_create_begin_64(&c);
+	(*begin)(&c);
 
 	(*cb)(&c);
 
@@ -20,6 +20,104 @@ void create_wrapper(const char* fname, create_cb cb)
 	printf("create time: %.2lfs\n", (double)(t_1 - t_0) / (double)CLOCKS_PER_SEC);
 }
 
+void create_wrapper(const char* fname, create_cb cb)
+{
+	create_wrapper_(fname, cb, pointless_create_begin_64);
+}
+
+static void pointless_create_begin_64_features_(pointless_create_t* c, uint32_t features)
+{
+	const char* error = 0;
+
+	if (!pointless_create_begin_64_features(c, features, &error)) {
+		fprintf(stderr, "pointless_create_begin_64_features() failure: %s\n", error);
+		exit(EXIT_FAILURE);
+	}
+}
+
+static void pointless_create_begin_64_checksum_interleaved(pointless_create_t* c)
+{
+	pointless_create_begin_64_features_(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_INTERLEAVED);
+}
+
+void create_wrapper_interleaved(const char* fname, create_cb cb)
+{
+	create_wrapper_(fname, cb, pointless_create_begin_64_checksum_interleaved);
+}
+
+static void pointless_create_begin_64_checksum_mphf(pointless_create_t* c)
+{
+	pointless_create_begin_64_features_(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_MPHF);
+}
+
+void create_wrapper_mphf(const char* fname, create_cb cb)
+{
+	create_wrapper_(fname, cb, pointless_create_begin_64_checksum_mphf);
+}
+
+static void pointless_create_begin_64_acyclic(pointless_create_t* c)
+{
+	pointless_create_begin_64(c);
+	pointless_create_begin_acyclic(c);
+}
+
+void create_wrapper_acyclic(const char* fname, create_cb cb)
+{
+	create_wrapper_(fname, cb, pointless_create_begin_64_acyclic);
+}
+
+static void pointless_create_begin_64_fasthash_interleaved(pointless_create_t* c)
+{
+	pointless_create_begin_64_features_(c, POINTLESS_FF_FEATURE_FASTHASH | POINTLESS_FF_FEATURE_INTERLEAVED);
+}
+
+void create_wrapper_fasthash(const char* fname, create_cb cb)
+{
+	create_wrapper_(fname, cb, pointless_create_begin_64_fasthash_interleaved);
+}
+
+static void pointless_create_begin_64_hash_slots_split(pointless_create_t* c)
+{
+	pointless_create_begin_64_features_(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_FASTHASH | POINTLESS_FF_FEATURE_HASH_SLOTS);
+}
+
+void create_wrapper_hash_slots(const char* fname, create_cb cb)
+{
+	create_wrapper_(fname, cb, pointless_create_begin_64_hash_slots_split);
+}
+
+static void pointless_create_begin_64_utf8_mphf(pointless_create_t* c)
+{
+	pointless_create_begin_64_features_(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_FASTHASH | POINTLESS_FF_FEATURE_HASH_SLOTS | POINTLESS_FF_FEATURE_UTF8 | POINTLESS_FF_FEATURE_MPHF);
+}
+
+void create_wrapper_utf8(const char* fname, create_cb cb)
+{
+	create_wrapper_(fname, cb, pointless_create_begin_64_utf8_mphf);
+}
+
+// stored hashes and utf-8 unicodes with the v1 string hash, and no checksums
+static void pointless_create_begin_64_features_hash_slots_interleaved_utf8(pointless_create_t* c)
+{
+	pointless_create_begin_64_features_(c, POINTLESS_FF_FEATURE_HASH_SLOTS | POINTLESS_FF_FEATURE_INTERLEAVED | POINTLESS_FF_FEATURE_UTF8);
+}
+
+void create_wrapper_features(const char* fname, create_cb cb)
+{
+	pointless_create_t c;
+	const char* error = 0;
+
+	// combinations which are not supported fail, and leave something which can be ended
+	if (pointless_create_begin_64_features(&c, POINTLESS_FF_FEATURE_INTERLEAVED | POINTLESS_FF_FEATURE_MPHF, &error) || error == 0) {
+		fprintf(stderr, "pointless_create_begin_64_features() accepted interleaved and mphf\n");
+		exit(EXIT_FAILURE);
+	}
+
+	pointless_create_end(&c);
+
+	create_wrapper_(fname, cb, pointless_create_begin_64_features_hash_slots_interleaved_utf8);
+}
+
 void query_wrapper(const char* fname, query_cb cb)
 {
 	pointless_t p;
@@ -39,6 +137,150 @@ void query_wrapper(const char* fname, query_cb cb)
 	pointless_close(&p);
 }
 
+typedef struct {
+	const char* error;
+	void* visited;
+} validate_lazy_state_t;
+
+static uint32_t validate_lazy_cb(pointless_t* p, pointless_value_t* v, uint32_t depth, void* user)
+{
+	validate_lazy_state_t* state = (validate_lazy_state_t*)user;
+
+	// children may only be dereferenced after their parent has been validated
+	if (!pointless_validate_lazy(p, v, &state->error))
+		return POINTLESS_WALK_STOP;
+
+	switch (v->type) {
+		case POINTLESS_VECTOR_VALUE:
+		case POINTLESS_VECTOR_VALUE_HASHABLE:
+		case POINTLESS_SET_VALUE:
+		case POINTLESS_MAP_VALUE_VALUE:
+			if (bm_is_set_(state->visited, pointless_container_id(p, v)))
+				return POINTLESS_WALK_MOVE_UP;
+
+			bm_set_(state->visited, pointless_container_id(p, v));
+			break;
+	}
+
+	return POINTLESS_WALK_VISIT_CHILDREN;
+}
+
+void validate_lazy_wrapper(const char* fname)
+{
+	pointless_t p;
+	validate_lazy_state_t state;
+	const char* error = 0;
+
+	if (!pointless_open_f_lazy_validate(&p, fname, &error)) {
+		fprintf(stderr, "pointless_open_f_lazy_validate() failure: %s\n", error);
+		exit(EXIT_FAILURE);
+	}
+
+	state.error = 0;
+	state.visited = pointless_calloc(ICEIL(pointless_n_containers(&p) + 1, 8), 1);
+
+	if (state.visited == 0) {
+		fprintf(stderr, "validate_lazy_wrapper(): out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+
+	clock_t t_0 = clock();
+	pointless_walk(&p, validate_lazy_cb, &state);
+	clock_t t_1 = clock();
+
+	if (state.error) {
+		fprintf(stderr, "pointless_validate_lazy() failure: %s\n", state.error);
+		exit(EXIT_FAILURE);
+	}
+
+	printf("lazy validate time: %.2lfs\n", (double)(t_1 - t_0) / (double)CLOCKS_PER_SEC);
+
+	pointless_free(state.visited);
+	pointless_close(&p);
+}
+
+#define VALIDATE_LAZY_MAX_THREADS 16
+
+typedef struct {
+	pointless_t* p;
+	validate_lazy_state_t state;
+} validate_lazy_thread_t;
+
+static void* validate_lazy_thread(void* user)
+{
+	validate_lazy_thread_t* thread = (validate_lazy_thread_t*)user;
+	pointless_walk(thread->p, validate_lazy_cb, &thread->state);
+	return 0;
+}
+
+// readers on several threads walk the same lazily validated file at once
+void validate_lazy_threads_wrapper(const char* fname, uint32_t n_threads)
+{
+	pointless_t p;
+	validate_lazy_thread_t threads[VALIDATE_LAZY_MAX_THREADS];
+	pthread_t thread_ids[VALIDATE_LAZY_MAX_THREADS];
+	const char* error = 0;
+	uint32_t i;
+
+	assert(n_threads <= VALIDATE_LAZY_MAX_THREADS);
+
+	if (!pointless_open_f_lazy_validate(&p, fname, &error)) {
+		fprintf(stderr, "pointless_open_f_lazy_validate() failure: %s\n", error);
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < n_threads; i++) {
+		threads[i].p = &p;
+		threads[i].state.error = 0;
+		threads[i].state.visited = pointless_calloc(ICEIL(pointless_n_containers(&p) + 1, 8), 1);
+
+		if (threads[i].state.visited == 0) {
+			fprintf(stderr, "validate_lazy_threads_wrapper(): out of memory\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	for (i = 0; i < n_threads; i++) {
+		if (pthread_create(&thread_ids[i], 0, validate_lazy_thread, &threads[i]) != 0) {
+			fprintf(stderr, "validate_lazy_threads_wrapper(): pthread_create() failure\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	for (i = 0; i < n_threads; i++)
+		pthread_join(thread_ids[i], 0);
+
+	for (i = 0; i < n_threads; i++) {
+		if (threads[i].state.error) {
+			fprintf(stderr, "pointless_validate_lazy() failure on thread %u: %s\n", i, threads[i].state.error);
+			exit(EXIT_FAILURE);
+		}
+
+		pointless_free(threads[i].state.visited);
+	}
+
+	pointless_close(&p);
+}
+
+void validate_parallel_wrapper(const char* fname, uint32_t n_threads)
+{
+	pointless_t p;
+	const char* error = 0;
+
+	clock_t t_0 = clock();
+
+	if (!pointless_open_f_parallel_validate(&p, fname, n_threads, &error)) {
+		fprintf(stderr, "pointless_open_f_parallel_validate() failure: %s\n", error);
+		exit(EXIT_FAILURE);
+	}
+
+	clock_t t_1 = clock();
+
+	printf("parallel validate time: %.2lfs\n", (double)(t_1 - t_0) / (double)CLOCKS_PER_SEC);
+
+	pointless_close(&p);
+}
+
 void create_tuple(pointless_create_t* c)
 {
 	// create vector
@@ -98,6 +340,120 @@ void create_simple(pointless_create_t* c)
 	pointless_create_set_root(c, vector_handle);
 }
 
+#define N_STRINGS 70
+
+// key i has i characters, so that every tail length of the string hash is covered
+static void string_map_key(uint32_t i, char* key)
+{
+	uint32_t j;
+
+	for (j = 0; j < i; j++)
+		key[j] = 'a' + (i + j) % 26;
+
+	key[i] = 0;
+}
+
+#define N_WIDE_STRINGS 16
+
+// key i has i + 1 code points, above 8 bits for even i, above 16 bits for odd i
+static void string_map_wide_key(uint32_t i, uint32_t* key)
+{
+	uint32_t j;
+
+	for (j = 0; j <= i; j++)
+		key[j] = ((i % 2) ? 0x10000 : 0x100) + i * 7 + j;
+
+	key[i + 1] = 0;
+}
+
+void create_string_map(pointless_create_t* c)
+{
+	const char* error = 0;
+	char key[N_STRINGS + 1];
+	uint32_t wide_key[N_WIDE_STRINGS + 1];
+	uint32_t i;
+
+	uint32_t map_handle = pointless_create_map(c);
+	CHECK_HANDLE(map_handle);
+
+	for (i = 0; i < N_STRINGS; i++) {
+		string_map_key(i, key);
+
+		// half of the keys are stored as 32-bit unicodes
+		uint32_t key_handle = (i % 2) ? pointless_create_unicode_ascii(c, key, &error) : pointless_create_string_ascii(c, (uint8_t*)key);
+		uint32_t value_handle = pointless_create_u32(c, i);
+		CHECK_HANDLE(key_handle);
+		CHECK_HANDLE(value_handle);
+
+		if (pointless_create_map_add(c, map_handle, key_handle, value_handle) == POINTLESS_CREATE_VALUE_FAIL) {
+			fprintf(stderr, "pointless_create_map_add(): out of memory\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	for (i = 0; i < N_WIDE_STRINGS; i++) {
+		string_map_wide_key(i, wide_key);
+
+		uint32_t key_handle = pointless_create_unicode_ucs4(c, wide_key);
+		uint32_t value_handle = pointless_create_u32(c, N_STRINGS + i);
+		CHECK_HANDLE(key_handle);
+		CHECK_HANDLE(value_handle);
+
+		if (pointless_create_map_add(c, map_handle, key_handle, value_handle) == POINTLESS_CREATE_VALUE_FAIL) {
+			fprintf(stderr, "pointless_create_map_add(): out of memory\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	pointless_create_set_root(c, map_handle);
+}
+
+void query_string_map(pointless_t* p)
+{
+	pointless_value_t* root = pointless_root(p);
+	char key[N_STRINGS + 1];
+	uint32_t unicode_key[N_STRINGS + 1];
+	uint32_t i, j, value;
+	pointless_value_t v;
+
+	for (i = 0; i < N_STRINGS; i++) {
+		string_map_key(i, key);
+
+		for (j = 0; j <= i; j++)
+			unicode_key[j] = (uint32_t)key[j];
+
+		if (!pointless_get_mapping_string_to_u32(p, root, key, &value) || value != i) {
+			fprintf(stderr, "string key %u not found\n", i);
+			exit(EXIT_FAILURE);
+		}
+
+		if (!pointless_get_mapping_unicode_to_u32(p, root, unicode_key, &value) || value != i) {
+			fprintf(stderr, "unicode key %u not found\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// the unicode helpers must hash their keys by code point, not as 8-bit strings
+	for (i = 0; i < N_WIDE_STRINGS; i++) {
+		string_map_wide_key(i, unicode_key);
+
+		if (!pointless_get_mapping_unicode_to_u32(p, root, unicode_key, &value) || value != N_STRINGS + i) {
+			fprintf(stderr, "wide unicode key %u not found\n", i);
+			exit(EXIT_FAILURE);
+		}
+
+		if (!pointless_get_mapping_unicode_to_value(p, root, unicode_key, &v) || v.type != POINTLESS_U32 || v.data.data_u32 != N_STRINGS + i) {
+			fprintf(stderr, "wide unicode key %u not found as value\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (pointless_get_mapping_string_to_u32(p, root, "not a key", &value)) {
+		fprintf(stderr, "missing string key found\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
 #define N_INTEGERS 10
 #define SET_DUPLICATES 0
 
@@ -192,6 +548,47 @@ void query_set(pointless_t* p)
 	}
 }
 
+void query_set_batch(pointless_t* p)
+{
+	pointless_value_t* set = pointless_root(p);
+	const char* error = 0;
+
+	if (set->type != POINTLESS_SET_VALUE) {
+		fprintf(stderr, "root is not a set\n");
+		exit(EXIT_FAILURE);
+	}
+
+	// every other key is missing
+	pointless_value_t keys[2 * N_INTEGERS];
+	pointless_value_t* kk[2 * N_INTEGERS];
+	uint32_t i;
+
+	for (i = 0; i < 2 * N_INTEGERS; i++)
+		keys[i] = (i % 2 == 0) ? pointless_value_create_as_read_u32(i / 2) : pointless_value_create_as_read_u32(N_INTEGERS + i);
+
+	pointless_reader_set_lookup_batch(p, set, keys, 2 * N_INTEGERS, kk, &error);
+
+	if (error) {
+		fprintf(stderr, "pointless_reader_set_lookup_batch(): %s\n", error);
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < 2 * N_INTEGERS; i++) {
+		pointless_value_t* expected = 0;
+		pointless_reader_set_lookup(p, set, &keys[i], &expected, &error);
+
+		if (error) {
+			fprintf(stderr, "pointless_reader_set_lookup(): %s\n", error);
+			exit(EXIT_FAILURE);
+		}
+
+		if (kk[i] != expected || (kk[i] == 0) != (i % 2 == 1)) {
+			fprintf(stderr, "batch lookup did not match single lookup for key %u\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
 void create_special_a(pointless_create_t* c)
 {
 	// following gave an error in Python wrapper
@@ -309,6 +706,73 @@ void create_special_c(pointless_create_t* c)
 	pointless_create_set_root(c, vectors[0]);
 }
 
+// longer than POINTLESS_MAX_DEPTH, so the cycle marker must not recurse
+#define DEEP_CYCLE_N 100000
+
+void create_deep_cycle(pointless_create_t* c)
+{
+	// v[0] -> v[1] -> ... -> v[N - 1] -> v[1]
+	uint32_t first = POINTLESS_CREATE_VALUE_FAIL, prev = POINTLESS_CREATE_VALUE_FAIL, i;
+
+	for (i = 0; i < DEEP_CYCLE_N; i++) {
+		uint32_t v = pointless_create_vector_value(c);
+
+		if (v == POINTLESS_CREATE_VALUE_FAIL) {
+			fprintf(stderr, "create_deep_cycle(): pointless_create_vector_value() failure\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if (i == 0)
+			pointless_create_set_root(c, v);
+		else if (pointless_create_vector_value_append(c, prev, v) == POINTLESS_CREATE_VALUE_FAIL) {
+			fprintf(stderr, "create_deep_cycle(): pointless_create_vector_value_append() failure\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if (i == 1)
+			first = v;
+
+		prev = v;
+	}
+
+	if (pointless_create_vector_value_append(c, prev, first) == POINTLESS_CREATE_VALUE_FAIL) {
+		fprintf(stderr, "create_deep_cycle(): pointless_create_vector_value_append() failure\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+void query_deep_cycle(const char* fname)
+{
+	pointless_t p;
+	const char* error = 0;
+	uint32_t i;
+
+	// too deep for validation
+	if (!pointless_open_f_skip_validate(&p, fname, &error)) {
+		fprintf(stderr, "query_deep_cycle(): pointless_open_f_skip_validate() failure: %s\n", error);
+		exit(EXIT_FAILURE);
+	}
+
+	pointless_value_t* v = pointless_root(&p);
+
+	// vectors in the cycle must not be hashable
+	for (i = 0; i < DEEP_CYCLE_N; i++) {
+		if (i >= 2 && v->type != POINTLESS_VECTOR_VALUE) {
+			fprintf(stderr, "query_deep_cycle(): vector %u is not POINTLESS_VECTOR_VALUE, but %u\n", i, v->type);
+			exit(EXIT_FAILURE);
+		}
+
+		if (pointless_reader_vector_n_items(&p, v) != 1) {
+			fprintf(stderr, "query_deep_cycle(): vector %u does not have a single item\n", i);
+			exit(EXIT_FAILURE);
+		}
+
+		v = pointless_reader_vector_value(&p, v);
+	}
+
+	pointless_close(&p);
+}
+
 #define SPECIAL_D_N 16
 #define SPECIAL_D_I 2
 
@@ -55,6 +55,7 @@ static void print_usage_exit()
 	fprintf(stderr, "   --test-performance\n");
 	fprintf(stderr, "   --measure-load-time pointless.map\n");
 	fprintf(stderr, "   --test-hash\n");
+	fprintf(stderr, "   --test-string-cmp\n");
 	fprintf(stderr, "   --dump-file pointless.map\n");
 	fprintf(stderr, "   --re-create pointless_in.map pointless_out.map\n");
 	exit(EXIT_FAILURE);
@@ -62,6 +63,10 @@ static void print_usage_exit()
 
 static void run_unit_test()
 {
+	validate_string_cmp();
+	validate_arena();
+	validate_arena_overflow();
+
 	create_wrapper("very_simple.map", create_very_simple);
 	print_map("very_simple.map");
 
@@ -73,6 +78,7 @@ static void run_unit_test()
 
 	create_wrapper("set.map", create_set);
 	query_wrapper("set.map", query_set);
+	query_wrapper("set.map", query_set_batch);
 	print_map("set.map");
 
 	create_wrapper("special_a.map", create_special_a);
@@ -88,12 +94,93 @@ static void run_unit_test()
 	print_map("special_d.map");
 	query_wrapper("special_d.map", query_special_d);
 	print_map("special_d.map");
+
+	create_wrapper("deep_cycle.map", create_deep_cycle);
+	query_deep_cycle("deep_cycle.map");
+
+	create_wrapper_acyclic("special_d_acyclic.map", create_special_d);
+	query_wrapper("special_d_acyclic.map", query_special_d);
+	validate_lazy_wrapper("special_d_acyclic.map");
+
+	validate_lazy_wrapper("set.map");
+	validate_lazy_wrapper("special_d.map");
+
+	validate_parallel_wrapper("set.map", 4);
+	validate_parallel_wrapper("special_d.map", 4);
+
+	create_wrapper_interleaved("set_interleaved.map", create_set);
+	query_wrapper("set_interleaved.map", query_set);
+	query_wrapper("set_interleaved.map", query_set_batch);
+	validate_lazy_wrapper("set_interleaved.map");
+
+	create_wrapper_interleaved("special_d_interleaved.map", create_special_d);
+	query_wrapper("special_d_interleaved.map", query_special_d);
+	print_map("special_d_interleaved.map");
+	validate_parallel_wrapper("special_d_interleaved.map", 4);
+
+	create_wrapper_mphf("set_mphf.map", create_set);
+	query_wrapper("set_mphf.map", query_set);
+	query_wrapper("set_mphf.map", query_set_batch);
+	validate_lazy_wrapper("set_mphf.map");
+
+	create_wrapper_mphf("special_d_mphf.map", create_special_d);
+	query_wrapper("special_d_mphf.map", query_special_d);
+	print_map("special_d_mphf.map");
+	validate_parallel_wrapper("special_d_mphf.map", 4);
+
+	create_wrapper("string_map.map", create_string_map);
+	query_wrapper("string_map.map", query_string_map);
+
+	create_wrapper_fasthash("string_map_fasthash.map", create_string_map);
+	query_wrapper("string_map_fasthash.map", query_string_map);
+	validate_parallel_wrapper("string_map_fasthash.map", 4);
+
+	create_wrapper_hash_slots("string_map_hash_slots.map", create_string_map);
+	query_wrapper("string_map_hash_slots.map", query_string_map);
+	validate_lazy_wrapper("string_map_hash_slots.map");
+	validate_parallel_wrapper("string_map_hash_slots.map", 4);
+
+	create_wrapper_hash_slots("special_d_hash_slots.map", create_special_d);
+	query_wrapper("special_d_hash_slots.map", query_special_d);
+	validate_lazy_wrapper("special_d_hash_slots.map");
+	validate_parallel_wrapper("special_d_hash_slots.map", 4);
+
+	create_wrapper_utf8("string_map_utf8.map", create_string_map);
+	query_wrapper("string_map_utf8.map", query_string_map);
+	validate_lazy_wrapper("string_map_utf8.map");
+	validate_parallel_wrapper("string_map_utf8.map", 4);
+
+	create_wrapper_features("special_d_features.map", create_special_d);
+	query_wrapper("special_d_features.map", query_special_d);
+	validate_lazy_wrapper("special_d_features.map");
+	validate_lazy_threads_wrapper("special_d_features.map", 8);
+	run_re_create("special_d_features.map", "special_d_features_recreated.map");
+	query_wrapper("special_d_features_recreated.map", query_special_d);
+
+	create_wrapper_features("string_map_features.map", create_string_map);
+	query_wrapper("string_map_features.map", query_string_map);
+	validate_lazy_wrapper("string_map_features.map");
+
+	validate_spill();
+	validate_output_buffer();
 }
 
 static void run_performance_test()
 {
 	create_wrapper("set_1M.map", create_1M_set);
 	query_wrapper("set_1M.map", query_1M_set);
+	query_wrapper("set_1M.map", query_1M_set_batch);
+	validate_parallel_wrapper("set_1M.map", 4);
+	validate_lazy_threads_wrapper("set_1M.map", 4);
+
+	create_wrapper_interleaved("set_1M_interleaved.map", create_1M_set);
+	query_wrapper("set_1M_interleaved.map", query_1M_set);
+	query_wrapper("set_1M_interleaved.map", query_1M_set_batch);
+
+	create_wrapper_mphf("set_1M_mphf.map", create_1M_set);
+	query_wrapper("set_1M_mphf.map", query_1M_set);
+	query_wrapper("set_1M_mphf.map", query_1M_set_batch);
+	validate_parallel_wrapper("set_1M_mphf.map", 4);
 }
 
 int main(int argc, char** argv)
@@ -105,6 +192,8 @@ int main(int argc, char** argv)
 			run_performance_test();
 		else if (strcmp(argv[1], "--test-hash") == 0)
 			validate_hash_semantics();
+		else if (strcmp(argv[1], "--test-string-cmp") == 0)
+			benchmark_string_cmp();
 		else
 			print_usage_exit();
 	} else if (argc == 3) {
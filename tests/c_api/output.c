@@ -0,0 +1,162 @@
+#include "test.h"
+
+#define OUTPUT_FNAME "output_buffer.map"
+
+static void output_failure(const char* what, const char* error)
+{
+	fprintf(stderr, "validate_output_buffer(): %s: %s\n", what, error ? error : "out of memory");
+	exit(EXIT_FAILURE);
+}
+
+// records the size the serializer asks for, and gives it a buffer of exactly that size, unless told to fail
+typedef struct {
+	uint32_t n_calls;
+	size_t n_bytes;
+	int fail;
+} output_alloc_t;
+
+static void* output_alloc(size_t n_bytes, void* user)
+{
+	output_alloc_t* a = (output_alloc_t*)user;
+	a->n_calls += 1;
+	a->n_bytes = n_bytes;
+
+	if (a->fail)
+		return 0;
+
+	return pointless_malloc(n_bytes > 0 ? n_bytes : 1);
+}
+
+static void* output_read_file(const char* fname, size_t* n_buffer)
+{
+	FILE* f = fopen(fname, "rb");
+	void* buffer = 0;
+	long n = 0;
+
+	if (f == 0 || fseek(f, 0, SEEK_END) != 0 || (n = ftell(f)) < 0 || fseek(f, 0, SEEK_SET) != 0)
+		output_failure("reading " OUTPUT_FNAME, "fopen/fseek/ftell failure");
+
+	buffer = pointless_malloc((size_t)n + 1);
+
+	if (buffer == 0 || fread(buffer, 1, (size_t)n, f) != (size_t)n)
+		output_failure("reading " OUTPUT_FNAME, "fread failure");
+
+	fclose(f);
+	*n_buffer = (size_t)n;
+	return buffer;
+}
+
+static void output_begin_features(pointless_create_t* c, uint32_t features)
+{
+	const char* error = 0;
+
+	if (!pointless_create_begin_64_features(c, features, &error))
+		output_failure("pointless_create_begin_64_features()", error);
+}
+
+static void pointless_create_begin_64_checksum(pointless_create_t* c)
+{
+	output_begin_features(c, POINTLESS_FF_FEATURE_CHECKSUM);
+}
+
+static void pointless_create_begin_64_fasthash_split(pointless_create_t* c)
+{
+	output_begin_features(c, POINTLESS_FF_FEATURE_FASTHASH);
+}
+
+static void pointless_create_begin_64_hash_slots_interleaved(pointless_create_t* c)
+{
+	output_begin_features(c, POINTLESS_FF_FEATURE_INTERLEAVED | POINTLESS_FF_FEATURE_FASTHASH | POINTLESS_FF_FEATURE_HASH_SLOTS);
+}
+
+static void pointless_create_begin_64_checksum_mphf_utf8(pointless_create_t* c)
+{
+	output_begin_features(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_MPHF | POINTLESS_FF_FEATURE_HASH_SLOTS | POINTLESS_FF_FEATURE_UTF8);
+}
+
+static void pointless_create_begin_64_checksum_interleaved(pointless_create_t* c)
+{
+	output_begin_features(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_INTERLEAVED | POINTLESS_FF_FEATURE_FASTHASH);
+}
+
+// the buffer outputs must be the same bytes as the file output, in a single allocation of exactly their size,
+// for both file format versions and several feature combinations, including the checksum trailer and the interleaved and mphf layouts
+void validate_output_buffer()
+{
+	void (*begins[])(pointless_create_t* c) = {
+		pointless_create_begin_64,
+		pointless_create_begin_64_checksum,
+		pointless_create_begin_64_fasthash_split,
+		pointless_create_begin_64_hash_slots_interleaved,
+		pointless_create_begin_64_checksum_mphf_utf8,
+		pointless_create_begin_64_checksum_interleaved
+	};
+
+	create_cb cbs[] = { create_simple, create_string_map, create_special_d };
+	uint32_t i, j;
+
+	for (i = 0; i < sizeof(begins) / sizeof(begins[0]); i++) {
+		for (j = 0; j < sizeof(cbs) / sizeof(cbs[0]); j++) {
+			pointless_create_t c;
+			const char* error = 0;
+			output_alloc_t a = { 0, 0, 0 };
+			void* f = 0;
+			void* b = 0;
+			void* m = 0;
+			size_t n_f = 0, n_b = 0, n_m = 0;
+
+			(*begins[i])(&c);
+			(*cbs[j])(&c);
+
+			if (!pointless_create_output_and_end_f(&c, OUTPUT_FNAME, &error))
+				output_failure("pointless_create_output_and_end_f()", error);
+
+			f = output_read_file(OUTPUT_FNAME, &n_f);
+
+			(*begins[i])(&c);
+			(*cbs[j])(&c);
+
+			if (!pointless_create_output_and_end_a(&c, output_alloc, &a, &b, &n_b, &error))
+				output_failure("pointless_create_output_and_end_a()", error);
+
+			(*begins[i])(&c);
+			(*cbs[j])(&c);
+
+			if (!pointless_create_output_and_end_b(&c, &m, &n_m, &error))
+				output_failure("pointless_create_output_and_end_b()", error);
+
+			if (a.n_calls != 1 || a.n_bytes != n_f || n_b != n_f || n_m != n_f) {
+				fprintf(stderr, "validate_output_buffer(): size differs, begin %u, values %u\n", i, j);
+				exit(EXIT_FAILURE);
+			}
+
+			if (memcmp(f, b, n_f) != 0 || memcmp(f, m, n_f) != 0) {
+				fprintf(stderr, "validate_output_buffer(): output differs, begin %u, values %u\n", i, j);
+				exit(EXIT_FAILURE);
+			}
+
+			// an allocator which can not provide the buffer is asked once, for the same size, and fails the output
+			output_alloc_t a_fail = { 0, 0, 1 };
+			void* buf = 0;
+			size_t n_buf = 0;
+
+			error = 0;
+			(*begins[i])(&c);
+			(*cbs[j])(&c);
+
+			if (pointless_create_output_and_end_a(&c, output_alloc, &a_fail, &buf, &n_buf, &error) || error == 0 || buf != 0) {
+				fprintf(stderr, "validate_output_buffer(): allocation failure not reported, begin %u, values %u\n", i, j);
+				exit(EXIT_FAILURE);
+			}
+
+			if (a_fail.n_calls != 1 || a_fail.n_bytes != n_f) {
+				fprintf(stderr, "validate_output_buffer(): failing allocation asked for the wrong size, begin %u, values %u\n", i, j);
+				exit(EXIT_FAILURE);
+			}
+
+			pointless_free(f);
+			pointless_free(b);
+			pointless_free(m);
+		}
+	}
+}
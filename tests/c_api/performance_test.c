@@ -77,3 +77,43 @@ void query_1M_set(pointless_t* p)
 		}
 	}
 }
+
+void query_1M_set_batch(pointless_t* p)
+{
+	pointless_value_t* set = pointless_root(p);
+	const char* error = 0;
+
+	if (set->type != POINTLESS_SET_VALUE) {
+		fprintf(stderr, "query_1M_set_batch(): root is not a set\n");
+		exit(EXIT_FAILURE);
+	}
+
+	pointless_value_t* keys = (pointless_value_t*)pointless_malloc(sizeof(pointless_value_t) * ONE_MILLION);
+	pointless_value_t** kk = (pointless_value_t**)pointless_malloc(sizeof(pointless_value_t*) * ONE_MILLION);
+	uint32_t i;
+
+	if (keys == 0 || kk == 0) {
+		fprintf(stderr, "query_1M_set_batch(): out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < ONE_MILLION; i++)
+		keys[i] = pointless_value_create_as_read_u32(i);
+
+	pointless_reader_set_lookup_batch(p, set, keys, ONE_MILLION, kk, &error);
+
+	if (error) {
+		fprintf(stderr, "query_1M_set_batch(): pointless_reader_set_lookup_batch() failure: %s\n", error);
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < ONE_MILLION; i++) {
+		if (kk[i] == 0) {
+			fprintf(stderr, "query_1M_set_batch(): set does not contain the expected value\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	pointless_free(keys);
+	pointless_free(kk);
+}
@@ -0,0 +1,203 @@
+#include "test.h"
+
+#define SPILL_N_STRINGS 3000
+#define SPILL_N_BIG (3 * 1024 * 1024)
+
+static void spill_failure(const char* what, const char* error)
+{
+	fprintf(stderr, "validate_spill(): %s: %s\n", what, error ? error : "out of memory");
+	exit(EXIT_FAILURE);
+}
+
+static void spill_append(pointless_create_t* c, uint32_t vector, uint32_t v)
+{
+	CHECK_HANDLE(v);
+
+	if (pointless_create_vector_value_append(c, vector, v) == POINTLESS_CREATE_VALUE_FAIL)
+		spill_failure("pointless_create_vector_value_append()", 0);
+}
+
+// duplicate strings and bitvectors, unicodes and strings with the same text, string keys in sets and maps, and
+// buffers which are larger than the spill file write buffer
+static void create_spill_values(pointless_create_t* c)
+{
+	const char* error = 0;
+	char key[32];
+	uint32_t bits[4];
+	uint32_t i, j;
+
+	uint32_t root = pointless_create_vector_value(c);
+	uint32_t set = pointless_create_set(c);
+	uint32_t map = pointless_create_map(c);
+	CHECK_HANDLE(root);
+	CHECK_HANDLE(set);
+	CHECK_HANDLE(map);
+
+	for (i = 0; i < SPILL_N_STRINGS; i++) {
+		sprintf(key, "key %u", i % (SPILL_N_STRINGS / 3));
+		spill_append(c, root, pointless_create_string_ascii(c, (uint8_t*)key));
+		spill_append(c, root, pointless_create_unicode_ascii(c, key, &error));
+
+		sprintf(key, "set %u", i);
+		uint32_t s = (i % 2) ? pointless_create_unicode_ascii(c, key, &error) : pointless_create_string_ascii(c, (uint8_t*)key);
+		CHECK_HANDLE(s);
+
+		if (pointless_create_set_add(c, set, s) == POINTLESS_CREATE_VALUE_FAIL)
+			spill_failure("pointless_create_set_add()", 0);
+
+		for (j = 0; j < 4; j++)
+			bits[j] = (i % 500) * 2654435761U + j * 40503U;
+
+		uint32_t b = (i % 3) ? pointless_create_bitvector(c, bits, 100) : pointless_create_bitvector_no_normalize(c, bits, 100);
+		uint32_t v = pointless_create_u32(c, i);
+		CHECK_HANDLE(b);
+		CHECK_HANDLE(v);
+
+		if (i < 500 && pointless_create_map_add(c, map, b, v) == POINTLESS_CREATE_VALUE_FAIL)
+			spill_failure("pointless_create_map_add()", 0);
+
+		spill_append(c, root, b);
+	}
+
+	uint8_t* big = (uint8_t*)pointless_malloc(SPILL_N_BIG + 1);
+
+	if (big == 0)
+		spill_failure("big string", 0);
+
+	for (i = 0; i < SPILL_N_BIG; i++)
+		big[i] = (uint8_t)('a' + i % 26);
+
+	big[SPILL_N_BIG] = 0;
+
+	spill_append(c, root, pointless_create_string_ascii(c, big));
+	spill_append(c, root, pointless_create_string_ascii(c, (uint8_t*)""));
+	spill_append(c, root, pointless_create_string_ascii(c, big));
+	spill_append(c, root, set);
+	spill_append(c, root, map);
+
+	pointless_free(big);
+
+	pointless_create_set_root(c, root);
+}
+
+// threshold is that of the file backing, or SIZE_MAX for none
+static void* spill_output(void (*begin)(pointless_create_t* c), create_cb cb, int spill, size_t threshold, uint32_t n_threads, size_t* n_buffer)
+{
+	pointless_create_t c;
+	const char* error = 0;
+	void* buffer = 0;
+
+	(*begin)(&c);
+	pointless_create_begin_parallel(&c, n_threads);
+
+	if (spill && !pointless_create_begin_spill(&c, 0, &error))
+		spill_failure("pointless_create_begin_spill()", error);
+
+	if (threshold != SIZE_MAX && !pointless_create_begin_file_backing(&c, 0, threshold, &error))
+		spill_failure("pointless_create_begin_file_backing()", error);
+
+	(*cb)(&c);
+
+	if (!pointless_create_output_and_end_b(&c, &buffer, n_buffer, &error))
+		spill_failure("pointless_create_output_and_end_b()", error);
+
+	return buffer;
+}
+
+static void spill_begin_features(pointless_create_t* c, uint32_t features)
+{
+	const char* error = 0;
+
+	if (!pointless_create_begin_64_features(c, features, &error))
+		spill_failure("pointless_create_begin_64_features()", error);
+}
+
+static void pointless_create_begin_64_checksum_interleaved(pointless_create_t* c)
+{
+	spill_begin_features(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_INTERLEAVED);
+}
+
+static void pointless_create_begin_64_checksum_mphf(pointless_create_t* c)
+{
+	spill_begin_features(c, POINTLESS_FF_FEATURE_CHECKSUM | POINTLESS_FF_FEATURE_MPHF);
+}
+
+static void pointless_create_begin_64_hash_slots_interleaved(pointless_create_t* c)
+{
+	spill_begin_features(c, POINTLESS_FF_FEATURE_INTERLEAVED | POINTLESS_FF_FEATURE_FASTHASH | POINTLESS_FF_FEATURE_HASH_SLOTS);
+}
+
+static void pointless_create_begin_64_utf8_split(pointless_create_t* c)
+{
+	spill_begin_features(c, POINTLESS_FF_FEATURE_FASTHASH | POINTLESS_FF_FEATURE_HASH_SLOTS | POINTLESS_FF_FEATURE_UTF8);
+}
+
+// arrays past the threshold move to a file mapping, and keep their contents while it grows
+static void validate_file_backing()
+{
+	pointless_dynarray_backing_t backing = { 0, 1000 };
+	pointless_dynarray_t a;
+	uint32_t i;
+
+	pointless_dynarray_init(&a, sizeof(uint32_t));
+	pointless_dynarray_set_backing(&a, &backing);
+
+	for (i = 0; i < 1000000; i++) {
+		if (!pointless_dynarray_push(&a, &i))
+			spill_failure("pointless_dynarray_push()", 0);
+
+		if (a.is_mapped != (pointless_dynarray_n_heap_bytes(&a) > backing.threshold))
+			spill_failure("file backing", "mapped at the wrong size");
+	}
+
+	if (!pointless_dynarray_resize(&a, 2000000))
+		spill_failure("pointless_dynarray_resize()", 0);
+
+	for (i = 0; i < 2000000; i++) {
+		if (pointless_dynarray_ITEM_AT(uint32_t, &a, i) != ((i < 1000000) ? i : 0))
+			spill_failure("file backing", "lost an item");
+	}
+
+	pointless_dynarray_destroy(&a);
+}
+
+// spilled buffers, and arrays in file mappings, must give the same file as when everything is kept in memory
+void validate_spill()
+{
+	void (*begins[])(pointless_create_t* c) = {
+		pointless_create_begin_64,
+		pointless_create_begin_64_checksum_interleaved,
+		pointless_create_begin_64_checksum_mphf,
+		pointless_create_begin_64_hash_slots_interleaved,
+		pointless_create_begin_64_utf8_split
+	};
+
+	create_cb cbs[] = { create_spill_values, create_string_map, create_special_d };
+	size_t thresholds[] = { SIZE_MAX, 0, 4096 };
+	uint32_t i, j;
+
+	validate_file_backing();
+
+	for (i = 0; i < sizeof(begins) / sizeof(begins[0]); i++) {
+		for (j = 0; j < sizeof(cbs) / sizeof(cbs[0]); j++) {
+			size_t n_a = 0, n_b = 0;
+			void* a = spill_output(begins[i], cbs[j], 0, SIZE_MAX, 1, &n_a);
+			void* b = spill_output(begins[i], cbs[j], (i + j) % 3 != 1, thresholds[(i + j) % 3], (i % 2) ? 4 : 1, &n_b);
+
+			if (n_a != n_b || memcmp(a, b, n_a) != 0) {
+				fprintf(stderr, "validate_spill(): output differs, begin %u, values %u\n", i, j);
+				exit(EXIT_FAILURE);
+			}
+
+			pointless_t p;
+			const char* error = 0;
+
+			if (!pointless_open_b(&p, b, n_b, &error))
+				spill_failure("pointless_open_b()", error);
+
+			pointless_close(&p);
+			pointless_free(a);
+			pointless_free(b);
+		}
+	}
+}
@@ -0,0 +1,143 @@
+#include "test.h"
+
+// longest key length, and number of comparisons per benchmarked key length
+#define STRING_CMP_MAX_LEN 256
+#define STRING_CMP_N_ITER 2000000
+
+// one code point at a time, as the reference for the vectorized kernels
+#define STRING_CMP_REFERENCE(a, b) while ((uint32_t)(*(a)) == (uint32_t)(*(b))) { if (*(a) == 0) return 0; (a)++; (b)++;} return SIMPLE_CMP(*(a), *(b));
+
+static int32_t reference_8_8(uint8_t* a, uint8_t* b)
+	{ STRING_CMP_REFERENCE(a, b); }
+static int32_t reference_8_32(uint8_t* a, uint32_t* b)
+	{ STRING_CMP_REFERENCE(a, b); }
+static int32_t reference_16_16(uint16_t* a, uint16_t* b)
+	{ STRING_CMP_REFERENCE(a, b); }
+static int32_t reference_32_32(uint32_t* a, uint32_t* b)
+	{ STRING_CMP_REFERENCE(a, b); }
+
+static int32_t reference_8_8_n(uint8_t* a, uint8_t* b, size_t n_b)
+{
+	size_t n_ = 0;
+
+	while (*a && n_ < n_b && *a == *b) {
+		a++; b++; n_++;
+	}
+
+	if (*a == 0 && n_ == n_b) return 0;
+	if (*a == 0)              return -1;
+	if (n_ == n_b)            return 1;
+	return SIMPLE_CMP(*a, *b);
+}
+
+static void string_cmp_failure(const char* kernel, size_t n_a, size_t n_b, size_t diff)
+{
+	fprintf(stderr, "validate_string_cmp(): %s mismatch, n_a %zu, n_b %zu, diff %zu\n", kernel, n_a, n_b, diff);
+	exit(EXIT_FAILURE);
+}
+
+// compares every pair of lengths, with and without a differing code point, against the reference
+void validate_string_cmp()
+{
+	// strings end at the end of a page, so a load past the terminating zero would fault
+	size_t page = 4096, n_pages = 4;
+	uint8_t* buffer = (uint8_t*)aligned_alloc(page, page * n_pages);
+	uint8_t* a_8 = 0, *b_8 = 0;
+	uint16_t a_16[STRING_CMP_MAX_LEN + 1], b_16[STRING_CMP_MAX_LEN + 1];
+	uint32_t a_32[STRING_CMP_MAX_LEN + 1], b_32[STRING_CMP_MAX_LEN + 1];
+	size_t n_a, n_b, diff, i;
+
+	if (buffer == 0) {
+		fprintf(stderr, "validate_string_cmp(): out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (n_a = 0; n_a < 70; n_a++) {
+		for (n_b = 0; n_b < 70; n_b++) {
+			for (diff = 0; diff <= n_a; diff++) {
+				a_8 = buffer + page * 2 - (n_a + 1);
+				b_8 = buffer + page * 4 - (n_b + 1);
+
+				for (i = 0; i <= n_a; i++)
+					a_8[i] = a_16[i] = a_32[i] = (i == n_a) ? 0 : (uint8_t)('a' + i % 26);
+
+				for (i = 0; i <= n_b; i++)
+					b_8[i] = b_16[i] = b_32[i] = (i == n_b) ? 0 : (uint8_t)('a' + i % 26);
+
+				// diff == n_a leaves the strings as prefixes of each other
+				if (diff < n_a) {
+					a_8[diff] = 0xE9;
+					a_16[diff] = 0x20AC;
+					a_32[diff] = 0x1F600;
+				}
+
+				if (pointless_cmp_string_8_8(a_8, b_8) != reference_8_8(a_8, b_8))
+					string_cmp_failure("8_8", n_a, n_b, diff);
+
+				if (pointless_cmp_string_8_32(a_8, b_32) != reference_8_32(a_8, b_32))
+					string_cmp_failure("8_32", n_a, n_b, diff);
+
+				if (pointless_cmp_string_16_16(a_16, b_16) != reference_16_16(a_16, b_16))
+					string_cmp_failure("16_16", n_a, n_b, diff);
+
+				if (pointless_cmp_string_32_32(a_32, b_32) != reference_32_32(a_32, b_32))
+					string_cmp_failure("32_32", n_a, n_b, diff);
+
+				if (pointless_cmp_string_32_8(a_32, b_8) != -reference_8_32(b_8, a_32))
+					string_cmp_failure("32_8", n_a, n_b, diff);
+
+				if (pointless_cmp_string_8_8_n(a_8, b_8, n_b) != reference_8_8_n(a_8, b_8, n_b))
+					string_cmp_failure("8_8_n", n_a, n_b, diff);
+
+				if (pointless_cmp_string_32_8_n(a_32, b_8, n_b) != reference_8_8_n(a_8, b_8, n_b))
+					string_cmp_failure("32_8_n", n_a, n_b, diff);
+			}
+		}
+	}
+
+	free(buffer);
+}
+
+// time equal keys of growing length, which is the cost of a successful hash probe
+void benchmark_string_cmp()
+{
+	static uint8_t a_8[STRING_CMP_MAX_LEN + 1], b_8[STRING_CMP_MAX_LEN + 1];
+	static uint32_t b_32[STRING_CMP_MAX_LEN + 1];
+	size_t lengths[] = {4, 8, 16, 32, 64, 128, 256};
+	size_t i, j, k;
+	volatile int32_t sink = 0;
+
+	for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+		for (j = 0; j <= lengths[i]; j++)
+			a_8[j] = b_8[j] = b_32[j] = (j == lengths[i]) ? 0 : (uint8_t)('a' + j % 26);
+
+		clock_t t_0 = clock();
+
+		for (k = 0; k < STRING_CMP_N_ITER; k++)
+			sink += reference_8_8(a_8, b_8);
+
+		clock_t t_1 = clock();
+
+		for (k = 0; k < STRING_CMP_N_ITER; k++)
+			sink += pointless_cmp_string_8_8(a_8, b_8);
+
+		clock_t t_2 = clock();
+
+		for (k = 0; k < STRING_CMP_N_ITER; k++)
+			sink += reference_8_32(a_8, b_32);
+
+		clock_t t_3 = clock();
+
+		for (k = 0; k < STRING_CMP_N_ITER; k++)
+			sink += pointless_cmp_string_8_32(a_8, b_32);
+
+		clock_t t_4 = clock();
+
+		printf("INFO: length %3zu: 8_8 %.3f -> %.3f, 8_32 %.3f -> %.3f\n", lengths[i],
+			(double)(t_1 - t_0) / (double)CLOCKS_PER_SEC,
+			(double)(t_2 - t_1) / (double)CLOCKS_PER_SEC,
+			(double)(t_3 - t_2) / (double)CLOCKS_PER_SEC,
+			(double)(t_4 - t_3) / (double)CLOCKS_PER_SEC
+		);
+	}
+}
@@ -14,26 +14,56 @@
 // hash validator
 void validate_hash_semantics();
 
+// string comparison kernels
+void validate_string_cmp();
+void benchmark_string_cmp();
+
+// create-time arena
+void validate_arena();
+void validate_arena_overflow();
+
+// create-time spill file
+void validate_spill();
+
+// buffer output, against file output
+void validate_output_buffer();
+
 // create/query test-cases
 typedef void (*create_cb)(pointless_create_t* c);
 typedef void (*query_cb)(pointless_t* p);
 
 void create_wrapper(const char* fname, create_cb cb);
+void create_wrapper_interleaved(const char* fname, create_cb cb);
+void create_wrapper_mphf(const char* fname, create_cb cb);
+void create_wrapper_fasthash(const char* fname, create_cb cb);
+void create_wrapper_hash_slots(const char* fname, create_cb cb);
+void create_wrapper_utf8(const char* fname, create_cb cb);
+void create_wrapper_features(const char* fname, create_cb cb);
+void create_wrapper_acyclic(const char* fname, create_cb cb);
 void query_wrapper(const char* fname, query_cb cb);
+void validate_lazy_wrapper(const char* fname);
+void validate_lazy_threads_wrapper(const char* fname, uint32_t n_threads);
+void validate_parallel_wrapper(const char* fname, uint32_t n_threads);
 
 void create_tuple(pointless_create_t* c);
 void create_very_simple(pointless_create_t* c);
 void create_simple(pointless_create_t* c);
 void create_set(pointless_create_t* c);
 void query_set(pointless_t* p);
+void query_set_batch(pointless_t* p);
+void create_string_map(pointless_create_t* c);
+void query_string_map(pointless_t* p);
 void create_special_a(pointless_create_t* c);
 void create_special_b(pointless_create_t* c);
 void create_special_c(pointless_create_t* c);
 void create_special_d(pointless_create_t* c);
+void create_deep_cycle(pointless_create_t* c);
+void query_deep_cycle(const char* fname);
 void query_special_d(pointless_t* p);
 
 // performance tests
 void create_1M_set(pointless_create_t* c);
 void query_1M_set(pointless_t* p);
+void query_1M_set_batch(pointless_t* p);
 
 #endif
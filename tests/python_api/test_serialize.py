@@ -1,6 +1,6 @@
 #!/usr/bin/python
 
-import random, pointless
+import os, random, struct, threading, pointless
 
 from twisted.trial import unittest
 
@@ -80,3 +80,537 @@ class TestSerialize(unittest.TestCase):
 		self.assertEqual(v[0], a)
 		self.assertEqual(v[1], b)
 		self.assertEqual(v[2], c)
+
+	def testAstralStrings(self):
+		# strings with code points above 16 bits are stored as 32-bit unicodes, not truncated to 8 bits, in every format
+		strings = ['\U00010000', 'a\U0010ffffb', '\U0001f600' * 10, 'x' * 50 + '\U00020000']
+		v = {'strings': strings, 'map': dict((s, i) for i, s in enumerate(strings))}
+
+		for kwargs in [{}, {'unwiden_strings': True}, {'fasthash': True}]:
+			root = pointless.Pointless(pointless.serialize_to_buffer(v, **kwargs)).GetRoot()
+			self.assertEqual(list(root['strings']), strings)
+			self.assertEqual(sorted(root['map'].keys()), sorted(strings))
+			self.assertTrue(all(root['map'][s] == i for i, s in enumerate(strings)))
+			del root
+
+	def testUtf8(self):
+		# ascii, latin-1, 16-bit, astral and lone surrogate code points, of every utf-8 width
+		strings = ['', 'ascii', 'caf\xe9', '\u0101\u07ff\u0800', '\uffff\U00010000', '\U0010ffff' * 3, 'a\ud800b', 'x' * 100 + '\u20ac']
+		v = {'strings': strings, 'map': dict((s, i) for i, s in enumerate(strings)), 'set': set(strings), 'tuple': tuple(strings)}
+
+		# utf-8 needs neither the v2 string hash nor stored hashes, and saves space on its own
+		for kwargs in [{}, {'fasthash': True}, {'hash_slots': True}]:
+			buffer = pointless.serialize_to_buffer(v, utf8 = True, **kwargs)
+			self.assertLess(len(buffer), len(pointless.serialize_to_buffer(v, **kwargs)))
+
+			for validate in [True, 'lazy', False]:
+				p = pointless.Pointless(buffer, validate = validate)
+				root = p.GetRoot()
+				self.assertEqual(list(root['strings']), strings)
+				self.assertEqual(sorted(root['strings']), sorted(strings))
+				self.assertEqual(root['tuple'], root['tuple'])
+
+				for i, s in enumerate(strings):
+					self.assertEqual(root['map'][s], i)
+					self.assertTrue(s in root['set'])
+					self.assertEqual(pointless.pointless_cmp(root['strings'][i], s), 0)
+
+				self.assertFalse('caf\xe8' in root['set'])
+				self.assertEqual(pointless.pointless_cmp(root['strings'], strings), 0)
+				self.assertEqual(pointless.pointless_cmp(root['strings'], strings[:-1] + ['x' * 100 + '\u20ad']), -1)
+				del root, p
+
+		# strings and unicodes from older versions compare equal to utf-8 ones
+		p_old = pointless.Pointless(pointless.serialize_to_buffer(v))
+		p_new = pointless.Pointless(pointless.serialize_to_buffer(v, utf8 = True))
+		self.assertEqual(list(p_old.GetRoot()['strings']), list(p_new.GetRoot()['strings']))
+		self.assertEqual(pointless.pointless_cmp(p_old.GetRoot()['strings'], p_new.GetRoot()['strings']), 0)
+		self.assertEqual(pointless.pointless_cmp(p_new.GetRoot()['strings'], p_old.GetRoot()['strings']), 0)
+
+		fname = 'test_utf8.map'
+		pointless.serialize(v, fname, utf8 = True, checksums = True)
+		pointless.Pointless(fname).VerifyChecksums()
+
+	def testFormatFeatures(self):
+		v = {'a': ['b', '\u20ac', ('c', 1)], 'd': set(['e', 'f']), 'g': {'h': 'i'}}
+		default = pointless.serialize_to_buffer(v)
+		features = ['checksums', 'interleaved', 'mphf', 'fasthash', 'hash_slots', 'utf8']
+
+		# each feature only turns on itself, so every combination reads back
+		for i in range(1 << len(features)):
+			kwargs = dict((f, True) for j, f in enumerate(features) if i & (1 << j))
+
+			if 'interleaved' in kwargs and 'mphf' in kwargs:
+				self.assertRaises(ValueError, pointless.serialize_to_buffer, v, **kwargs)
+				continue
+
+			buffer = pointless.serialize_to_buffer(v, **kwargs)
+
+			for validate in [True, 'lazy']:
+				root = pointless.Pointless(buffer, validate = validate).GetRoot()
+				self.assertEqual(pointless.pointless_cmp(root['a'], v['a']), 0)
+				self.assertTrue('e' in root['d'] and 'x' not in root['d'])
+				self.assertEqual(root['g']['h'], 'i')
+				del root
+
+			p = pointless.Pointless(buffer)
+
+			if 'checksums' in kwargs:
+				p.VerifyChecksums()
+			else:
+				self.assertRaises(ValueError, p.VerifyChecksums)
+
+			del p
+
+		# no feature keeps the old version, fast hashing alone adds nothing but its bit in the version
+		fasthash = pointless.serialize_to_buffer(v, fasthash = True)
+		self.assertEqual(bytes(default)[28:32], b'\x02\x00\x00\x00')
+		self.assertEqual(bytes(fasthash)[28:32], b'\x03\x00\x08\x00')
+		self.assertEqual(bytes(pointless.serialize_to_buffer(v, utf8 = True))[28:32], b'\x03\x00\x20\x00')
+		self.assertEqual(len(fasthash), len(default))
+		self.assertGreater(len(pointless.serialize_to_buffer(v, checksums = True)), len(default))
+
+		# feature bits are only read from version 3, and there is no later version
+		for version in [b'\x02\x00\x08\x00', b'\x04\x00\x00\x00', b'\x09\x00\x08\x00']:
+			buffer = bytearray(fasthash)
+			buffer[28:32] = version
+			self.assertRaises(ValueError, pointless.Pointless, bytes(buffer))
+
+	def testSerializeToBuffer(self):
+		fname = 'test_serialize_to_buffer.map'
+		v = [list(SimpleSerializeTestCases()), {'a': ['b', '\u20ac'], 'c': set(['d', ('e', 1)])}]
+		features = ['checksums', 'interleaved', 'mphf', 'fasthash', 'hash_slots', 'utf8']
+
+		# buffers hold exactly the bytes of the file, checksum trailer and hash table layouts included
+		for i in range(1 << len(features)):
+			kwargs = dict((f, True) for j, f in enumerate(features) if i & (1 << j))
+
+			if 'interleaved' in kwargs and 'mphf' in kwargs:
+				continue
+
+			pointless.serialize(v, fname, **kwargs)
+
+			with open(fname, 'rb') as f:
+				f_bytes = f.read()
+
+			self.assertEqual(bytes(pointless.serialize_to_buffer(v, **kwargs)), f_bytes)
+			self.assertEqual(bytes(pointless.serialize_to_bytearray(v, **kwargs)), f_bytes)
+
+	def testLazyValidate(self):
+		fname = 'test_lazy_validate.map'
+
+		for v in SimpleSerializeTestCases():
+			pointless.serialize(v, fname)
+			a = pointless.Pointless(fname).GetRoot()
+			b = pointless.Pointless(fname, validate = 'lazy').GetRoot()
+			self.assertEqual(str(a), str(b))
+			del a, b
+
+		v = {'a': [1, 2, (3, 'b')], (4, 'c'): set([5, 6]), 'd': {'e': 7}}
+		pointless.serialize(v, fname)
+		p = pointless.Pointless(fname, validate = 'lazy')
+		root = p.GetRoot()
+		self.assertEqual(root['a'][2][1], 'b')
+		self.assertEqual(sorted(root[(4, 'c')]), [5, 6])
+		self.assertEqual(root['d']['e'], 7)
+		self.assertEqual(pointless.pointless_cmp(root['a'], [1, 2, (3, 'b')]), 0)
+		del root, p
+
+		self.assertRaises(ValueError, pointless.Pointless, fname, validate = 'eager')
+
+	def testLazyValidateCorrupted(self):
+		def corrupted(v, **kwargs):
+			# the unicode 'abcdefgh' claims to be much longer than the heap
+			buffer = pointless.serialize_to_bytearray(v, **kwargs)
+			i = buffer.find(b'abcdefgh') - 4
+			buffer[i:i + 4] = struct.pack('<I', 0x7ffffff0)
+			return buffer
+
+		# every vector which is not part of a cycle is hashable, and validated all the way down, so the
+		# first touch of the root finds the corrupted unicode, wherever it is, and the file stays invalid
+		for v in [{'a': 'abcdefgh'}, {'abcdefgh': 1}, set(['abcdefgh']), ['abcdefgh', 1], [{'b': ('abcdefgh',)}]]:
+			buffer = corrupted(v)
+			self.assertRaises(IOError, pointless.Pointless, buffer)
+			p = pointless.Pointless(buffer, validate = 'lazy')
+			self.assertRaises(ValueError, p.GetRoot)
+			self.assertRaises(ValueError, p.GetRoot)
+			del p
+
+		# only vectors in cycles are value vectors, so turn the reference to t held by the map into one: touched
+		# as a map value, only its children references are checked, but it is validated again all the way down
+		# when it is reached as a set key, which is hashed and compared
+		t = ('abcdefgh',)
+		buffer = corrupted({'t': t, 's': set([t])}, interleaved = True)
+		value_vector = []
+
+		for i in range(0, len(buffer) - 8, 4):
+			if buffer[i:i + 8] == struct.pack('<II', 1, 1):
+				b = bytearray(buffer)
+				b[i:i + 8] = struct.pack('<II', 0, 1)
+
+				try:
+					pointless.Pointless(b, validate = 'lazy').GetRoot()['t']
+					value_vector.append(b)
+				except ValueError:
+					pass
+
+		self.assertEqual(len(value_vector), 1)
+		self.assertRaises(IOError, pointless.Pointless, value_vector[0])
+		root = pointless.Pointless(value_vector[0], validate = 'lazy').GetRoot()
+		self.assertEqual(len(root['t']), 1)
+		self.assertRaises(ValueError, lambda: root['s'])
+		del root
+
+	def testParallelValidate(self):
+		fname = 'test_parallel_validate.map'
+
+		for v in SimpleSerializeTestCases():
+			pointless.serialize(v, fname)
+			a = pointless.Pointless(fname).GetRoot()
+			b = pointless.Pointless(fname, validate_threads = 4).GetRoot()
+			self.assertEqual(str(a), str(b))
+			del a, b
+
+		v = dict(('%i' % (i,), [i, set([i, str(i)])]) for i in range(10000))
+		pointless.serialize(v, fname)
+		root = pointless.Pointless(fname, validate_threads = 4).GetRoot()
+		self.assertEqual(len(root), 10000)
+		del root
+
+		# certified validation falls back to full validation, the other modes have nothing to run in parallel
+		root = pointless.Pointless(fname, validate = 'certified', validate_threads = 4).GetRoot()
+		self.assertEqual(len(root), 10000)
+		del root
+
+		for validate in [False, 'lazy']:
+			self.assertRaises(ValueError, pointless.Pointless, fname, validate = validate, validate_threads = 4)
+			self.assertRaises(ValueError, pointless.Pointless, pointless.serialize_to_buffer(v), validate = validate, validate_threads = 4)
+
+		# thread counts above the number of chunks or processors are clamped, absurd ones are rejected
+		root = pointless.Pointless(fname, validate_threads = 1024).GetRoot()
+		self.assertEqual(len(root), 10000)
+		del root
+
+		self.assertRaises(ValueError, pointless.Pointless, fname, validate_threads = 1025)
+		self.assertRaises(ValueError, pointless.Pointless, pointless.serialize_to_buffer(v), validate_threads = 100000)
+
+	def testCertifiedValidate(self):
+		fname = 'test_certified_validate.map'
+		v = {'a': [1, 2, 3], 'b': set(['c', 'd'])}
+		pointless.serialize(v, fname)
+
+		if os.path.exists(fname + '.validated'):
+			os.unlink(fname + '.validated')
+
+		# first open validates and writes the certificate, the second one trusts it
+		for i in range(2):
+			root = pointless.Pointless(fname, validate = 'certified').GetRoot()
+			self.assertEqual(list(root['a']), [1, 2, 3])
+			self.assert_(os.path.exists(fname + '.validated'))
+			del root
+
+		# a new file does not match the old certificate
+		pointless.serialize([1, 2], fname)
+		root = pointless.Pointless(fname, validate = 'certified').GetRoot()
+		self.assertEqual(list(root), [1, 2])
+		del root
+
+		self.assertRaises(ValueError, pointless.Pointless, bytearray(open(fname, 'rb').read()), validate = 'certified')
+
+	def testChecksums(self):
+		# large enough for more than one heap block
+		v = {'a': list(range(400000)), 'b': ['c', 'd', None]}
+
+		for buffer in [pointless.serialize_to_buffer(v, checksums = True), bytearray(pointless.serialize_to_buffer(v, checksums = True))]:
+			p = pointless.Pointless(buffer)
+			p.VerifyChecksums()
+			p.VerifyChecksums(n_threads = 4)
+			self.assertEqual(list(p.GetRoot()['b']), ['c', 'd', None])
+			del p
+
+		fname = 'test_checksums.map'
+		pointless.serialize(v, fname, checksums = True)
+		p = pointless.Pointless(fname)
+		p.VerifyChecksums(2)
+		self.assertEqual(len(p.GetRoot()['a']), 400000)
+		del p
+
+		# files without checksums can not be verified
+		p = pointless.Pointless(pointless.serialize_to_buffer(v))
+		self.assertRaises(ValueError, p.VerifyChecksums)
+		del p
+
+		# heap corruption is found on request, trailer corruption at open time
+		buffer = bytearray(pointless.serialize_to_buffer(v, checksums = True))
+		buffer[len(buffer) // 2] ^= 1
+		p = pointless.Pointless(buffer, validate = False)
+		self.assertRaises(ValueError, p.VerifyChecksums)
+		self.assertRaises(ValueError, p.VerifyChecksums, n_threads = 4)
+		del p
+
+		buffer = bytearray(pointless.serialize_to_buffer(v, checksums = True))
+		buffer[-1] ^= 1
+		self.assertRaises(IOError, pointless.Pointless, buffer)
+
+	def testBorrow(self):
+		v = {'a': [1, 2, 3], 'b': 'c'}
+		buffer = pointless.serialize_to_buffer(v)
+
+		for b in [bytes(buffer), memoryview(bytes(buffer)), memoryview(bytearray(buffer)).toreadonly()]:
+			for validate in [True, False, 'lazy']:
+				p = pointless.Pointless(b, borrow = True, validate = validate)
+				self.assertEqual(p.GetRoot()['b'], 'c')
+				self.assertEqual(list(p.GetRoot()['a']), [1, 2, 3])
+				del p
+
+		# read-only sources are borrowed, and stay exported until the file is closed
+		m = memoryview(bytes(buffer))
+		p = pointless.Pointless(m, borrow = True)
+		self.assertRaises(BufferError, m.release)
+		del p
+		m.release()
+
+		# writable sources could change after validation, and the reader needs aligned data, so neither is borrowed
+		for b in [bytearray(buffer), buffer, memoryview(bytearray(buffer)), memoryview(b'x' + bytes(buffer))[1:]]:
+			self.assertRaises(ValueError, pointless.Pointless, b, borrow = True)
+
+		# residency options only apply to files
+		for kwargs in [{'populate': True}, {'advice': 'willneed'}, {'lock': True}, {'hugepages': True}]:
+			self.assertRaises(ValueError, pointless.Pointless, bytes(buffer), borrow = True, **kwargs)
+
+		self.assertRaises(IOError, pointless.Pointless, bytes(10), borrow = True)
+		self.assertRaises(ValueError, pointless.Pointless, bytes(buffer), borrow = True, validate = 'certified')
+
+	def testOpenFileDescriptor(self):
+		# several files packed into one, each one starting on an 8-byte boundary
+		values = [[1, 'a'], list(range(1000)), ['b' * 10000], [[1, 2], 'c']]
+		windows = []
+		fname = 'test_pack.map'
+
+		with open(fname, 'wb') as f:
+			for v in values:
+				f.write(b'\0' * (8 - f.tell() % 8 if f.tell() % 8 else 0) + b'\0' * 4096)
+				buffer = pointless.serialize_to_buffer(v)
+				windows.append((f.tell(), len(buffer)))
+				f.write(bytes(buffer))
+
+		with open(fname, 'rb') as f:
+			for v, (offset, length) in zip(values, windows):
+				for validate in [True, 'lazy']:
+					p = pointless.Pointless(f.fileno(), offset = offset, length = length, validate = validate)
+					self.assertEqual(pointless.pointless_cmp(p.GetRoot(), v), 0)
+					del p
+
+			# the last one runs to the end of the file
+			offset, length = windows[-1]
+			p = pointless.Pointless(f.fileno(), offset = offset)
+
+			self.assertRaises(IOError, pointless.Pointless, f.fileno(), offset = offset + 4, length = length)
+			self.assertRaises(IOError, pointless.Pointless, f.fileno(), offset = offset, length = length + 8)
+			self.assertRaises(IOError, pointless.Pointless, f.fileno(), offset = windows[1][0], length = windows[1][1] - 8)
+
+		# the file descriptor is no longer needed
+		self.assertEqual(list(p.GetRoot()[0]), [1, 2])
+
+	def testResidencyOptions(self):
+		fname = 'test_residency.map'
+		v = {'a': list(range(100000)), 'b': 'c'}
+		pointless.serialize(v, fname)
+
+		for kwargs in [{'populate': True}, {'advice': 'willneed'}, {'advice': 'random'}, {'advice': 'sequential'}, {'hugepages': True}, {'hugepages': True, 'advice': 'random'}, {'populate': True, 'validate': 'lazy'}]:
+			p = pointless.Pointless(fname, **kwargs)
+			self.assertEqual(p.GetRoot()['b'], 'c')
+			self.assertEqual(p.GetRoot()['a'][99999], 99999)
+			del p
+
+		# locking may be refused by RLIMIT_MEMLOCK, but must not break anything when it succeeds
+		try:
+			p = pointless.Pointless(fname, lock = True)
+			self.assertEqual(p.GetRoot()['b'], 'c')
+			del p
+		except IOError:
+			pass
+
+		with open(fname, 'rb') as f:
+			p = pointless.Pointless(f.fileno(), hugepages = True)
+
+		self.assertEqual(p.GetRoot()['b'], 'c')
+		del p
+
+		self.assertRaises(ValueError, pointless.Pointless, fname, advice = 'sometimes')
+
+	def testStringCache(self):
+		v = {'strings': ['s%i' % (i % 100,) for i in range(1000)], 'unicodes': ['\u20ac%i' % (i,) for i in range(10)], 'map': dict(('k%i' % (i,), i) for i in range(10))}
+
+		for kwargs in [{}, {'utf8': True, 'fasthash': True}]:
+			buffer = pointless.serialize_to_buffer(v, **kwargs)
+
+			# disabled by default
+			p = pointless.Pointless(buffer)
+			self.assertEqual(list(p.GetRoot()['strings']), v['strings'])
+			self.assertEqual(p.GetStringCacheStats(), {'n_entries': 0, 'n_hits': 0, 'n_misses': 0})
+			del p
+
+			# large enough for all strings
+			p = pointless.Pointless(buffer, string_cache = 1000000)
+			root = p.GetRoot()
+			self.assertEqual(list(root['strings']), v['strings'])
+			self.assertTrue(root['strings'][0] is root['strings'][100])
+			self.assertEqual(list(root['unicodes']), v['unicodes'])
+			self.assertEqual(sorted(root['map'].keys()), sorted(v['map'].keys()))
+			self.assertEqual(sorted(root['map'].keys()), sorted(root['map'].keys()))
+
+			stats = p.GetStringCacheStats()
+			self.assertEqual(stats['n_entries'], 100 + 10 + 10)
+			self.assertEqual(stats['n_misses'], 100 + 10 + 10)
+			self.assertEqual(stats['n_hits'], 900 + 2 + 20)
+			del root, p
+
+			# a small cache evicts, but returns the right strings
+			p = pointless.Pointless(buffer, string_cache = 7)
+			root = p.GetRoot()
+			self.assertEqual(p.GetStringCacheStats()['n_entries'], 0)
+
+			for i in range(3):
+				self.assertEqual(list(root['strings']), v['strings'])
+				self.assertEqual(dict(root['map'].items()), v['map'])
+
+			self.assertEqual(p.GetStringCacheStats()['n_entries'], 7)
+			del root, p
+
+	def testSpill(self):
+		v = [list(SimpleSerializeTestCases()), ['s%i' % (i % 100,) for i in range(1000)], ['€%i' % (i,) for i in range(10)]]
+		v.append(dict(('k%i' % (i,), 'x' * i) for i in range(1000)))
+		v.append('y' * (3 * 1024 * 1024))
+
+		for kwargs in [{}, {'mphf': True}, {'hash_slots': True, 'interleaved': True}, {'utf8': True, 'fasthash': True, 'checksums': True}]:
+			buffer = pointless.serialize_to_bytearray(v, **kwargs)
+			self.assertEqual(pointless.serialize_to_bytearray(v, spill_dir = '.', **kwargs), buffer)
+			self.assertEqual(pointless.serialize_to_bytearray(v, spill_dir = '.', n_threads = 3, **kwargs), buffer)
+			self.assertEqual(pointless.serialize_to_bytearray(v, spill_dir = '.', file_backing = 0, **kwargs), buffer)
+			self.assertEqual(pointless.serialize_to_bytearray(v, file_backing = 4096, **kwargs), buffer)
+
+		fname = 'test_spill.map'
+		pointless.serialize(v, fname, spill_dir = '.', file_backing = 1024)
+		p = pointless.Pointless(fname)
+		self.assertEqual(p.GetRoot()[3]['k999'], 'x' * 999)
+		del p
+
+		self.assertRaises(IOError, pointless.serialize_to_bytearray, v, spill_dir = 'does/not/exist')
+
+	def testSerializeAsync(self):
+		pointless.serialize([list(range(1000)), ['a', 'b'], {1: 2}], 'test_async_source.map')
+		source = pointless.Pointless('test_async_source.map').GetRoot()
+		prim_vector = pointless.PointlessPrimVector('u32', sequence = range(100000))
+		v = [list(SimpleSerializeTestCases()), bytearray(b'bytes'), prim_vector, source[0], source[1], source[2]]
+
+		for kwargs in [{}, {'utf8': True, 'fasthash': True, 'n_threads': 2}]:
+			pointless.serialize(v, 'test_sync.map', **kwargs)
+			future = pointless.serialize_async(v, 'test_async.map', **kwargs)
+
+			# buffers are copied, so they are not pinned while the file is written
+			prim_vector.append(1)
+			prim_vector.pop()
+			self.assertEqual(future.result(), None)
+			self.assertTrue(future.done())
+
+			with open('test_sync.map', 'rb') as f_sync, open('test_async.map', 'rb') as f_async:
+				self.assertEqual(f_async.read(), f_sync.read())
+
+		future = pointless.serialize_async(v, 'does/not/exist.map')
+		self.assertRaises(IOError, future.result)
+		self.assertRaises(IOError, future.result)
+		self.assertTrue(future.done())
+
+		# buffers of any size are copied, so changing them right away does not change the file
+		for n in [3, 1000000]:
+			small_bytes, small_vector = bytearray(b'a' * n), pointless.PointlessPrimVector('i16', sequence = [1] * n)
+			future = pointless.serialize_async([small_bytes, small_vector], 'test_async.map')
+			small_bytes[0] = small_bytes[-1] = ord('x')
+			small_bytes.append(ord('d'))
+			small_vector[0] = small_vector[-1] = 4
+			small_vector.append(5)
+			future.result()
+			root = pointless.Pointless('test_async.map').GetRoot()
+			self.assertEqual(bytes(root[0]), b'a' * n)
+			self.assertEqual(list(root[1]), [1] * n)
+			del root
+
+		# the handle keeps the pinned memory alive when nothing else does
+		future = pointless.serialize_async([bytearray(b'x' * 100000), pointless.PointlessPrimVector('i8', sequence = [1, 2])], 'test_async.map')
+		del source
+		future.result()
+		self.assertEqual(list(pointless.Pointless('test_async.map').GetRoot()[1]), [1, 2])
+
+		self.assertRaises(TypeError, pointless.serialize_async, v, 'test_async.map', spill_dir = 5)
+		self.assertRaises(ValueError, pointless.serialize_async, [object()], 'test_async.map')
+
+	def testSerializeBorrowedBuffers(self):
+		# buffers are written from their own memory, while another thread keeps swapping their contents,
+		# every file must hold them as they were at some single point in time
+		n = 1000000
+		b, v = bytearray(b'a' * n), pointless.PointlessPrimVector('u8', sequence = b'a' * n)
+		stop = threading.Event()
+
+		def swap():
+			m = memoryview(v)
+
+			while not stop.is_set():
+				for c in [b'b', b'a']:
+					b[:] = c * n
+					m[:] = c * n
+
+			m.release()
+
+		t = threading.Thread(target = swap)
+		t.start()
+
+		try:
+			for i in range(5):
+				pointless.serialize([b, v], 'test_borrowed.map')
+				buffers = [pointless.Pointless('test_borrowed.map').GetRoot(), pointless.Pointless(pointless.serialize_to_buffer([b, v])).GetRoot()]
+
+				for root in buffers:
+					for r in [bytes(root[0]), bytes(bytearray(root[1]))]:
+						self.assertTrue(r == b'a' * n or r == b'b' * n)
+		finally:
+			stop.set()
+			t.join()
+
+	def testPrefetch(self):
+		fname = 'test_prefetch.map'
+		v = {'users': [{'name': 'u%i' % i, 'ids': list(range(i, i + 100))} for i in range(1000)], 'other': set(range(100))}
+		pointless.serialize(v, fname)
+
+		for validate in [True, 'lazy']:
+			p = pointless.Pointless(fname, validate = validate)
+			root = p.GetRoot()
+			p.prefetch()
+			p.prefetch(root['users'], max_depth = 1)
+			p.prefetch(root['other'])
+			self.assertEqual(root['users'][999]['name'], 'u999')
+
+			p.prefetch(root['users'], background = True)
+			p.prefetch(background = True)
+
+			# callers on several threads share the list of background prefetches
+			threads = [threading.Thread(target = p.prefetch, args = (root['users'], 2, True)) for i in range(8)]
+
+			for t in threads:
+				t.start()
+
+			for t in threads:
+				t.join()
+
+			self.assertEqual(root['users'][0]['ids'][99], 99)
+
+			# values must come from the same pointless object
+			self.assertRaises(ValueError, p.prefetch, [1, 2])
+			self.assertRaises(ValueError, p.prefetch, pointless.Pointless(fname).GetRoot())
+
+			del root
+			del p
+
+		# buffers are already in memory
+		p = pointless.Pointless(pointless.serialize_to_buffer(v))
+		p.prefetch(background = True)
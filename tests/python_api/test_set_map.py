@@ -1,6 +1,6 @@
 #!/usr/bin/python
 
-import pointless
+import pointless, random, struct
 
 from twisted.trial import unittest
 
@@ -159,3 +159,267 @@ class TestSetMap(unittest.TestCase):
 				del root_c
 
 			del root_a
+
+	def testMapGetMany(self):
+		v = dict((i, str(i)) for i in range(10000))
+		v.update({'a': 1, (1, 'b'): [2, 3]})
+		m = pointless.Pointless(pointless.serialize_to_buffer(v)).GetRoot()
+
+		keys = list(v.keys()) + [-1, 'b', (1, 'c'), 10000]
+		random.shuffle(keys)
+
+		values = m.get_many(keys)
+		self.assertEqual(len(values), len(keys))
+
+		for k, vv in zip(keys, values):
+			if k == (1, 'b'):
+				vv = list(vv)
+
+			self.assertEqual(vv, v.get(k))
+
+		self.assertEqual(m.get_many(iter([1, 2, -5]), 'x'), ['1', '2', 'x'])
+		self.assertEqual(m.get_many([]), [])
+		self.assertRaises(ValueError, m.get_many, [[1, 2]])
+		self.assertRaises(TypeError, m.get_many, 1)
+
+	def testInterleaved(self):
+		v = dict((i, str(i)) for i in range(1000))
+		v.update({'a': set([1, 2, 'b']), (1, 'b'): {}, 'e': set()})
+
+		buffer = pointless.serialize_to_buffer(v, interleaved = True, checksums = True)
+
+		for validate in [True, 'lazy', False]:
+			p = pointless.Pointless(buffer, validate = validate)
+			m = p.GetRoot()
+			self.assertEqual(len(m), len(v))
+			self.assertEqual(sorted(k for k in m if isinstance(k, int)), list(range(1000)))
+			self.assertEqual(m[999], '999')
+			self.assertEqual(m.get_many([5, 'x', 'a'], None)[:2], ['5', None])
+			self.assertTrue(2 in m['a'] and 'b' in m['a'] and 3 not in m['a'])
+			self.assertEqual(len(m[(1, 'b')]), 0)
+			self.assertEqual(len(m['e']), 0)
+			self.assertFalse('x' in m)
+			del m, p
+
+		p = pointless.Pointless(buffer)
+		p.VerifyChecksums()
+		del p
+
+		# interleaved alone does not add checksums
+		p = pointless.Pointless(pointless.serialize_to_buffer(v, interleaved = True))
+		self.assertEqual(p.GetRoot()[999], '999')
+		self.assertRaises(ValueError, p.VerifyChecksums)
+		del p
+
+	def testMphf(self):
+		v = dict(('k%d' % i, i) for i in range(5000))
+
+		# keys with equal hashes end up in the overflow
+		v.update({-1: 'a', 2**32 - 1: 'b', 1.5: 'c', 1069547520: 'd', 'e': set([-1, 2**32 - 1, 1]), 'f': set(), 'g': {}})
+
+		buffer = pointless.serialize_to_buffer(v, mphf = True, checksums = True)
+		self.assertTrue(len(buffer) < len(pointless.serialize_to_buffer(v, checksums = True)))
+
+		for validate in [True, 'lazy', False]:
+			p = pointless.Pointless(buffer, validate = validate)
+			m = p.GetRoot()
+			self.assertEqual(len(m), len(v))
+			self.assertEqual(sorted(k for k in m if isinstance(k, str) and k.startswith('k')), sorted(k for k in v if isinstance(k, str) and k.startswith('k')))
+
+			for k in [-1, 2**32 - 1, 1.5, 1069547520, 'k0', 'k4999']:
+				self.assertEqual(m[k], v[k])
+
+			self.assertEqual(m.get_many([-1, 'x', 1069547520, 2**32 - 2, 'k7']), ['a', None, 'd', None, 7])
+			self.assertTrue(-1 in m['e'] and 2**32 - 1 in m['e'] and 1 in m['e'] and 2 not in m['e'])
+			self.assertEqual(len(m['f']), 0)
+			self.assertEqual(len(m['g']), 0)
+			self.assertFalse('x' in m)
+			del m, p
+
+		p = pointless.Pointless(buffer)
+		p.VerifyChecksums()
+		del p
+
+	def testFastHash(self):
+		# every tail length, and latin-1, 16-bit and 32-bit code points, as keys and inside tuple keys
+		keys = ['x' * i for i in range(40)] + ['\xe9' * i for i in range(1, 40)] + ['\u0101' * i for i in range(1, 40)] + ['\U00010001' * i for i in range(1, 40)]
+		keys += ['a\xe9\u0101\U00010001' * i for i in range(1, 20)] + [('a', i, 'b' * i) for i in range(20)]
+		v = dict((k, i) for i, k in enumerate(keys))
+		v['s'] = set(keys[:50])
+
+		for s in ['', 'abc', '\xe9' * 17, '\u0101' * 33, '\U00010001' * 5]:
+			self.assertNotEqual(pointless.pyobject_hash(s, 3, 0), pointless.pyobject_hash(s, 3, 8))
+
+		# the v2 string hash is opt-in, by default the hash is that of a file written without format keywords
+		self.assertEqual(pointless.pyobject_hash('abc'), 2694041763)
+		self.assertEqual(pointless.pyobject_hash('abc'), pointless.pyobject_hash('abc', 2))
+		self.assertEqual(pointless.pyobject_hash(('abc', 1)), pointless.pyobject_hash(('abc', 1), 3, 0))
+
+		for kwargs in [{}, {'interleaved': True}, {'mphf': True}, {'unwiden_strings': True}]:
+			buffer = pointless.serialize_to_buffer(v, fasthash = True, checksums = True, **kwargs)
+
+			for validate in [True, 'lazy', False]:
+				p = pointless.Pointless(buffer, validate = validate)
+				m = p.GetRoot()
+				self.assertEqual(len(m), len(v))
+
+				for k in keys:
+					self.assertEqual(m[k], v[k])
+					self.assertTrue(k in m)
+
+				self.assertTrue(all(k in m['s'] for k in keys[:50]))
+				self.assertFalse(keys[60] in m['s'])
+				self.assertEqual(m.get_many(['x' * 40, 'xxx', ('a', 1, 'b')]), [None, 3, v[('a', 1, 'b')]])
+				del m, p
+
+			p = pointless.Pointless(buffer)
+			p.VerifyChecksums()
+			del p
+
+	def testHashSlots(self):
+		# strings, value vectors and primitive vectors, as keys and inside tuple keys
+		keys = ['x' * i for i in range(40)] + ['\u0101' * i for i in range(1, 20)] + ['\U00010001' * i for i in range(1, 20)]
+		keys += [('a', i, 'b' * i) for i in range(20)] + [(i, i + 1, i + 2) for i in range(20)] + [(('a', i), (i, None)) for i in range(20)]
+		v = dict((k, i) for i, k in enumerate(keys))
+		v['s'] = set(keys[:50])
+		v['l'] = [list(k) if isinstance(k, tuple) else k for k in keys]
+		# tuples with unhashable items below the first level
+		v['n'] = [({},), ([1, (2, frozenset([3]))],), (('a', 1),)]
+
+		for kwargs in [{}, {'interleaved': True}, {'mphf': True}]:
+			buffer = pointless.serialize_to_buffer(v, hash_slots = True, fasthash = True, checksums = True, **kwargs)
+			self.assertGreater(len(buffer), len(pointless.serialize_to_buffer(v, fasthash = True, checksums = True, **kwargs)))
+
+			for validate in [True, 'lazy', False]:
+				p = pointless.Pointless(buffer, validate = validate)
+				m = p.GetRoot()
+				self.assertEqual(len(m), len(v))
+
+				for k in keys:
+					self.assertEqual(m[k], v[k])
+					self.assertTrue(k in m)
+					self.assertEqual(pointless.pyobject_hash(k, 3, 8 | 16), pointless.pyobject_hash(k, 3, 8))
+
+				self.assertTrue(all(k in m['s'] for k in keys[:50]))
+				self.assertFalse(keys[60] in m['s'])
+
+				# whole vectors are told apart by their stored hashes, slices are compared item by item
+				l = m['l']
+				self.assertEqual(l[80], l[80])
+				self.assertNotEqual(l[80], l[81])
+				self.assertEqual(l[80][:2], l[80][:2])
+				self.assertNotEqual(l[80][:2], l[81][:2])
+				self.assertEqual(list(l[100]), v['l'][100])
+				self.assertEqual(pointless.pyobject_hash(m['n'][2], 3, 8 | 16), pointless.pyobject_hash(v['n'][2], 3, 8 | 16))
+				del l, m, p
+
+			p = pointless.Pointless(buffer)
+			p.VerifyChecksums()
+			del p
+
+	def testHashSlotsCorrupt(self):
+		# tuples outside of keys store no hash, a non-zero one is found by full validation, and by lazy validation when touched
+		v = [(1, 'ab'), (2, ('cd', 3))]
+		buffer = bytearray(pointless.serialize_to_buffer(v, hash_slots = True))
+		n_string_unicode, n_vector, n_bitvector, n_set, n_map = struct.unpack_from('<5I', buffer, 8)
+		vector_hashes = 32 + 8 * (n_string_unicode + n_vector + n_bitvector + n_set + n_map) + 4 * n_string_unicode
+		self.assertEqual(buffer[vector_hashes:vector_hashes + 4 * n_vector], bytes(4 * n_vector))
+
+		for i in range(n_vector):
+			struct.pack_into('<I', buffer, vector_hashes + 4 * i, 0x12345678)
+
+		self.assertRaises(IOError, pointless.Pointless, buffer)
+		self.assertRaises(IOError, pointless.Pointless, buffer, validate_threads = 4)
+		self.assertRaises(ValueError, lambda: pointless.Pointless(buffer, validate = 'lazy').GetRoot()[1] == (2, ('cd', 3)))
+
+	def testHashSlotsAcrossFiles(self):
+		# files with different string hashes store different hashes for equal vectors, so those are compared item by item
+		v = {('a', 'bc', 1): 1, ('x', ('y', 'zz')): 2, (): 3}
+		roots = [pointless.Pointless(pointless.serialize_to_buffer(v, hash_slots = True, **kwargs)).GetRoot() for kwargs in [{}, {'fasthash': True}]]
+		roots.append(pointless.Pointless(pointless.serialize_to_buffer(v, fasthash = True)).GetRoot())
+		keys = [sorted(r.keys(), key = repr) for r in roots]
+
+		for a in keys:
+			for b in keys:
+				self.assertEqual(a, b)
+				self.assertTrue(all(k_a == k_b for k_a, k_b in zip(a, b)))
+				self.assertFalse(any(k_a != k_b for k_a, k_b in zip(a, b)))
+				self.assertFalse(a[1] == b[2])
+
+		del roots, keys
+
+	def testLookupAcrossFiles(self):
+		# vector keys read from one file are found in the sets/maps of another, whatever string hash either uses
+		keys = [('a', 'bc', 1), ('x', ('y', 'zz')), (1, 2.5, None), ()]
+		v = [keys, set(keys), dict((k, i) for i, k in enumerate(keys))]
+		formats = [{}, {'fasthash': True}, {'hash_slots': True}, {'hash_slots': True, 'fasthash': True}]
+		roots = [pointless.Pointless(pointless.serialize_to_buffer(v, **kwargs)).GetRoot() for kwargs in formats]
+
+		for a in roots:
+			for b in roots:
+				for i, k in enumerate(a[0]):
+					self.assertTrue(k in b[1])
+					self.assertEqual(b[2][k], i)
+
+		del roots
+
+	def testHashSlotsKeysOnly(self):
+		# deeply nested tuple keys, and vectors which are only reachable as values, or not hashable
+		t = ()
+
+		for i in range(200):
+			t = (t, i, 'x' * (i % 5))
+
+		v = {t: 1, (t, t): 2, 'p': pointless.PointlessPrimVector('u32', sequence = range(100000)), 'l': [[t], (t, {})]}
+
+		for kwargs in [{}, {'interleaved': True}, {'mphf': True}]:
+			buffer = pointless.serialize_to_buffer(v, hash_slots = True, **kwargs)
+
+			for validate in [True, 'lazy', False]:
+				m = pointless.Pointless(buffer, validate = validate).GetRoot()
+				self.assertEqual(m[t], 1)
+				self.assertEqual(m[(t, t)], 2)
+				self.assertEqual(pointless.pyobject_hash(m['l'][0][0], 3, 16), pointless.pyobject_hash(t, 3, 16))
+				self.assertEqual(m['l'][0][0], m['l'][1][0])
+				self.assertEqual(list(m['p']), list(range(100000)))
+				self.assertEqual(pointless.pyobject_hash(m['p']), pointless.pyobject_hash(v['p'], 3, 16))
+				del m
+
+	def testCreateCmp(self):
+		# keys of different types whose hashes are equal are told apart when the file is created
+		for v in [set([0, '']), set([None, '', False]), {0: 1, '': 2}]:
+			for kwargs in [{}, {'interleaved': True}, {'mphf': True}]:
+				root = pointless.Pointless(pointless.serialize_to_buffer(v, **kwargs)).GetRoot()
+				self.assertEqual(sorted(map(repr, root)), sorted(map(repr, v)))
+				del root
+
+		# keys holding empty tuples, at any depth, are hashed and compared as empty, not as the first other vector
+		for v in [set([((), 1), ((), 2)]), {((), ()): 1, ((),): 2}, set([(((),),), ((), ((),))])]:
+			for kwargs in [{}, {'interleaved': True}, {'mphf': True}, {'hash_slots': True}]:
+				root = pointless.Pointless(pointless.serialize_to_buffer([[7, 8], v, [(), [9]]], **kwargs)).GetRoot()[1]
+				self.assertEqual(len(root), len(v))
+				self.assertTrue(all(k in root for k in v))
+				del root
+
+	def testParallel(self):
+		# many small tables, so they are handed out in more than one chunk, and a few big ones
+		v = [dict(('k%d' % j, set([i, j, 'x' * j])) for j in range(i % 7)) for i in range(3000)]
+		# keys of different types with equal hashes
+		v.append(set([0, '', ()]))
+		v.append(dict((i, (str(i), i)) for i in range(20000)))
+		v.append(set(('s', i) for i in range(10000)))
+		v.append(dict(('\U00010001' * i, frozenset([i])) for i in range(100)))
+
+		for kwargs in [{}, {'interleaved': True}, {'mphf': True}, {'utf8': True, 'fasthash': True}]:
+			buffer = pointless.serialize_to_bytearray(v, **kwargs)
+
+			for n_threads in [0, 2, 7]:
+				self.assertEqual(pointless.serialize_to_bytearray(v, n_threads = n_threads, **kwargs), buffer)
+
+			p = pointless.Pointless(buffer)
+			m = p.GetRoot()
+			self.assertEqual(len(m[3000]), 3)
+			self.assertEqual(set(m[5]['k4']), v[5]['k4'])
+			self.assertEqual(list(m[3001][19999]), ['19999', 19999])
+			self.assertTrue(('s', 9999) in m[3002])
+			del m, p